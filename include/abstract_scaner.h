@@ -51,6 +51,9 @@ namespace ascaner{
         int                          state_; //< the current state of the current automaton
         Location_ptr                 loc_;
         char32_t*                    lexeme_begin_; /* pointer to the lexem begin */
+        /* The position of lexeme_begin_ in the text. Since lexeme_begin_ precedes the
+         * spaces before the lexem, this is not the position of the lexem itself. */
+        Position                     lexeme_begin_pos_;
         char32_t                     ch_;           /* current character */
 
         /* set of categories for the current character */
@@ -63,6 +66,8 @@ namespace ascaner{
 
         /* a pointer to a class that counts the number of errors: */
         std::shared_ptr<Error_count> en_;
+        /* a pointer to the buffer of diagnostics: */
+        std::shared_ptr<Diagnostics> diags_;
         /* a pointer to the prefix tree for identifiers: */
         std::shared_ptr<Char_trie>   ids_;
         /* a pointer to the prefix tree for string literals: */
@@ -79,8 +84,10 @@ namespace ascaner{
         ids_                     = et.ids_trie_;
         strs_                    = et.strs_trie_;
         en_                      = et.ec_;
+        diags_                   = et.diags_;
         loc_                     = location;
         lexeme_begin_            = location->pcurrent_char_;
+        lexeme_begin_pos_        = location->pos_;
         token_.range_.begin_pos_ = Position();
         token_.range_.end_pos_   = Position();
         lexeme_pos_.begin_pos_   = Position();
@@ -103,7 +110,7 @@ namespace ascaner{
     void Abstract_scaner<Lexeme_type>::back()
     {
         loc_->pcurrent_char_ = lexeme_begin_;
-        loc_->pos_           = lexeme_pos_.begin_pos_;
+        loc_->pos_           = lexeme_begin_pos_;
     }
 
     template<typename Lexeme_type>
@@ -22,14 +22,18 @@ enum class Aux_expr_lexem_code : uint16_t{
     M_Class_Latin,   M_Class_Letter,              M_Class_Russian,
     M_Class_bdigits, M_Class_digits,              M_Class_latin,
     M_Class_letter,  M_Class_odigits,             M_Class_russian,
-    M_Class_xdigits, M_Class_ndq,                 M_Class_nsq
+    M_Class_xdigits, M_Class_ndq,                 M_Class_nsq,
+    Class_unicode
 };
 
 struct Aux_expr_lexem_info{
     Aux_expr_lexem_code code_;
+    /* true, if the lexeme is a character written with a backslash, e.g. \- */
+    bool                escaped_;
     union{
         size_t   action_name_index_;
         size_t   regexp_name_index_;
+        size_t   category_index_; /* index in the array unicode_categories */
         char32_t c_;
     };
 };
@@ -26,10 +26,16 @@ public:
     virtual ~Aux_expr_scaner()                   = default;
     ascaner::Token<Aux_expr_lexem_info> current_lexeme() override;
     std::string lexeme_to_string(const Aux_expr_lexem_info& li) override;
+    /* The escaped hyphen \- is a character only inside [^ ... ^]; outside the
+     * complement of a class the backslash keeps denoting itself. The scaner of
+     * expressions switches this mode on and off around the complement. */
+    void set_class_complement_mode(bool inside) {inside_class_complement_ = inside;};
 private:
+    bool inside_class_complement_ = false;
+
     enum Automaton_name{
         A_start, A_backslash, A_maybe_class, A_class,
-        A_hat,   A_action,    A_regexp_name
+        A_hat,   A_action,    A_regexp_name, A_unicode_class
     };
     Automaton_name automaton_; /* current automaton */
 
@@ -49,16 +55,20 @@ private:
     bool start_proc();       bool backslash_proc();
     bool maybe_class_proc(); bool class_proc();
     bool hat_proc();         bool action_proc();
-    bool regexp_name_proc();
+    bool regexp_name_proc(); bool unicode_class_proc();
     /* functions to perform actions in case of unexpected end of lexem */
     void none_final_proc();         void backslash_final_proc();
     void maybe_class_final_proc();  void class_final_proc();
     void hat_final_proc();          void action_final_proc();
-    void regexp_name_final_proc();
+    void regexp_name_final_proc();  void unicode_class_final_proc();
     /* If the lexem most likely is character class, then the following
      * function corrects lexem code, and displays the needed diagnostic
      * messsage. */
     void correct_class();
+    /* The following function searches for the Unicode general category whose name
+     * is collected in buffer_, and displays the needed diagnostic message if there
+     * is no such category. */
+    void finish_unicode_class();
 };
 
 using Aux_expr_scaner_ptr = std::unique_ptr<Aux_expr_scaner>;
@@ -12,26 +12,56 @@
 
 #include <vector>
 #include <cstddef>
+#include <cstdint>
 /* This file defines the commands, in which are compiled regular expressions. */
-enum class Command_name{
+enum class Command_name : uint8_t{
     Or,                    Concat,  Kleene,      Positive,
     Optional,              Char,    Char_class,  Unknown,
     Char_class_complement, Multior, Multiconcat, Regexp_name
 };
 
+/* The number of bits for the index of the name of an action: the name of a command
+ * is kept in the same 32-bit word, so a command takes 12 bytes. Indices of commands,
+ * of sets of characters, and of regexp names are 32-bit. The parser reports an error
+ * instead of writing a larger index into a command. */
+constexpr unsigned bits_for_action_name    = 24;
+constexpr size_t   max_action_name_index   = (size_t(1) << bits_for_action_name) - 1;
+constexpr size_t   max_set_index           = UINT32_MAX;
+constexpr size_t   max_regexp_name_index   = UINT32_MAX;
+
 struct Command{
-    size_t action_name_; /* The index of the identifier that is the name of
-                          * the action, in the prefix tree of identifiers. */
-    Command_name name_;
+    uint32_t     action_name_ : bits_for_action_name; /* The index of the identifier
+                                                       * that is the name of the action,
+                                                       * in the prefix tree of
+                                                       * identifiers. */
+    Command_name name_        : 8;
     union{
         struct {
-            size_t first_, second_;
+            uint32_t first_, second_;
         } args;
         char32_t   c_;
-        size_t     idx_of_set_;
-        size_t     idx_of_regexp_name_;
+        uint32_t   idx_of_set_;
+        uint32_t   idx_of_regexp_name_;
     };
 };
 
+static_assert(sizeof(Command) <= 12, "A command must take at most 12 bytes.");
+
 using Command_buffer = std::vector<Command>;
+
+/* Commands, some of which are n-ary: the operands of a command Multior or
+ * Multiconcat are the args.second_ commands whose indices are written in operands_,
+ * starting with operands_[args.first_]. As in Command_buffer, the operands of every
+ * command precede it. */
+struct Flat_commands{
+    Command_buffer        commands_;
+    std::vector<uint32_t> operands_;
+};
+
+/* The parser writes the action of a subexpression only into its last command,
+ * i.e. into the root of the subexpression. This function writes the action into
+ * all commands of the subexpression; the action of an enclosing subexpression
+ * replaces the actions of nested ones. The time is linear in the size of buf. */
+void resolve_actions(Command_buffer& buf);
+void resolve_actions(Flat_commands& buf);
 #endif
\ No newline at end of file
@@ -0,0 +1,42 @@
+/*
+    File:    command_passes.h
+    Created: 19 October 2026 at 16:50 Moscow time
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+
+#ifndef COMMAND_PASSES_H
+#define COMMAND_PASSES_H
+#include "../include/command.h"
+#include "../include/trie_for_set_of_segments.h"
+/* Transformations of commands built by the parser of regular expressions. */
+
+/* Replaces chains of binary operators Or and Concat, for example the chain
+ * Or(Or(Or(a, b), c), d), by the n-ary commands Multior and Multiconcat, whose
+ * operands are listed in the order of the regular expression. An operand is merged
+ * into the enclosing command only if its action is zero or equals the action of
+ * the enclosing command, so actions mean the same after the pass. A command with
+ * two operands remains binary. The time is linear in the size of buf. */
+Flat_commands flatten(const Command_buffer& buf);
+
+/* Simplifies commands by the following identities (x is any expression, and c1, ...,
+ * cn are characters and classes of characters):
+ *      c1 | ... | cn           = the class that is the union of c1, ..., cn;
+ *      (x*)* = (x+)* = (x?)*   = (x*)+ = (x?)+ = (x*)? = (x+)? = x*;
+ *      (x+)+ = x+,  (x?)? = x?.
+ * The alternatives of Or and Multior that are characters and classes are merged
+ * into one class, even if other alternatives are present. As in flatten(), commands
+ * are merged only if their actions are compatible. New classes are written into
+ * the prefix tree sets. Every command must be an operand of at most one command. */
+Flat_commands simplify(const Flat_commands& buf, const Trie_for_char_segments_ptr& sets);
+
+/* Replaces structurally identical commands (with the same name, action, operands,
+ * and character or set of characters) by one command, so the commands form a DAG
+ * instead of a tree. The actions of buf must be resolved (see resolve_actions),
+ * since the action of a shared command cannot depend on the command using it. The
+ * element ref_counts[i] of the result is the number of operands referring to the
+ * command i; the passes above must not be applied to the result. */
+Flat_commands hash_cons(const Flat_commands& buf, std::vector<uint32_t>& ref_counts);
+#endif
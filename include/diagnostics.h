@@ -0,0 +1,96 @@
+/*
+    File:    diagnostics.h
+    Created: 19 October 2026 at 15:40 Moscow time
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+
+#ifndef DIAGNOSTICS_H
+#define DIAGNOSTICS_H
+#   include <cstddef>
+#   include <cstdint>
+#   include <string>
+#   include <memory>
+#   include <vector>
+#   include "../include/char_trie.h"
+
+/* Kinds of diagnostics of the scaners and the parser of regular expressions. The
+ * comments describe the argument of a diagnostic, if the diagnostic has it. */
+enum class Diagnostic_code : uint8_t{
+    Expected_char_class,             ///< the number of the class in the enumeration
+                                     ///< of classes, starting with [:Latin:]
+    Expected_LRbdlnorx,
+    Unknown_unicode_category,        ///< the index of the name of the category
+                                     ///< in the texts of diagnostics
+    Unicode_class_end_expected,
+    Latin_letter_expected,
+    Undefined_regexp_name,           ///< the index of the name in the trie of
+                                     ///< identifiers
+    Not_admissible_nsq_ndq,
+    Not_admissible_lexeme,
+    Reversed_range,
+    Undefined_action,                ///< the index of the name in the trie of
+                                     ///< identifiers
+    It_is_not_action,                ///< the index of the name in the trie of
+                                     ///< identifiers
+    Opening_curly_brace_is_expected,
+    Char_or_char_class_expected,
+    Or_operator_or_brace_expected,
+    Unexpected_action,
+    Unexpected_postfix_operator,
+    Unexpected_end_of_text,
+    Unexpected_opening_brace,
+    Or_operator_or_round_br_closed,
+    Too_large_action_index,          ///< the index of the name in the trie of
+                                     ///< identifiers
+    Too_large_set_index,
+    Too_large_regexp_name_index,     ///< the index of the name in the trie of
+                                     ///< identifiers
+    Number_of_codes                  ///< not a diagnostic: the number of codes
+};
+
+struct Diagnostic{
+    Diagnostic_code code_;
+    size_t          line_no_;
+    size_t          arg_;
+};
+
+/*
+ * The buffer of diagnostics of one session of processing of a text. Scaners and
+ * parsers only append records to it, so reporting an error costs one push_back;
+ * the messages are formatted by the function print(), in the order of reporting.
+ */
+class Diagnostics{
+public:
+    Diagnostics()                         = delete;
+    ~Diagnostics()                        = default;
+    Diagnostics(const Diagnostics& orig)  = default;
+    explicit Diagnostics(const std::shared_ptr<Char_trie>& ids) :
+        ids_(ids), texts_(std::make_shared<Char_trie>()) {};
+
+    void add(Diagnostic_code code, size_t line_no, size_t arg = 0)
+    {
+        records_.push_back(Diagnostic{code, line_no, arg});
+    }
+
+    /* Saves the text that is an argument of a diagnostic, but is not written into
+     * any trie of the session. Returns the index of the saved text. */
+    size_t add_text(const std::u32string& text);
+
+    const std::vector<Diagnostic>& records() const
+    {
+        return records_;
+    }
+
+    void print(const Diagnostic& d) const;
+
+    /* Prints all recorded diagnostics. */
+    void print() const;
+private:
+    std::vector<Diagnostic>    records_;
+    std::shared_ptr<Char_trie> ids_;
+    std::shared_ptr<Char_trie> texts_;
+};
+#endif
@@ -13,6 +13,7 @@
 #include <memory>
 #include "../include/error_count.h"
 #include "../include/char_trie.h"
+#include "../include/diagnostics.h"
 struct Errors_and_tries{
     Errors_and_tries()                                    = default;
     ~Errors_and_tries()                                   = default;
@@ -22,5 +23,6 @@ struct Errors_and_tries{
     std::shared_ptr<Error_count>  ec_;
     std::shared_ptr<Char_trie>    ids_trie_;
     std::shared_ptr<Char_trie>    strs_trie_;
+    std::shared_ptr<Diagnostics>  diags_;
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,39 @@
+/*
+    File:    expr_direct_parser.h
+    Created: 19 October 2026 at 14:10 Moscow time
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+#ifndef EXPR_DIRECT_PARSER_H
+#define EXPR_DIRECT_PARSER_H
+#include <memory>
+#include <cstddef>
+#include "../include/command.h"
+#include "../include/expr_parser.h"
+#include "../include/expr_lr_tables.h"
+/*
+ * The direct-coded parser of regular expressions. Its function compile() is
+ * generated by the script tools/gen_lr_tables.py (the option --kind direct) from
+ * the same grammar as the tables of SLR_act_expr_parser: every state of the parser
+ * is a block of code, and transitions are jumps, so the parser neither reads the
+ * tables nor decodes actions. The generation of commands, the calculation of
+ * attributes, and the error handling are inherited from SLR_act_expr_parser, so
+ * both parsers build the same commands and print the same diagnostics. The steps
+ * start, read_lexeme, shift_to, reduce_by and finish of the generated code are the
+ * steps of Basic_LR_parser, with which the table-driven compile() is written.
+ */
+class Direct_expr_parser : public SLR_act_expr_parser{
+public:
+    Direct_expr_parser()                               = default;
+    ~Direct_expr_parser()                              = default;
+    Direct_expr_parser(const Direct_expr_parser& orig) = default;
+    Direct_expr_parser(const escaner::Expr_scaner_ptr& esc,
+                       const Errors_and_tries&         et,
+                       const std::shared_ptr<Scope>&   scope) :
+        SLR_act_expr_parser(esc, et, scope, expr_slr_tables) {};
+
+    void compile(Command_buffer& buf);
+};
+#endif
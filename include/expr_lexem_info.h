@@ -10,6 +10,7 @@
 #ifndef EXPR_LEXEM_INFO_H
 #define EXPR_LEXEM_INFO_H
 #include <cstddef>
+#include <cstdint>
 namespace escaner{
     enum class Expr_lexem_code : uint16_t {
         Nothing,             UnknownLexem,        Action,
@@ -21,13 +21,24 @@
 #include "../include/expr_lr_tables.h"
 #include "../include/types_for_lr_tables.h"
 
+class SLR_act_expr_parser;
+
+/* The hooks of SLR_act_expr_parser are called by the driver directly, without
+ * virtual functions. */
 using Concrete_LR_parser =
-    LR_parser<Expr_grammar_traits, Expr_scaner_traits, Command_buffer>;
+    Basic_LR_parser<SLR_act_expr_parser, Expr_grammar_traits, Expr_scaner_traits,
+                    Command_buffer>;
+
+/* The driver is instantiated in expr_parser.cpp, where the hooks are defined, so
+ * that they can be inlined into it. */
+extern template class Basic_LR_parser<SLR_act_expr_parser, Expr_grammar_traits,
+                                      Expr_scaner_traits, Command_buffer>;
+
 
 class SLR_act_expr_parser : public Concrete_LR_parser{
 public:
     SLR_act_expr_parser()                                = default;
-    virtual ~SLR_act_expr_parser()                       = default;
+    ~SLR_act_expr_parser()                               = default;
     SLR_act_expr_parser(const SLR_act_expr_parser& orig) = default;
 
     SLR_act_expr_parser(const escaner::Expr_scaner_ptr&              esc,
@@ -37,26 +48,39 @@ public:
        Concrete_LR_parser(esc, tables), scope_(scope),  et_(et) {};
 
 private:
+    friend Concrete_LR_parser;
+
     std::shared_ptr<Scope>       scope_;
     Errors_and_tries             et_;
 
-    using Error_handler = Parser_action_info (SLR_act_expr_parser::*)();
+    using Error_handler = Action_type (SLR_act_expr_parser::*)();
     static Error_handler error_hadler[];
 
-    using Attrib_calculator = Attributes<Lexem_type> (SLR_act_expr_parser::*)();
-    static Attrib_calculator attrib_calculator[];
-
-    Attributes<Lexem_type> attrib_by_S_is_pTq();
-    Attributes<Lexem_type> attrib_by_T_is_TbE();
-    Attributes<Lexem_type> attrib_by_T_is_E();
-    Attributes<Lexem_type> attrib_by_E_is_EF();
-    Attributes<Lexem_type> attrib_by_E_is_F();
-    Attributes<Lexem_type> attrib_by_F_is_Gc();
-    Attributes<Lexem_type> attrib_by_F_is_G();
-    Attributes<Lexem_type> attrib_by_G_is_Ha();
-    Attributes<Lexem_type> attrib_by_G_is_H();
-    Attributes<Lexem_type> attrib_by_H_is_d();
-    Attributes<Lexem_type> attrib_by_H_is_LP_T_RP();
+    Attrib_type attrib_by_S_is_pTq();
+    Attrib_type attrib_by_T_is_TbE();
+    Attrib_type attrib_by_T_is_E();
+    Attrib_type attrib_by_E_is_EF();
+    Attrib_type attrib_by_E_is_F();
+    Attrib_type attrib_by_F_is_Gc();
+    Attrib_type attrib_by_F_is_G();
+    Attrib_type attrib_by_G_is_Ha();
+    Attrib_type attrib_by_G_is_H();
+    Attrib_type attrib_by_H_is_d();
+    Attrib_type attrib_by_H_is_LP_T_RP();
+
+    size_t checked_index(size_t idx, size_t max_idx, Diagnostic_code code);
+
+    /* The beginning of the last lexeme about which an error has been reported. The
+     * handlers of the states 4, 6 and 7 only reduce, so the same lexeme can come to
+     * several of them in turn; the error is reported by the first of them. */
+    const char32_t* last_error_point_ = nullptr;
+
+    /* The beginning of the current lexeme li in the text. */
+    const char32_t* error_point() const;
+
+    /* Reports the error code about li, unless an error has already been reported
+     * about the lexeme beginning at the same place of the text. */
+    void report_once(Diagnostic_code code);
 
     void generate_by_G_is_Ha();
     void generate_by_H_is_d();
@@ -64,20 +88,23 @@ private:
     void generate_E_is_EF();
     void generate_by_T_is_TbE();
 
-    Parser_action_info state00_error_handler();
-    Parser_action_info state01_error_handler();
-    Parser_action_info state02_error_handler();
-    Parser_action_info state03_error_handler();
-    Parser_action_info state04_error_handler();
-    Parser_action_info state06_error_handler();
-    Parser_action_info state07_error_handler();
-    Parser_action_info state11_error_handler();
-    Parser_action_info state15_error_handler();
+    Action_type state00_error_handler();
+    Action_type state01_error_handler();
+    Action_type state02_error_handler();
+    Action_type state03_error_handler();
+    Action_type state04_error_handler();
+    Action_type state06_error_handler();
+    Action_type state07_error_handler();
+    Action_type state11_error_handler();
+    Action_type state15_error_handler();
 
 protected:
-    virtual void                   generate_command(Rule_type r);
-    virtual Attributes<Lexem_type> attrib_calc(Rule_type r);
-    virtual Terminal_type          lexem2terminal(const Lexem_type& l);
-    virtual Parser_action_info     error_hadling(size_t s);
+    /* Checks whether the identifier with the index act_index is a defined action. */
+    bool                           is_defined_action(size_t act_index) const;
+
+    void                           generate_command(Rule_type r);
+    Attrib_type                    attrib_calc(Rule_type r);
+    Terminal_type                  lexem2terminal(const Lexem_type& l);
+    Action_type                    error_hadling(size_t s);
 };
 #endif
\ No newline at end of file
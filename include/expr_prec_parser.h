@@ -0,0 +1,59 @@
+/*
+    File:    expr_prec_parser.h
+    Created: 19 October 2026 at 14:55 Moscow time
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+#ifndef EXPR_PREC_PARSER_H
+#define EXPR_PREC_PARSER_H
+#include <memory>
+#include <cstddef>
+#include "../include/command.h"
+#include "../include/error_count.h"
+#include "../include/expr_parser.h"
+#include "../include/expr_lr_tables.h"
+/*
+ * The parser of regular expressions by precedence climbing. The operators of
+ * regular expressions have the following levels of precedence (from the lowest):
+ *      the operator |, the concatenation, postfix operators ? * +, actions, atoms
+ * (characters, classes of characters, and expressions in parentheses). The parser
+ * builds the same commands as SLR_act_expr_parser, since it calls the same functions
+ * generating commands and calculating attributes, but it does not use the stack of
+ * states and the tables.
+ *
+ * The parser handles only correct expressions. At the first syntax error, lexical
+ * error, or undefined action, it discards the built commands and passes the read
+ * text to the SLR parser (see Expr_scaner::rescan), which parses the expression anew
+ * with error recovery and diagnostics. So every diagnostic is printed once.
+ */
+class Prec_expr_parser : public SLR_act_expr_parser{
+public:
+    Prec_expr_parser()                             = default;
+    ~Prec_expr_parser()                            = default;
+    Prec_expr_parser(const Prec_expr_parser& orig) = default;
+    Prec_expr_parser(const escaner::Expr_scaner_ptr& esc,
+                     const Errors_and_tries&         et,
+                     const std::shared_ptr<Scope>&   scope) :
+        SLR_act_expr_parser(esc, et, scope, expr_slr_tables), ec_(et.ec_) {};
+
+    void compile(Command_buffer& buf);
+private:
+    std::shared_ptr<Error_count> ec_;
+
+    /* Reads the next lexeme into li and t. Returns false, if the scaner has found
+     * an error in this lexeme. */
+    bool next();
+
+    /* Parses the expression whose binary operators have precedences not less than
+     * min_prec, starting from the current lexeme. */
+    bool parse_expr(unsigned min_prec, Attrib_type& result);
+
+    /* Parses an atom followed by an optional action and an optional postfix
+     * operator. */
+    bool parse_operand(Attrib_type& result);
+
+    Attrib_type reduce_by(Rule r, const Attrib_type* body);
+};
+#endif
@@ -11,12 +11,13 @@
 #define EXPR_SCANER_H
 #   include <string>
 #   include <memory>
-#   include <set>
+#   include <map>
 #   include "../include/expr_lexem_info.h"
 #   include "../include/location.h"
 #   include "../include/errors_and_tries.h"
 #   include "../include/error_count.h"
-#   include "../include/trie_for_set.h"
+#   include "../include/trie_for_set_of_segments.h"
+#   include "../include/operations_with_segments.h"
 #   include "../include/scope.h"
 #   include "../include/aux_expr_scaner.h"
 #   include "../include/aux_expr_lexem.h"
@@ -26,17 +27,26 @@
 namespace escaner{
     using Expr_token = ascaner::Token<Expr_lexem_info>;
 
+    /* True complements are taken with respect to the code points from 0 to this. */
+    constexpr char32_t max_code_point = 0x10FFFF;
+
     class Expr_scaner{
     public:
         Expr_scaner()                        = default;
         Expr_scaner(const Expr_scaner& orig) = default;
         ~Expr_scaner()                       = default;
 
-        Expr_scaner(const ascaner::Location_ptr&     location,
-                    const Errors_and_tries&          et,
-                    const Trie_for_set_of_char32ptr& trie_for_set,
-                    const std::shared_ptr<Scope>&    scope) :
+        /* If true_complements is true, then character class complements, [:ndq:]
+         * and [:nsq:] are returned as lexemes Character_class whose sets are the
+         * complements over all code points from 0 to 0x10FFFF. Otherwise they are
+         * returned as lexemes Class_complement containing the excluded characters. */
+        Expr_scaner(const ascaner::Location_ptr&      location,
+                    const Errors_and_tries&           et,
+                    const Trie_for_char_segments_ptr& trie_for_set,
+                    const std::shared_ptr<Scope>&     scope,
+                    bool                              true_complements = false) :
             set_trie_(trie_for_set),
+            true_complements_(true_complements),
             aux_scaner_(std::make_unique<Aux_expr_scaner>(location, et)),
             et_(et),
             loc_(location),
@@ -48,56 +58,113 @@ namespace escaner{
         std::string lexeme_to_string(const Expr_lexem_info& li);
         std::string token_to_string(const Expr_token& tok);
         void        back();
-    private:
-        Trie_for_set_of_char32ptr set_trie_;
-        Aux_expr_scaner_ptr       aux_scaner_;
-        Errors_and_tries          et_;
-        ascaner::Location_ptr     loc_;
-        std::shared_ptr<Scope>    scope_;
 
-        char32_t*                 lexeme_begin_; /* pointer to the lexem begin */
+        /* The function mark() remembers the current location in the text. The
+         * function rescan(current) returns the scaner to the remembered location;
+         * when the scaner reaches the lexeme current (the last returned lexeme)
+         * again, it returns this lexeme without scanning it. So a parser that
+         * failed can give the read part of the text to another parser; if all
+         * lexemes before current were read without errors, then no lexical
+         * diagnostic is repeated. */
+        void        mark();
+        void        rescan(const Expr_token& current);
+
+        /* Returns the location in the text at which reading of the last lexeme
+         * began, i.e. the location before the spaces preceding this lexeme. */
+        ascaner::Location read_begin() const;
+    private:
+        /* The location in the text at which reading of the last lexeme began. */
+        char32_t*                  read_begin_ = nullptr;
+        ascaner::Position          read_begin_pos_;
+
+        ascaner::Location          mark_;
+
+        /* The lexeme given to rescan, and the location after it. */
+        bool                       has_pending_ = false;
+        Expr_token                 pending_token_;
+        char32_t*                  pending_read_begin_;
+        char32_t*                  pending_lexeme_begin_;
+        ascaner::Position_range    pending_lexeme_pos_;
+        ascaner::Location          pending_end_;
+
+        Expr_token  read_lexeme();
+
+        Trie_for_char_segments_ptr set_trie_;
+        bool                       true_complements_ = false;
+        /* The mapping of the index of a set of excluded characters to the index of
+         * its complement; so every distinct complement is calculated only once. */
+        std::map<size_t, size_t>   complements_;
+        Aux_expr_scaner_ptr        aux_scaner_;
+        Errors_and_tries           et_;
+        ascaner::Location_ptr      loc_;
+        std::shared_ptr<Scope>     scope_;
+
+        char32_t*                  lexeme_begin_; /* pointer to the lexem begin */
 //         Expr_token                token_;
-        ascaner::Position_range   lexeme_pos_;
+        ascaner::Position_range    lexeme_pos_;
 
         using Aux_token = ascaner::Token<Aux_expr_lexem_info>;
 
-        Aux_token                 aeti_;
-        Aux_expr_lexem_code       aetic_;
+        Aux_token                  aeti_;
+        Aux_expr_lexem_code        aetic_;
 
         Expr_lexem_info convert_lexeme(const Aux_token&);
 
+        /* Sets the code and the index of the set of the lexeme for a class of
+         * characters from which the characters of the set excluded_idx are
+         * excluded. */
+        void set_complement(Expr_lexem_info& eli, size_t excluded_idx);
+        size_t complement_idx(size_t excluded_idx);
+
         void check_regexp_name(size_t idx);
 
         enum class State{
             Begin_class_complement, First_char,
-            Body_chars,             End_class_complement
+            Body_chars,             Char_or_range,
+            Range_hyphen,           End_class_complement
         };
 
         /*
         * The lexeme 'character class complement' can be descripted as the following
         * regular expression:
-        *          ab+c
+        *          a(b|d|dhd)+c
         * where
         *      a is the lexeme 'Begin_char_class_complement',
-        *      b is the lexeme 'Character' or 'Character class',
+        *      b is the lexeme 'Character class',
+        *      d is the lexeme 'Character',
+        *      h is the lexeme 'Character' whose value is the hyphen '-' written
+        *        without a backslash,
         *      c is the lexeme 'End_char_class_complement'.
+        * Here dhd is a range of characters, for example, a-z. Since the hyphen is a
+        * character too, the longest match is used: a hyphen after a character and
+        * before a character denotes a range, and any other hyphen denotes itself.
+        * The escaped hyphen \- is the lexeme d, so it always denotes itself.
         *
         * If we construct a non-deterministic finite automaton by this regexp, next we
         * build a corresponding deterministic finite automaton, and, finally, we
         * minimize the deterministic automaton, then we obtain a finite automaton with
         * the following transition table:
         *
-        * |-------|---|---|---|--------------|
-        * | State | a | b | c |    Remark    |
-        * |-------|---|---|---|--------------|
-        * |   A   | B |   |   | Begin state. |
-        * |-------|---|---|---|--------------|
-        * |   B   |   | C |   |              |
-        * |-------|---|---|---|--------------|
-        * |   C   |   | C | E |              |
-        * |-------|---|---|---|--------------|
-        * |   E   |   |   |   | End state.   |
-        * |-------|---|---|---|--------------|
+        * |-------|---|---|---|---|---|--------------|
+        * | State | a | b | d | h | c |    Remark    |
+        * |-------|---|---|---|---|---|--------------|
+        * |   A   | B |   |   |   |   | Begin state. |
+        * |-------|---|---|---|---|---|--------------|
+        * |   B   |   | C | D | D |   |              |
+        * |-------|---|---|---|---|---|--------------|
+        * |   C   |   | C | D | D | E |              |
+        * |-------|---|---|---|---|---|--------------|
+        * |   D   |   | C | D | F | E |              |
+        * |-------|---|---|---|---|---|--------------|
+        * |   F   |   | C | C | C | E |              |
+        * |-------|---|---|---|---|---|--------------|
+        * |   E   |   |   |   |   |   | End state.   |
+        * |-------|---|---|---|---|---|--------------|
+        *
+        * In the state D the last read character is not yet added to the set, because
+        * it may be the lower bound of a range; in the state F the same is true for
+        * the hyphen too. A range is added to the set as one segment, i.e. without
+        * enumerating its characters.
         *
         * But for ease of writing, we need to introduce more meaningful names for states
         * of a finite automaton. The following table shows the matching state names from
@@ -113,6 +180,10 @@ namespace escaner{
         * |---|------------------------|
         * | C | Body_chars             |
         * |---|------------------------|
+        * | D | Char_or_range          |
+        * |---|------------------------|
+        * | F | Range_hyphen           |
+        * |---|------------------------|
         * | E | End_class_complement   |
         * |---|------------------------|
         *
@@ -120,18 +191,25 @@ namespace escaner{
 
         State               state_;
         size_t              set_idx_ = 0;
+        char32_t            range_lower_; /* the last read character in the states
+                                           * Char_or_range and Range_hyphen */
 
         size_t get_set_complement();
 
         using State_proc = void (Expr_scaner::*)();
 
 
-        std::set<char32_t>  curr_set_;
+        operations_with_segments::Set_of_segments<char32_t> curr_set_;
+
+        /* Adds the current character class to curr_set_. Returns false if the
+         * current lexeme is not an admissible character class. */
+        bool add_class_to_curr_set();
 
         static State_proc   procs_[];
 
         void begin_class_complement_proc(); void first_char_proc();
-        void body_chars_proc();             void end_class_complement_proc();
+        void body_chars_proc();             void char_or_range_proc();
+        void range_hyphen_proc();           void end_class_complement_proc();
     };
 
     using Expr_scaner_ptr = std::shared_ptr<Expr_scaner>;
@@ -0,0 +1,119 @@
+/*
+    File:    expr_source_cache.h
+    Created: 19 October 2026 at 18:20 Moscow time
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+
+#ifndef EXPR_SOURCE_CACHE_H
+#define EXPR_SOURCE_CACHE_H
+#include <string>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <memory>
+#include "../include/location.h"
+#include "../include/errors_and_tries.h"
+#include "../include/expr_scaner.h"
+#include "../include/scope.h"
+#include "../include/command.h"
+/*
+ * The cache of sources of regular expressions compiled during a session. Generated
+ * specifications often contain the same expression in many rules, so the commands
+ * built from a source {...} are saved together with its text, and when the same text
+ * occurs again, the saved commands are appended to the buffer instead of scanning and
+ * parsing the text. Spaces before a source are not a part of it. Indices of sets of
+ * characters, actions and regexp names are the same for the same text, so only the
+ * operands of commands are renumbered.
+ *
+ * A source is searched by the hash of its text up to the first closing brace; then
+ * the whole text is compared. Only sources compiled without diagnostics are cached,
+ * so an erroneous expression is parsed, and diagnosed, every time. The names of
+ * actions and regexp names used by a cached source are checked against the scope on
+ * every reuse: if one of them has become undefined or has been redefined as another
+ * kind of identifier, the source is dropped from the cache and compiled again, so
+ * that the parser reports the error.
+ */
+class Expr_source_cache{
+public:
+    Expr_source_cache()                              = default;
+    ~Expr_source_cache()                             = default;
+    Expr_source_cache(const Expr_source_cache& orig) = default;
+    Expr_source_cache(const ascaner::Location_ptr&  loc,
+                      const Errors_and_tries&       et,
+                      const std::shared_ptr<Scope>& scope) :
+        loc_(loc), et_(et), scope_(scope) {};
+
+    /* If the text at the current location, after spaces, begins with a cached
+     * source, then appends the commands of this source to buf, moves the current
+     * location to the end of the source, and returns true. Otherwise remembers the
+     * beginning of the source, which then must be compiled into buf and passed to
+     * finish(). */
+    bool reuse(Command_buffer& buf);
+
+    /* Caches the source from the remembered beginning up to source_end, i.e. up to
+     * the location after its closing brace, and the commands appended to buf. */
+    void finish(const Command_buffer& buf, const ascaner::Location& source_end);
+private:
+    struct Source{
+        std::u32string text_;
+        /* Operands are numbered from the first command of the source. */
+        Command_buffer commands_;
+        /* The number of line feeds in the source, and the position in line after
+         * it if there are line feeds, or the increment of the position otherwise. */
+        size_t         new_lines_;
+        size_t         line_pos_;
+    };
+
+    ascaner::Location_ptr                     loc_;
+    Errors_and_tries                          et_;
+    std::shared_ptr<Scope>                    scope_;
+    std::vector<Source>                       sources_;
+    /* The indices of sources in sources_ by the hash of their beginnings. */
+    std::unordered_multimap<uint64_t, size_t> index_;
+
+    /* The beginning of the source being compiled and the state before it. */
+    ascaner::Location                         begin_;
+    uint64_t                                  begin_hash_       = 0;
+    size_t                                    begin_size_       = 0;
+    size_t                                    number_of_errors_ = 0;
+    size_t                                    number_of_diags_  = 0;
+
+    /* Checks that the names of actions and the regexp names used by the commands
+     * of src are still defined as such in the scope. */
+    bool names_are_defined(const Source& src) const;
+};
+
+/* The parser of the type Parser (SLR_act_expr_parser, Direct_expr_parser or
+ * Prec_expr_parser) that compiles every distinct source only once per session. */
+template<typename Parser>
+class Cached_expr_parser : public Parser{
+public:
+    template<typename... Args>
+    Cached_expr_parser(const ascaner::Location_ptr&    loc,
+                       const escaner::Expr_scaner_ptr& esc,
+                       const Errors_and_tries&         et,
+                       const std::shared_ptr<Scope>&   scope,
+                       Args&&...                       args) :
+        Parser(esc, et, scope, std::forward<Args>(args)...), cache_(loc, et, scope) {};
+
+    void compile(Command_buffer& buf)
+    {
+        if(cache_.reuse(buf)){
+            /* As the parser does, the lexeme after the expression is read and
+             * returned into the text. */
+            this->scaner->current_lexeme();
+            this->scaner->back();
+            return;
+        }
+        Parser::compile(buf);
+        cache_.finish(buf, this->scaner->read_begin());
+    }
+private:
+    Expr_source_cache cache_;
+};
+#endif
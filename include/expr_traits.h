@@ -31,7 +31,7 @@ enum class Terminal{
     Term_q,      Term_LP, Term_RP
 };
 
-using Expr_grammar_traits = Grammar_traits<Terminal, Non_terminal, Rule, 3>;
+using Expr_grammar_traits = Grammar_traits<Terminal, Non_terminal, Rule, 3, 9, 6>;
 
 using Expr_scaner_traits  = Scaner_traits<escaner::Expr_scaner, escaner::Expr_token>;
 #endif
\ No newline at end of file
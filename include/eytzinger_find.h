@@ -0,0 +1,173 @@
+/*
+    File:    eytzinger_find.h
+    Created: 19 October 2026 at 11:35 Moscow time
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+
+#ifndef EYTZINGER_FIND_H
+#define EYTZINGER_FIND_H
+#include <utility>
+#include <cstddef>
+#include "../include/segment.h"
+#include "../include/myconcepts.h"
+/*
+ * The search in an array of pairs (segment, value) permuted in the order of the
+ * answer to exercise 6.2.24 from the book
+ *      Knuth D.E. The art of computer programming. Volume 3. Sorting and search. ---
+ *      2nd ed. --- Addison-Wesley, 1998.
+ * The permutation (the so-called Eytzinger layout: the node k of a binary search
+ * tree has the children 2k and 2k+1) is built at compile time by the function
+ * build_eytzinger from an array of pairs sorted in ascending order of segments.
+ *
+ * The array is padded up to 2^depth - 1 elements by copies of its last element, so
+ * the tree is perfect and every search performs exactly depth iterations. The body
+ * of an iteration contains no data-dependent branches: the result of a comparison
+ * is used as an addend for the index of the next node. Since the search goes by upper
+ * bounds of segments, and the first of equal elements precedes the copies in the
+ * sorted order, the copies are never found.
+ */
+
+constexpr size_t eytzinger_depth(size_t n)
+{
+    size_t depth = 0;
+    while(((static_cast<size_t>(1) << depth) - 1) < n){
+        ++depth;
+    }
+    return depth;
+}
+
+template<typename K, typename V, size_t N>
+struct Eytzinger_table{
+    static_assert(N > 0, "The table for the search must not be empty.");
+
+    static constexpr size_t depth = eytzinger_depth(N);
+    static constexpr size_t size  = (static_cast<size_t>(1) << depth) - 1;
+
+    /* The element with the index 0 is not used, so the root has the index 1. */
+    Segment_with_value<K, V> elems[size + 1];
+};
+
+/* Checks that segments of the array a are sorted in ascending order and do not
+ * intersect. */
+template<typename K, typename V, size_t N>
+constexpr bool are_sorted_segments(const Segment_with_value<K, V> (&a)[N])
+{
+    for(size_t i = 0; i < N; ++i){
+        if(a[i].bounds.lower_bound > a[i].bounds.upper_bound){
+            return false;
+        }
+        if((i != 0) && (a[i - 1].bounds.upper_bound >= a[i].bounds.lower_bound)){
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * \brief Builds the Eytzinger layout of the array sorted.
+ * \param [in] sorted An array of pairs (segment, value) sorted in ascending order of
+ *                    segments; the segments must not intersect.
+ * \return            The table for the function eytzinger_find.
+ */
+template<typename K, typename V, size_t N>
+constexpr Eytzinger_table<K, V, N> build_eytzinger(const Segment_with_value<K, V> (&sorted)[N])
+{
+    using Table = Eytzinger_table<K, V, N>;
+    Table result{};
+    /* In a perfect tree, the node k on the level l (the root has the level 0) is the
+     * node number p = k - 2^l on its level, and its rank in the in-order traversal is
+     * (2p + 1) * 2^(depth - 1 - l) - 1. */
+    size_t level = 0;
+    for(size_t k = 1; k <= Table::size; ++k){
+        if(k == (static_cast<size_t>(2) << level)){
+            ++level;
+        }
+        size_t p    = k - (static_cast<size_t>(1) << level);
+        size_t rank = (2 * p + 1) * (static_cast<size_t>(1) << (Table::depth - 1 - level)) - 1;
+        const auto& src = sorted[(rank < N) ? rank : (N - 1)];
+        result.elems[k].bounds.lower_bound = src.bounds.lower_bound;
+        result.elems[k].bounds.upper_bound = src.bounds.upper_bound;
+        result.elems[k].value              = src.value;
+    }
+    return result;
+}
+
+/* The number of elements of the table in one cache line. When the node k is
+ * visited, the line containing its descendants from several levels below (starting
+ * from the node k * eytzinger_prefetch_step<...>) is prefetched. Near the leaves
+ * these descendants do not exist, so the index of the prefetched node is clamped
+ * to the last node: a pointer past the end of the table is never formed. */
+template<typename K, typename V>
+constexpr size_t eytzinger_prefetch_step()
+{
+    return (sizeof(Segment_with_value<K, V>) >= 64) ?
+           1 : 64 / sizeof(Segment_with_value<K, V>);
+}
+
+/**
+ * \brief Searches for the segment containing key.
+ * \param [in] t   The table built by build_eytzinger.
+ * \param [in] key The searched value.
+ * \return         The pair (true, index of the found element in t.elems), if there is
+ *                 a segment containing key, and the pair (false, ...) otherwise.
+ */
+template<typename K, typename V, size_t N>
+std::pair<bool, size_t> eytzinger_find(const Eytzinger_table<K, V, N>& t, K key)
+{
+    using Table                 = Eytzinger_table<K, V, N>;
+    constexpr size_t step       = eytzinger_prefetch_step<K, V>();
+    constexpr size_t last       = Table::size;
+    size_t           k          = 1;
+    for(size_t i = 0; i < Table::depth; ++i){
+        size_t descendant = k * step;
+        __builtin_prefetch(t.elems + ((descendant <= last) ? descendant : last));
+        k = 2 * k + (t.elems[k].bounds.upper_bound < key);
+    }
+    /* Cancel the right turns made after the last left turn. */
+    k >>= __builtin_ffsll(static_cast<long long>(~k));
+    bool found = (k != 0) & (t.elems[k].bounds.lower_bound <= key);
+    return {found, k};
+}
+
+/**
+ * \brief Searches for several keys at once. The searches go in lockstep, so the
+ *        latencies of memory accesses for different keys overlap each other; since
+ *        every search performs the same number of iterations, the inner loop can be
+ *        vectorized by the compiler (with gather instructions, where they exist).
+ * \param [in]  t       The table built by build_eytzinger.
+ * \param [in]  first   The first of searched keys.
+ * \param [in]  last    The element after the last of searched keys.
+ * \param [out] results The results of the search: results[j] is the same as
+ *                      eytzinger_find(t, first[j]).
+ */
+template<typename K, typename V, size_t N, RandomAccessIterator I, RandomAccessIterator O>
+void eytzinger_find_many(const Eytzinger_table<K, V, N>& t, I first, I last, O results)
+{
+    using Table                   = Eytzinger_table<K, V, N>;
+    constexpr size_t group_size   = 8;
+    size_t           n            = last - first;
+    for(size_t start = 0; start < n; start += group_size){
+        size_t m = ((n - start) < group_size) ? (n - start) : group_size;
+        size_t k[group_size];
+        for(size_t j = 0; j < m; ++j){
+            k[j] = 1;
+        }
+        for(size_t i = 0; i < Table::depth; ++i){
+            for(size_t j = 0; j < m; ++j){
+                K key = first[start + j];
+                k[j]  = 2 * k[j] + (t.elems[k[j]].bounds.upper_bound < key);
+            }
+        }
+        for(size_t j = 0; j < m; ++j){
+            K      key = first[start + j];
+            size_t idx = k[j] >> __builtin_ffsll(static_cast<long long>(~k[j]));
+            results[start + j] = std::make_pair(static_cast<bool>((idx != 0) &
+                                                    (t.elems[idx].bounds.lower_bound <= key)),
+                                                idx);
+        }
+    }
+}
+#endif
@@ -11,7 +11,6 @@
 #define LR_PARSER_H
 
 #include <memory>
-#include <map>
 #include <utility>
 #include <cstddef>
 #include "../include/myconcepts.h"
@@ -19,145 +18,254 @@
 #include "../include/types_for_lr_tables.h"
 #include "../include/lr_traits.h"
 
-template<typename G, typename S, typename Container>
-class LR_parser{
+/*
+ * The driver of an LR parser. The hooks of a concrete parser (generate_command,
+ * attrib_calc, lexem2terminal, error_hadling) are functions of the class D derived
+ * from Basic_LR_parser<D, G, S, Container>; they are called without virtual
+ * dispatch, so they can be inlined into the driver. The class D must make
+ * Basic_LR_parser<D, G, S, Container> its friend, if its hooks are not public.
+ */
+template<typename D, typename G, typename S, typename Container>
+class Basic_LR_parser{
 public:
     using Lexem_type        = typename S::Lexem_t;
     using Non_terminal_type = typename G::Non_terminal_t;
     using Terminal_type     = typename G::Terminal_t;
     using Scaner_type       = typename S::Scaner_t;
+    using Action_type       = typename G::Action_info_t;
+    using State_type        = typename G::State_t;
 
-    LR_parser<G, S, Container>()                                       = default;
-    LR_parser<G, S, Container>(const LR_parser<G, S, Container>& orig) = default;
+    Basic_LR_parser<D, G, S, Container>()                               = default;
+    Basic_LR_parser<D, G, S, Container>(const Basic_LR_parser& orig)    = default;
 
-    LR_parser<G, S, Container>(const std::shared_ptr<Scaner_type>& scaner_,
-                               const LR_parser_tables<G>&       tables) :
+    Basic_LR_parser<D, G, S, Container>(const std::shared_ptr<Scaner_type>& scaner_,
+                                        const LR_parser_tables<G>&          tables) :
         scaner(scaner_)
     {
         rules        = tables.rules;
         goto_table   = tables.goto_table;
         action_table = tables.action_table;
+        default_actions = tables.default_actions;
     }
 
-    virtual ~LR_parser<G, S, Container>()                              = default;
+    ~Basic_LR_parser<D, G, S, Container>()                              = default;
 
     void compile(Container& buf);
 
 protected:
     using Rule_type         = typename G::Rule_t;
-    using SE                = Stack_elem<Lexem_type>;
+    using Attrib_type       = Attributes<typename S::Lexem_value_t>;
 
     size_t                              current_state;
     Lexem_type                          li;
     Terminal_type                       t;
-    Multipop_stack<SE>                  parser_stack;
+    Multipop_stack<State_type>          state_stack;
+    Multipop_stack<Attrib_type>         attrib_stack;
     std::shared_ptr<Scaner_type>        scaner;
-    SE                                  rule_body[G::rule_max_len];
-    Container                           buf_;
+    /* The attributes of the body of the reduced rule; they are not copied, but
+     * point into attrib_stack. */
+    const Attrib_type*                  rule_body = nullptr;
+    /* The buffer of the caller of compile(): commands are appended to it directly.
+     * Since an action is written into commands generated earlier, Container must
+     * provide not only push_back(), but also size() and operator[]. */
+    Container*                          buf_      = nullptr;
 
-    virtual void                   generate_command(Rule_type r)       = 0;
-    virtual Attributes<Lexem_type> attrib_calc(Rule_type r)            = 0;
-    virtual Terminal_type          lexem2terminal(const Lexem_type& l) = 0;
-    virtual Parser_action_info     error_hadling(size_t s)             = 0;
+    /* The buffer for one lexeme of lookahead. A lexeme taken from the scaner is
+     * kept here until it is shifted, so it is read from the text only once, no
+     * matter how many reductions precede its shift. */
+    Lexem_type                          lookahead_;
+    bool                                has_lookahead_ = false;
+
+    /* Returns the current lexeme li into the buffer of lookahead, so the next
+     * iteration of the parser reads it again. Error handlers call this function
+     * when they insert a missing lexeme before li. */
+    void return_lookahead()
+    {
+        has_lookahead_ = true;
+    }
+
+    /* The steps of the parser. The function compile() is written with them, and so
+     * is the generated compile() of a direct-coded parser derived from D. */
+
+    /* Prepares the stacks for parsing into the buffer buf. */
+    void start(Container& buf);
+    /* Takes the next lexeme into li, and its terminal into t. */
+    void read_lexeme();
+    /* Pushes the state shifted_state and the attribute of li. */
+    void shift_to(size_t shifted_state);
+    /* Replaces the attributes of the body of the rule r, which has the length
+     * rule_len, by the attribute of its left side; the states of the body are
+     * popped, and the state after the reduction must be pushed by the caller. */
+    void reduce_by(Rule_type r, size_t rule_len);
+    /* Returns the last read lexeme into the text: the text after the expression is
+     * processed by another scaner. */
+    void finish()
+    {
+        scaner->back();
+    }
 
 private:
-    void shift(size_t shifted_state, Lexem_type e);
+    D& derived()
+    {
+        return static_cast<D&>(*this);
+    }
+
     void reduce_without_back(Rule_type r);
     void reduce(Rule_type r);
 
-    Rule_info<Non_terminal_type>*       rules;
-    GOTO_entry**                        goto_table;
-    Parser_action_table<Terminal_type>* action_table;
+    /* The stack grows beyond this depth only for deeply nested expressions. */
+    static constexpr size_t initial_stack_capacity = 64;
+
+    const Rule_info<Non_terminal_type>*    rules;
+    LR_table<State_type, State_type>       goto_table;
+    LR_table<Action_type, State_type>      action_table;
+    const Action_type*                     default_actions;
 
     size_t next_state(size_t s, Non_terminal_type n);
 };
 
-template<typename G, typename S, typename Container>
-size_t LR_parser<G, S, Container>::next_state(size_t s, Non_terminal_type n)
+template<typename D, typename G, typename S, typename Container>
+size_t Basic_LR_parser<D, G, S, Container>::next_state(size_t s, Non_terminal_type n)
 {
-    size_t cs;
-    GOTO_entry  current_entry;
-    GOTO_entry* goto_for_n = goto_table[static_cast<size_t>(n)];
-    while((cs = (current_entry = *goto_for_n++).from) != ANY){
-        if(cs == s){
-            return current_entry.to;
-        }
-    }
-    goto_for_n--;
-    return goto_for_n -> to;
+    return lr_table_entry<G::table_layout, G::number_of_non_terminals>(
+        goto_table, s, static_cast<size_t>(n), State_type()
+    );
 }
 
-template<typename G, typename S, typename Container>
-void LR_parser<G, S, Container>::shift(size_t shifted_state, Lexem_type e)
+template<typename D, typename G, typename S, typename Container>
+void Basic_LR_parser<D, G, S, Container>::start(Container& buf)
 {
-    SE selem;
-    selem.st_num  = shifted_state;
-    selem.attr.li = e;
-    parser_stack.push(selem);
+    buf_ = &buf;
+
+    state_stack.clear();
+    attrib_stack.clear();
+    state_stack.reserve(initial_stack_capacity);
+    attrib_stack.reserve(initial_stack_capacity);
+
+    Attrib_type initial_attr;
+    initial_attr.indeces.begin_index = 0;
+    initial_attr.indeces.end_index   = 0;
+    state_stack.push(0);
+    attrib_stack.push(initial_attr);
+    has_lookahead_ = false;
 }
 
-template<typename G, typename S, typename Container>
-void LR_parser<G, S, Container>::reduce_without_back(Rule_type r)
+template<typename D, typename G, typename S, typename Container>
+void Basic_LR_parser<D, G, S, Container>::read_lexeme()
 {
-    auto   r_info   = rules[static_cast<size_t>(r)];
-    size_t rule_len = r_info.len;
-    parser_stack.get_elems_from_top(rule_body, rule_len);
-    generate_command(r);
-
-    SE se;
-    se.attr         = attrib_calc(r);
-    parser_stack.multi_pop(rule_len);
-    SE top_elem     = parser_stack.top();
-    se.st_num       = next_state(top_elem.st_num, r_info.nt);
-    parser_stack.push(se);
+    if(!has_lookahead_){
+        lookahead_ = scaner->current_lexeme();
+    }
+    has_lookahead_ = false;
+    li             = lookahead_;
+    t              = derived().lexem2terminal(li);
 }
 
-template<typename G, typename S, typename Container>
-void LR_parser<G, S, Container>::reduce(Rule_type r)
+template<typename D, typename G, typename S, typename Container>
+void Basic_LR_parser<D, G, S, Container>::shift_to(size_t shifted_state)
 {
-    reduce_without_back(r);
-    scaner->back();
+    Attrib_type a;
+    a.li = li.lexeme_;
+    state_stack.push(static_cast<State_type>(shifted_state));
+    attrib_stack.push(a);
 }
 
-template<typename G, typename S, typename Container>
-void LR_parser<G, S, Container>::compile(Container& buf)
+template<typename D, typename G, typename S, typename Container>
+void Basic_LR_parser<D, G, S, Container>::reduce_by(Rule_type r, size_t rule_len)
 {
-    buf_ = buf;
+    rule_body     = attrib_stack.elems_from_top(rule_len);
+    derived().generate_command(r);
+
+    Attrib_type a = derived().attrib_calc(r);
+    attrib_stack.multi_pop(rule_len);
+    state_stack.multi_pop(rule_len);
+    attrib_stack.push(a);
+}
 
-    parser_stack.clear();
+template<typename D, typename G, typename S, typename Container>
+void Basic_LR_parser<D, G, S, Container>::reduce_without_back(Rule_type r)
+{
+    auto r_info = rules[static_cast<size_t>(r)];
+    reduce_by(r, r_info.len);
+    state_stack.push(static_cast<State_type>(next_state(state_stack.top(), r_info.nt)));
+}
+
+template<typename D, typename G, typename S, typename Container>
+void Basic_LR_parser<D, G, S, Container>::reduce(Rule_type r)
+{
+    reduce_without_back(r);
+    return_lookahead();
+}
 
-    SE initial_elem;
-    initial_elem.st_num                   = 0;
-    initial_elem.attr.indeces.begin_index = 0;
-    initial_elem.attr.indeces.end_index   = 0;
-    parser_stack.push(initial_elem);
+template<typename D, typename G, typename S, typename Container>
+void Basic_LR_parser<D, G, S, Container>::compile(Container& buf)
+{
+    start(buf);
 
     for( ; ; ){
-        li = scaner->current_lexem();
-        t = lexem2terminal(li);
-        current_state = parser_stack.top().st_num;
-        auto it = action_table->find({current_state, t});
-        Parser_action_info pai;
-        if(it != action_table->end()){
-            pai = it->second;
-        }else{
-            pai = error_hadling(current_state);
+        current_state = state_stack.top();
+        Action_type da = default_actions[current_state];
+        if(static_cast<Parser_action_name>(da.kind) == Parser_action_name::Reduce){
+            /* The lookahead is not needed, so it is not read. */
+            reduce_without_back(static_cast<Rule_type>(da.arg));
+            continue;
+        }
+        read_lexeme();
+        static constexpr Action_type error_action = ERR;
+        Action_type pai = lr_table_entry<G::table_layout, G::number_of_terminals>(
+            action_table, current_state, static_cast<size_t>(t), error_action
+        );
+        if(static_cast<Parser_action_name>(pai.kind) == Parser_action_name::Error){
+            pai = derived().error_hadling(current_state);
         }
         switch(static_cast<Parser_action_name>(pai.kind)){
             case Parser_action_name::Reduce:
                 reduce(static_cast<Rule_type>(pai.arg));
                 break;
             case Parser_action_name::Shift:
-                shift(pai.arg, li);
+                shift_to(pai.arg);
                 break;
             case Parser_action_name::Reduce_without_back:
                 reduce_without_back(static_cast<Rule_type>(pai.arg));
                 break;
             case Parser_action_name::OK:
-                buf = buf_;
-                scaner->back();
+                finish();
                 return;
+            case Parser_action_name::Error:
+                /* Error handlers never return this action. */
+                break;
         }
     }
 }
+
+/* The driver whose hooks are virtual functions; a concrete parser is derived from
+ * LR_parser<G, S, Container> and overrides them. */
+template<typename G, typename S, typename Container>
+class LR_parser : public Basic_LR_parser<LR_parser<G, S, Container>, G, S, Container>{
+    using Base = Basic_LR_parser<LR_parser<G, S, Container>, G, S, Container>;
+    friend Base;
+public:
+    using typename Base::Lexem_type;
+    using typename Base::Terminal_type;
+    using typename Base::Scaner_type;
+    using typename Base::Action_type;
+
+    LR_parser<G, S, Container>()                                       = default;
+    LR_parser<G, S, Container>(const LR_parser<G, S, Container>& orig) = default;
+
+    LR_parser<G, S, Container>(const std::shared_ptr<Scaner_type>& scaner_,
+                               const LR_parser_tables<G>&          tables) :
+        Base(scaner_, tables) {}
+
+    virtual ~LR_parser<G, S, Container>()                              = default;
+
+protected:
+    using typename Base::Rule_type;
+    using typename Base::Attrib_type;
+
+    virtual void                   generate_command(Rule_type r)       = 0;
+    virtual Attrib_type            attrib_calc(Rule_type r)            = 0;
+    virtual Terminal_type          lexem2terminal(const Lexem_type& l) = 0;
+    virtual Action_type            error_hadling(size_t s)             = 0;
+};
 #endif
\ No newline at end of file
@@ -9,11 +9,19 @@
 
 #ifndef LR_TRAITS_H
 #define LR_TRAITS_H
+#include <cstddef>
+#include <cstdint>
 #include "../include/myconcepts.h"
-template<typename Lexem_type>
+#include "../include/types_for_lr_tables.h"
+/* Attributes of a grammar symbol: a terminal has the value of its lexeme (without
+ * the position of the lexeme in the text), and a non-terminal has the range of
+ * indices of its commands. The parser keeps states and attributes in separate
+ * stacks, so the stack of states, which is used on every step of the parser, is
+ * compact. */
+template<typename Lexem_value_type>
 struct Attributes{
-    Lexem_type li;
     union{
+        Lexem_value_type li;
         struct{
             size_t begin_index;
             size_t end_index;
@@ -21,25 +29,27 @@ struct Attributes{
     };
 };
 
-template<typename Lexem_type>
-struct Stack_elem{
-    //! State number of the SLR(1)-parser.
-    size_t                 st_num;
-    //! Attributes of the grammar symbol corresponding to the state.
-    Attributes<Lexem_type> attr;
-};
-
-template<Integral T, Integral NT, typename R, size_t N>
+/* The parameters L, A, and St are the layout of tables, the type of actions and the
+ * type of states; they must be the same as ones used by tools/gen_lr_tables.py. */
+template<Integral T, Integral NT, typename R, size_t N, size_t M, size_t K,
+         Table_layout L = Table_layout::Dense, typename A = Parser_action_info,
+         Integral St = uint8_t>
 struct Grammar_traits{
-    using Terminal_t                 = T;
-    using Non_terminal_t             = NT;
-    using Rule_t                     = R;
-    static const size_t rule_max_len = N;
+    using Terminal_t                              = T;
+    using Non_terminal_t                          = NT;
+    using Rule_t                                  = R;
+    using Action_info_t                           = A;
+    using State_t                                 = St;
+    static const size_t       rule_max_len            = N;
+    static const size_t       number_of_terminals     = M;
+    static const size_t       number_of_non_terminals = K;
+    static const Table_layout table_layout            = L;
 };
 
 template<typename S, typename Lexem_type>
 struct Scaner_traits{
     using Scaner_t                   = S;
     using Lexem_t                    = Lexem_type;
+    using Lexem_value_t              = decltype(Lexem_type::lexeme_);
 };
 #endif
\ No newline at end of file
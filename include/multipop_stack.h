@@ -12,29 +12,62 @@
 
 #include <vector>
 #include <cstdio>
+#include <cstddef>
 
+/*
+ * A stack with the removal of several elements at once. Removed elements are not
+ * destroyed: the storage keeps them and is reused by subsequent pushes, so that
+ * multi_pop only moves the top, and after the stack has reached its maximal depth
+ * pushes do not allocate memory.
+ */
 template<typename T>
 class Multipop_stack {
 public:
     Multipop_stack()                           = default;
     Multipop_stack(const Multipop_stack& orig) = default;
     ~Multipop_stack()                          = default;
-    T    top();
+
+    /* Creates an empty stack with the storage for capacity elements. */
+    explicit Multipop_stack(size_t capacity);
+
+    T&       top();
+    const T& top() const;
     void pop();
     void push(const T& elem);
     void get_elems_from_top(T result[], size_t number_of_elems) const;
+
+    /* Returns the pointer to the first of number_of_elems elements from the top,
+     * i.e. the elements from the top are available without copying as
+     * p[0], ..., p[number_of_elems - 1]. The pointer is valid until the next push. */
+    const T* elems_from_top(size_t number_of_elems) const;
+
     void multi_pop(size_t number_of_elems);
     bool empty() const;
     size_t size() const;
     void print(void (*print_elem)(const T&)) const;
     void clear();
+    void reserve(size_t capacity);
 private:
     std::vector<T> s;
+    /* The number of elements in the stack; the elements of s with indices from
+     * top_index onwards are the storage for the next pushes. */
     size_t         top_index = 0;
 };
 
 template<typename T>
-T Multipop_stack<T>::top()
+Multipop_stack<T>::Multipop_stack(size_t capacity)
+{
+    s.reserve(capacity);
+}
+
+template<typename T>
+T& Multipop_stack<T>::top()
+{
+    return s[top_index - 1];
+}
+
+template<typename T>
+const T& Multipop_stack<T>::top() const
 {
     return s[top_index - 1];
 }
@@ -42,7 +75,6 @@ T Multipop_stack<T>::top()
 template<typename T>
 void Multipop_stack<T>::pop()
 {
-    s.pop_back();
     if(top_index != 0){top_index--;};
     return;
 }
@@ -50,7 +82,11 @@ void Multipop_stack<T>::pop()
 template<typename T>
 void Multipop_stack<T>::push(const T& elem)
 {
-    s.push_back(elem);
+    if(top_index < s.size()){
+        s[top_index] = elem;
+    }else{
+        s.push_back(elem);
+    }
     top_index++;
     return;
 }
@@ -67,10 +103,15 @@ void Multipop_stack<T>::get_elems_from_top(T result[], size_t number_of_elems) c
     return;
 }
 
+template<typename T>
+const T* Multipop_stack<T>::elems_from_top(size_t number_of_elems) const
+{
+    return s.data() + (top_index - number_of_elems);
+}
+
 template<typename T>
 void Multipop_stack<T>::multi_pop(size_t number_of_elems)
 {
-    s.erase(s.end() - number_of_elems,  s.end());
     if(top_index >= number_of_elems){
         top_index -= number_of_elems;
     }
@@ -95,16 +136,20 @@ size_t Multipop_stack<T>::size() const
 template<typename T>
 void Multipop_stack<T>::print(void (*print_elem)(const T&)) const
 {
-    for(const T& e : s){
-        print_elem(e); putchar(' ');
+    for(size_t i = 0; i < top_index; i++){
+        print_elem(s[i]); putchar(' ');
     }
 }
 
-
 template<typename T>
 void Multipop_stack<T>::clear()
 {
-    s.clear();
     top_index = 0;
 }
-#endif
\ No newline at end of file
+
+template<typename T>
+void Multipop_stack<T>::reserve(size_t capacity)
+{
+    s.reserve(capacity);
+}
+#endif
@@ -0,0 +1,269 @@
+/*
+    File:    operations_with_segments.h
+    Created: 19 October 2026 at 10:20 Moscow time
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+
+#ifndef OPERATIONS_WITH_SEGMENTS_H
+#define OPERATIONS_WITH_SEGMENTS_H
+
+#include <set>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cstddef>
+#include "../include/segment.h"
+/**
+ * \brief In this file, set-theoretic operations with sets represented as sets of
+ *        segments are defined. Such a representation is needed for sets of
+ *        characters like Unicode general categories: the set of all letters contains
+ *        more than 100000 characters, but only several hundred segments.
+ *
+ *        A value of the type Set_of_segments<T> is always kept in the canonical
+ *        form: the segments are sorted in ascending order of their lower bounds,
+ *        and any two segments neither intersect nor adjoin each other. Therefore two
+ *        sets are equal if and only if their representations are equal.
+ */
+namespace operations_with_segments{
+    template<typename T>
+    using Set_of_segments = std::vector<Segment<T>>;
+
+    template<typename T>
+    Segment<T> make_segment(T lower, T upper)
+    {
+        Segment<T> s;
+        s.lower_bound = lower;
+        s.upper_bound = upper;
+        return s;
+    }
+
+    /**
+     *  \brief Reduces a set of segments to the canonical form.
+     *  \param [in,out] a The processed set of segments.
+     */
+    template<typename T>
+    void canonize(Set_of_segments<T>& a)
+    {
+        if(a.empty()){
+            return;
+        }
+        std::sort(a.begin(), a.end(), [](const Segment<T>& x, const Segment<T>& y){
+                                          return x.lower_bound < y.lower_bound;
+                                      });
+        size_t last = 0;
+        for(size_t i = 1; i < a.size(); ++i){
+            auto& curr = a[last];
+            if((curr.upper_bound >= a[i].lower_bound) ||
+               (curr.upper_bound + 1 == a[i].lower_bound))
+            {
+                curr.upper_bound = std::max(curr.upper_bound, a[i].upper_bound);
+            }else{
+                a[++last] = a[i];
+            }
+        }
+        a.resize(last + 1);
+    }
+
+    /**
+     *  \brief Builds the representation of a set as a set of segments from an
+     *         ordinary set.
+     *  \param [in] a The set a.
+     *  \return       The same set, but as a set of segments.
+     */
+    template<typename T>
+    Set_of_segments<T> from_set(const std::set<T>& a)
+    {
+        Set_of_segments<T> result;
+        for(const auto& x : a){
+            if(!result.empty() && (result.back().upper_bound + 1 == x)){
+                result.back().upper_bound = x;
+            }else{
+                result.push_back(make_segment(x, x));
+            }
+        }
+        return result;
+    }
+
+    /**
+     *  \brief Builds a set of segments from an array of segments that is already
+     *         in the canonical form, for example, from a generated table.
+     *  \param [in] first A pointer to the first segment of the array.
+     *  \param [in] n     The number of segments in the array.
+     *  \return           The corresponding set of segments.
+     */
+    template<typename T>
+    Set_of_segments<T> from_array(const Segment<T>* first, size_t n)
+    {
+        return Set_of_segments<T>(first, first + n);
+    }
+
+    /**
+     *  \brief The union of the sets a and b.
+     *  \param [in] a The set a.
+     *  \param [in] b The set b.
+     *  \return       The union of the sets a and b.
+     */
+    template<typename T>
+    Set_of_segments<T> operator + (const Set_of_segments<T>& a, const Set_of_segments<T>& b)
+    {
+        Set_of_segments<T> result;
+        result.reserve(a.size() + b.size());
+        auto i = a.begin();
+        auto j = b.begin();
+        while((i != a.end()) || (j != b.end())){
+            const Segment<T>& s = ((j == b.end()) ||
+                                   ((i != a.end()) && (i->lower_bound <= j->lower_bound))) ?
+                                  *i++ : *j++;
+            if(!result.empty() && ((result.back().upper_bound >= s.lower_bound) ||
+                                   (result.back().upper_bound + 1 == s.lower_bound)))
+            {
+                result.back().upper_bound = std::max(result.back().upper_bound,
+                                                     s.upper_bound);
+            }else{
+                result.push_back(s);
+            }
+        }
+        return result;
+    }
+
+    /**
+     *  \brief The complement of the set a with respect to the segment [lower, upper],
+     *         i.e. the set of those elements of [lower, upper] that do not belong
+     *         to a. The complexity is O(number of segments of a).
+     *  \param [in] a     The set a.
+     *  \param [in] lower The lower bound of the universal set.
+     *  \param [in] upper The upper bound of the universal set.
+     *  \return           The complement of the set a.
+     */
+    template<typename T>
+    Set_of_segments<T> complement(const Set_of_segments<T>& a, T lower, T upper)
+    {
+        Set_of_segments<T> result;
+        result.reserve(a.size() + 1);
+        T    next     = lower; /* the least element that may belong to the result */
+        bool finished = false;
+        for(const auto& s : a){
+            if(s.upper_bound < lower){
+                continue;
+            }
+            if(s.lower_bound > upper){
+                break;
+            }
+            if(next < s.lower_bound){
+                result.push_back(make_segment(next, static_cast<T>(s.lower_bound - 1)));
+            }
+            if(s.upper_bound >= upper){
+                finished = true;
+                break;
+            }
+            next = s.upper_bound + 1;
+        }
+        if(!finished){
+            result.push_back(make_segment(next, upper));
+        }
+        return result;
+    }
+
+    /**
+     *  \brief Adds the segment [lower, upper] to the set a. The segments of a that
+     *         intersect or adjoin the added segment are merged with it, so the cost
+     *         does not depend on the number of elements in the added segment.
+     *  \param [in,out] a     The set a.
+     *  \param [in]     lower The lower bound of the added segment.
+     *  \param [in]     upper The upper bound of the added segment.
+     */
+    template<typename T>
+    void add_segment(Set_of_segments<T>& a, T lower, T upper)
+    {
+        /* first is the first segment that is not to the left of [lower, upper]
+         * and does not adjoin it. */
+        auto first = std::lower_bound(a.begin(), a.end(), lower,
+                                      [](const Segment<T>& s, const T& x){
+                                          return s.upper_bound + 1 < x;
+                                      });
+        auto last  = first;
+        while((last != a.end()) && (last->lower_bound <= upper + 1)){
+            lower = std::min(lower, last->lower_bound);
+            upper = std::max(upper, last->upper_bound);
+            ++last;
+        }
+        if(first == last){
+            a.insert(first, make_segment(lower, upper));
+        }else{
+            *first = make_segment(lower, upper);
+            a.erase(first + 1, last);
+        }
+    }
+
+    /**
+     *  \brief Adds the element x to the set a.
+     *  \param [in,out] a The set a.
+     *  \param [in]     x The added element.
+     */
+    template<typename T>
+    void add_elem(Set_of_segments<T>& a, T x)
+    {
+        add_segment(a, x, x);
+    }
+
+    /**
+     *  \brief Checking the membership of x for a set a. The complexity is
+     *         O(log(number of segments)).
+     *  \param [in] a The set a.
+     *  \param [in] x The element x.
+     *  \return       true if the element x belongs to the set a, and false otherwise
+     */
+    template<typename T>
+    bool is_elem(const T& x, const Set_of_segments<T>& a)
+    {
+        auto it = std::upper_bound(a.begin(), a.end(), x,
+                                   [](const T& y, const Segment<T>& s){
+                                       return y < s.lower_bound;
+                                   });
+        return (it != a.begin()) && (x <= (--it)->upper_bound);
+    }
+
+    /**
+     *  \brief Calculates the number of elements of the set a.
+     *  \param [in] a The set a.
+     *  \return       The number of elements of the set a.
+     */
+    template<typename T>
+    size_t cardinality(const Set_of_segments<T>& a)
+    {
+        size_t result = 0;
+        for(const auto& s : a){
+            result += static_cast<size_t>(s.upper_bound - s.lower_bound) + 1;
+        }
+        return result;
+    }
+
+    /**
+     *  \brief Converting a set of segments into an std::string.
+     *  \param [in] a          Converted set.
+     *  \param [in] show_elem  Function of a conversion of the set element.
+     */
+    template<typename T>
+    std::string show_set(const Set_of_segments<T>& a, std::string (*show_elem)(const T))
+    {
+        std::string result = "{";
+        bool        first  = true;
+        for(const auto& s : a){
+            if(!first){
+                result += ',';
+            }
+            first   = false;
+            result += show_elem(s.lower_bound);
+            if(s.lower_bound != s.upper_bound){
+                result += '-';
+                result += show_elem(s.upper_bound);
+            }
+        }
+        result += '}';
+        return result;
+    }
+};
+#endif
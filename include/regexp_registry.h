@@ -0,0 +1,51 @@
+/*
+    File:    regexp_registry.h
+    Created: 19 October 2026 at 17:45 Moscow time
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+
+#ifndef REGEXP_REGISTRY_H
+#define REGEXP_REGISTRY_H
+#include <map>
+#include <vector>
+#include <cstddef>
+#include "../include/command.h"
+/*
+ * The registry of compiled named regexps. The commands of every named regexp are
+ * kept here once, under the index of its name in the prefix tree of identifiers;
+ * a reference %name is compiled into one command Regexp_name, i.e. into a link to
+ * these commands. Links are replaced by the commands of regexps only by the
+ * function expand(), that is, when an automaton is built.
+ */
+class Regexp_registry{
+public:
+    Regexp_registry()                             = default;
+    ~Regexp_registry()                            = default;
+    Regexp_registry(const Regexp_registry& orig)  = default;
+
+    /* Saves the commands of the regexp whose name has the index name_idx. The
+     * regexp must be compiled into a separate buffer, so its last command is its
+     * root. */
+    void add(size_t name_idx, Command_buffer&& body);
+
+    /* Returns the commands of the regexp whose name has the index name_idx, or
+     * nullptr, if there is no such regexp. */
+    const Command_buffer* find(size_t name_idx) const;
+
+    /* Builds the commands of buf in which every link to a registered regexp is
+     * replaced by the commands of this regexp; links inside regexps are replaced
+     * too. A non-zero action of a link replaces the action of the root of the
+     * regexp. A link to an unregistered regexp, or a link to a regexp from its own
+     * commands, remains in the result. */
+    Command_buffer expand(const Command_buffer& buf) const;
+private:
+    std::map<size_t, Command_buffer> bodies_;
+
+    void append_expanded(const Command_buffer& buf,
+                         Command_buffer&       result,
+                         std::vector<size_t>&  expanded_names) const;
+};
+#endif
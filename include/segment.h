@@ -0,0 +1,35 @@
+/*
+    File:    segment.h
+    Created: 19 October 2026 at 10:12 Moscow time
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+
+#ifndef SEGMENT_H
+#define SEGMENT_H
+/* A segment [lower_bound, upper_bound] of values of an ordered type T. Segments
+ * are used both in the search tables (see eytzinger_find.h) and in the
+ * representation of sets of characters as sets of segments (see
+ * operations_with_segments.h). */
+template<typename T>
+struct Segment{
+    T lower_bound;
+    T upper_bound;
+
+    Segment()               = default;
+    Segment(const Segment&) = default;
+    ~Segment()              = default;
+};
+
+template<typename T, typename V>
+struct Segment_with_value{
+    Segment<T> bounds;
+    V          value;
+
+    Segment_with_value()                          = default;
+    Segment_with_value(const Segment_with_value&) = default;
+    ~Segment_with_value()                         = default;
+};
+#endif
@@ -8,6 +8,17 @@
 */
 #ifndef SETS_FOR_CLASSES_H
 #define SETS_FOR_CLASSES_H
-#   include <set>
-extern const std::set<char32_t> sets_for_char_classes[];
-#endif
\ No newline at end of file
+#   include <cstddef>
+#   include "../include/segment.h"
+/* A set of characters of a predefined character class as an array of segments in
+ * the canonical form (see operations_with_segments.h). The tables are constant data,
+ * so they require neither dynamic initialization nor the heap. */
+struct Set_for_class{
+    const Segment<char32_t>* segments_;
+    size_t                   number_of_segments_;
+};
+
+/* Sets for classes from [:Latin:] to [:nsq:], in the order of the corresponding
+ * codes of Aux_expr_lexem_code. Sets for [:ndq:] and [:nsq:] are empty. */
+extern const Set_for_class sets_for_char_classes[];
+#endif
@@ -0,0 +1,98 @@
+/*
+    File:    trie_for_set_of_segments.h
+    Created: 19 October 2026 at 10:41 Moscow time
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+#ifndef TRIE_FOR_SET_OF_SEGMENTS_H
+#define TRIE_FOR_SET_OF_SEGMENTS_H
+
+#include <set>
+#include <string>
+#include <memory>
+#include <cstddef>
+#include "../include/trie.h"
+#include "../include/segment.h"
+#include "../include/operations_with_segments.h"
+
+/* A prefix tree for sets represented as sets of segments. A set in the canonical form
+ * (see operations_with_segments.h) is written into the tree as the string
+ *      lower_bound_0 upper_bound_0 lower_bound_1 upper_bound_1 ...
+ * so the memory consumed by a set is proportional to the number of its segments, not
+ * to the number of its elements. Equal sets have equal indices. */
+template<typename T>
+class Trie_for_set_of_segments : public Trie<T>{
+public:
+    using Set_type = operations_with_segments::Set_of_segments<T>;
+
+    virtual ~Trie_for_set_of_segments<T>() { };
+    Trie_for_set_of_segments<T>()                                        = default;
+    Trie_for_set_of_segments<T>(const Trie_for_set_of_segments<T>& orig) = default;
+
+    /**
+     *  \brief The function get_set on the index idx of the set builds the same set,
+     *         but already as a set of segments.
+     *  \param [in] idx The index of the set in the prefix tree of such sets.
+     *  \return         The same set, but already as a set of segments.
+     */
+    Set_type get_set(size_t idx);
+
+    /**
+     *  \brief Inserts a set given by an array of segments in the canonical form.
+     *  \param [in] first A pointer to the first segment of the array.
+     *  \param [in] n     The number of segments in the array.
+     *  \return           The index of the set in the prefix tree.
+     */
+    size_t insert_segments(const Segment<T>* first, size_t n);
+
+    size_t insertSet(const Set_type& s);
+    size_t insertSet(const std::set<T>& s);
+};
+
+template<typename T>
+typename Trie_for_set_of_segments<T>::Set_type Trie_for_set_of_segments<T>::get_set(size_t idx)
+{
+    auto&    buf     = Trie<T>::node_buffer;
+    size_t   len     = buf[idx].path_len;
+    Set_type s(len / 2);
+    size_t   current = idx;
+    for(size_t i = len; current; current = buf[current].parent){
+        --i;
+        if(i & 1){
+            s[i / 2].upper_bound = buf[current].c;
+        }else{
+            s[i / 2].lower_bound = buf[current].c;
+        }
+    }
+    return s;
+}
+
+template<typename T>
+size_t Trie_for_set_of_segments<T>::insert_segments(const Segment<T>* first, size_t n)
+{
+    std::basic_string<T> str;
+    str.reserve(2 * n);
+    for(size_t i = 0; i < n; ++i){
+        str += first[i].lower_bound;
+        str += first[i].upper_bound;
+    }
+    return this->insert(str);
+}
+
+template<typename T>
+size_t Trie_for_set_of_segments<T>::insertSet(const Set_type& s)
+{
+    return insert_segments(s.data(), s.size());
+}
+
+template<typename T>
+size_t Trie_for_set_of_segments<T>::insertSet(const std::set<T>& s)
+{
+    return insertSet(operations_with_segments::from_set(s));
+}
+
+using Trie_for_char_segments     = Trie_for_set_of_segments<char32_t>;
+using Trie_for_char_segments_ptr = std::shared_ptr<Trie_for_char_segments>;
+#endif
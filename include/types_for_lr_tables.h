@@ -9,9 +9,8 @@
 
 #ifndef TYPES_FOR_LR_TABLES_H
 #define TYPES_FOR_LR_TABLES_H
-#include <map>
-#include <utility>
 #include <cstddef>
+#include <cstdint>
 
 template<typename NT>
 struct Rule_info{
@@ -19,16 +18,10 @@ struct Rule_info{
     uint8_t len; /* rule length */
 };
 
-#define ANY ((uint8_t)(-1))
-
-struct GOTO_entry{
-    uint8_t from;
-    uint8_t to;
-};
-
-
+/* The action Error means that the error handler of the current state must be called;
+ * error handlers return one of the other actions. */
 enum class Parser_action_name{
-    OK, Shift, Reduce, Reduce_without_back
+    OK, Shift, Reduce, Reduce_without_back, Error
 };
 
 struct Parser_action_info{
@@ -36,22 +29,65 @@ struct Parser_action_info{
     uint16_t arg  : 13;
 };
 
+/* An action for grammars having more than 8191 states or rules. */
+struct Wide_parser_action_info{
+    uint32_t kind : 3;
+    uint32_t arg  : 29;
+};
+
 #ifndef SHIFT
 #define SHIFT(t)  {static_cast<uint16_t>(Parser_action_name::Shift),  t}
 #define REDUCE(r) {static_cast<uint16_t>(Parser_action_name::Reduce), r}
 #define ACCESS    {static_cast<uint16_t>(Parser_action_name::OK),     0}
+#define ERR       {static_cast<uint16_t>(Parser_action_name::Error),  0}
 #endif
 
-template<typename T>
-using State_and_terminal  = std::pair<size_t, T>;
+/* Layouts of the action table and of the goto table. Tables are generated by the
+ * script tools/gen_lr_tables.py. */
+enum class Table_layout{
+    /* A two-dimensional array: the entry for the row r and the column c is
+     * values[r * number_of_columns + c]; the fields base and check are not used. */
+    Dense,
+    /* Row displacement: the entry for the row r and the column c is
+     * values[base[r] + c], if check[base[r] + c] == r, and it is absent otherwise. */
+    Row_displacement
+};
+
+template<typename V, typename S>
+struct LR_table{
+    const V*        values;
+    const uint32_t* base;
+    const S*        check;
+};
 
-template<typename T>
-using Parser_action_table = std::map<State_and_terminal<T>, Parser_action_info>;
+/**
+ * \brief Reads an entry of a table.
+ * \param [in] tab    The table.
+ * \param [in] row    The row of the entry (a state).
+ * \param [in] column The column of the entry (a terminal or a non-terminal).
+ * \param [in] absent The value of absent entries of a table in the layout
+ *                    Row_displacement.
+ * \return            The value of the entry.
+ */
+template<Table_layout L, size_t Columns, typename V, typename S>
+inline V lr_table_entry(const LR_table<V, S>& tab, size_t row, size_t column, const V& absent)
+{
+    if(L == Table_layout::Dense){
+        return tab.values[row * Columns + column];
+    }
+    size_t i = tab.base[row] + column;
+    return (tab.check[i] == row) ? tab.values[i] : absent;
+}
 
+/* Entries of the action table for which there is no action are equal to ERR. If the
+ * entry of the array default_actions for a state is a reduction, then this reduction
+ * is performed in the state without reading a lookahead, and the action table is not
+ * used for the state; otherwise the entry is ERR. */
 template<typename G_tr>
 struct LR_parser_tables{
-    Rule_info<typename G_tr::Non_terminal_t>*       rules;
-    GOTO_entry**                                    goto_table;
-    Parser_action_table<typename G_tr::Terminal_t>* action_table;
+    const Rule_info<typename G_tr::Non_terminal_t>*                   rules;
+    LR_table<typename G_tr::State_t, typename G_tr::State_t>          goto_table;
+    LR_table<typename G_tr::Action_info_t, typename G_tr::State_t>    action_table;
+    const typename G_tr::Action_info_t*                               default_actions;
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,38 @@
+/*
+    File:    unicode_categories.h
+    Created: 19 October 2026 at 11:02 Moscow time
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+#ifndef UNICODE_CATEGORIES_H
+#define UNICODE_CATEGORIES_H
+#   include <cstddef>
+#   include <string>
+#   include "../include/segment.h"
+/* Information about a Unicode general category: the short name of the category
+ * (for example, "L", "Nd", "Zs") and the canonical set of segments of code points
+ * belonging to the category. The tables are generated offline by the script
+ * tools/gen_unicode_categories.py. */
+struct Unicode_category_info{
+    const char*              name_;
+    const Segment<char32_t>* segments_;
+    size_t                   number_of_segments_;
+};
+
+/* The array unicode_categories is sorted in ascending order of category names. */
+extern const Unicode_category_info unicode_categories[];
+extern const size_t                number_of_unicode_categories;
+
+#define THERE_IS_NO_CATEGORY (-1)
+/**
+ * \brief This function searches for the Unicode general category with the given
+ *        short name.
+ *
+ * \param [in] name The name of the category, for example, U"Lu".
+ * \return          The index of the category in the array unicode_categories, if
+ *                  there is such category, and THERE_IS_NO_CATEGORY otherwise.
+ */
+int unicode_category_index(const std::u32string& name);
+#endif
@@ -0,0 +1,322 @@
+/*
+    File:    zdd_for_set.h
+    Created: 19 October 2026 at 12:04 Moscow time
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+#ifndef ZDD_FOR_SET_H
+#define ZDD_FOR_SET_H
+
+#include <set>
+#include <vector>
+#include <unordered_map>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <cstddef>
+/*
+ * A store of sets and families of sets of values of type T based on a zero-suppressed
+ * binary decision diagram (ZDD), see
+ *      Minato S. Zero-suppressed BDDs for set manipulation in combinatorial problems.
+ *      --- Proc. of the 30th ACM/IEEE Design Automation Conference, 1993, pp. 272--277.
+ *      Knuth D.E. The art of computer programming. Volume 4A. Combinatorial
+ *      algorithms, part 1. --- Addison-Wesley, 2011. Section 7.1.4.
+ *
+ * Every node (x, lo, hi) denotes the family of sets lo ∪ {s ∪ {x} | s ∈ hi}, where
+ * all elements of the families lo and hi are greater than x. There are two terminal
+ * nodes: the node with the index unit_family denotes the family {∅}, and the node
+ * with the index empty_family denotes the empty family. A node whose hi is
+ * empty_family is never created, and equal nodes are created only once (the unique
+ * table is a hash table). Therefore every family has exactly one index, and families
+ * having common parts share the nodes of these parts.
+ *
+ * The contract of the functions insertSet and get_set is the same as for
+ * Trie_for_set<T>: a set is inserted as the family consisting of this set, equal
+ * sets have equal indices, and the empty set has the index 0. But, unlike the prefix tree, which shares only common
+ * prefixes of sorted sets, here common suffixes of sets are shared, and families
+ * built by unite and intersect share everything that can be shared.
+ */
+template<typename T>
+class Zdd_for_set{
+public:
+    static constexpr size_t unit_family  = 0;
+    static constexpr size_t empty_family = 1;
+
+    Zdd_for_set<T>();
+    ~Zdd_for_set<T>()                          = default;
+    Zdd_for_set<T>(const Zdd_for_set<T>& orig) = default;
+
+    /**
+     *  \brief Inserts the family consisting of the single set s.
+     *  \param [in] s The inserted set.
+     *  \return       The index of the family {s}.
+     */
+    size_t insertSet(const std::set<T>& s);
+
+    /**
+     *  \brief The function get_set on the index idx of the family {s} returned by
+     *         insertSet builds the set s.
+     *  \param [in] idx The index of the family consisting of a single set.
+     *  \return         The set as std::set<T>.
+     */
+    std::set<T> get_set(size_t idx) const;
+
+    /**
+     *  \brief The union of families of sets.
+     *  \param [in] f The index of the first family.
+     *  \param [in] g The index of the second family.
+     *  \return       The index of the family containing the sets of f and the sets of g.
+     */
+    size_t unite(size_t f, size_t g);
+
+    /**
+     *  \brief The intersection of families of sets.
+     *  \param [in] f The index of the first family.
+     *  \param [in] g The index of the second family.
+     *  \return       The index of the family containing the sets which belong both to f
+     *                and to g.
+     */
+    size_t intersect(size_t f, size_t g);
+
+    /// \brief Checks whether the set s belongs to the family f.
+    bool contains(size_t f, const std::set<T>& s) const;
+
+    /// \brief Calculates the number of sets in the family f.
+    size_t count(size_t f) const;
+
+    /// \brief The number of nodes of the diagram, including both terminal nodes.
+    size_t number_of_nodes() const;
+private:
+    struct node{
+        T      x;
+        size_t lo;
+        size_t hi;
+    };
+
+    static size_t combine(size_t h, size_t x)
+    {
+        return h ^ (x + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2));
+    }
+
+    struct node_hash{
+        size_t operator()(const node& n) const
+        {
+            return combine(combine(std::hash<T>()(n.x), n.lo), n.hi);
+        }
+    };
+
+    struct node_equal{
+        bool operator()(const node& a, const node& b) const
+        {
+            return (a.x == b.x) && (a.lo == b.lo) && (a.hi == b.hi);
+        }
+    };
+
+    struct pair_hash{
+        size_t operator()(const std::pair<size_t, size_t>& p) const
+        {
+            return combine(p.first, p.second);
+        }
+    };
+
+    using Memo = std::unordered_map<std::pair<size_t, size_t>, size_t, pair_hash>;
+
+    std::vector<node>                                       nodes_;
+    std::unordered_map<node, size_t, node_hash, node_equal> unique_table_;
+    Memo                                                    union_memo_;
+    Memo                                                    intersection_memo_;
+
+    /* Returns the index of the node (x, lo, hi), creating the node if necessary. */
+    size_t get_node(const T& x, size_t lo, size_t hi);
+
+    /* The terminal nodes have the indices 0 and 1. */
+    static constexpr size_t number_of_terminals = 2;
+
+    static bool is_terminal(size_t f)
+    {
+        return f < number_of_terminals;
+    }
+
+    /* Checks whether the empty set belongs to the family f. */
+    bool contains_empty_set(size_t f) const;
+};
+
+template<typename T>
+constexpr size_t Zdd_for_set<T>::empty_family;
+
+template<typename T>
+constexpr size_t Zdd_for_set<T>::unit_family;
+
+template<typename T>
+constexpr size_t Zdd_for_set<T>::number_of_terminals;
+
+template<typename T>
+Zdd_for_set<T>::Zdd_for_set()
+{
+    nodes_ = std::vector<node>(number_of_terminals, node{T(), empty_family, empty_family});
+}
+
+template<typename T>
+size_t Zdd_for_set<T>::get_node(const T& x, size_t lo, size_t hi)
+{
+    if(hi == empty_family){
+        return lo;
+    }
+    node key{x, lo, hi};
+    auto it  = unique_table_.find(key);
+    if(it != unique_table_.end()){
+        return it->second;
+    }
+    size_t idx = nodes_.size();
+    nodes_.push_back(key);
+    unique_table_[key] = idx;
+    return idx;
+}
+
+template<typename T>
+size_t Zdd_for_set<T>::insertSet(const std::set<T>& s)
+{
+    size_t result = unit_family;
+    for(auto it = s.rbegin(); it != s.rend(); ++it){
+        result = get_node(*it, empty_family, result);
+    }
+    return result;
+}
+
+template<typename T>
+std::set<T> Zdd_for_set<T>::get_set(size_t idx) const
+{
+    std::set<T> s;
+    for(size_t current = idx; !is_terminal(current); current = nodes_[current].hi){
+        s.insert(s.end(), nodes_[current].x);
+    }
+    return s;
+}
+
+template<typename T>
+bool Zdd_for_set<T>::contains_empty_set(size_t f) const
+{
+    while(!is_terminal(f)){
+        f = nodes_[f].lo;
+    }
+    return f == unit_family;
+}
+
+template<typename T>
+size_t Zdd_for_set<T>::unite(size_t f, size_t g)
+{
+    if(f == empty_family){
+        return g;
+    }
+    if((g == empty_family) || (f == g)){
+        return f;
+    }
+    if(f > g){
+        std::swap(f, g);
+    }
+    auto key = std::make_pair(f, g);
+    auto it  = union_memo_.find(key);
+    if(it != union_memo_.end()){
+        return it->second;
+    }
+    /* Here f and g are not the empty family, and f < g. Since unit_family is the
+     * least index, g is not a terminal node. The indices of nodes
+     * are not kept across recursive calls, because they can add new nodes. */
+    size_t result;
+    node   ng = nodes_[g];
+    if(f == unit_family){
+        result = get_node(ng.x, unite(unit_family, ng.lo), ng.hi);
+    }else{
+        node nf = nodes_[f];
+        if(nf.x < ng.x){
+            result = get_node(nf.x, unite(nf.lo, g), nf.hi);
+        }else if(ng.x < nf.x){
+            result = get_node(ng.x, unite(f, ng.lo), ng.hi);
+        }else{
+            size_t lo = unite(nf.lo, ng.lo);
+            size_t hi = unite(nf.hi, ng.hi);
+            result    = get_node(nf.x, lo, hi);
+        }
+    }
+    union_memo_[key] = result;
+    return result;
+}
+
+template<typename T>
+size_t Zdd_for_set<T>::intersect(size_t f, size_t g)
+{
+    if((f == empty_family) || (g == empty_family)){
+        return empty_family;
+    }
+    if(f == g){
+        return f;
+    }
+    if(f > g){
+        std::swap(f, g);
+    }
+    if(f == unit_family){
+        return contains_empty_set(g) ? unit_family : empty_family;
+    }
+    auto key = std::make_pair(f, g);
+    auto it  = intersection_memo_.find(key);
+    if(it != intersection_memo_.end()){
+        return it->second;
+    }
+    size_t result;
+    node   nf     = nodes_[f];
+    node   ng     = nodes_[g];
+    if(nf.x < ng.x){
+        result = intersect(nf.lo, g);
+    }else if(ng.x < nf.x){
+        result = intersect(f, ng.lo);
+    }else{
+        size_t lo = intersect(nf.lo, ng.lo);
+        size_t hi = intersect(nf.hi, ng.hi);
+        result    = get_node(nf.x, lo, hi);
+    }
+    intersection_memo_[key] = result;
+    return result;
+}
+
+template<typename T>
+bool Zdd_for_set<T>::contains(size_t f, const std::set<T>& s) const
+{
+    auto it = s.begin();
+    while(!is_terminal(f)){
+        const node& n = nodes_[f];
+        if((it == s.end()) || (n.x < *it)){
+            f = n.lo;
+        }else if(*it < n.x){
+            return false;
+        }else{
+            f = n.hi;
+            ++it;
+        }
+    }
+    return (f == unit_family) && (it == s.end());
+}
+
+template<typename T>
+size_t Zdd_for_set<T>::count(size_t f) const
+{
+    /* The numbers of sets are calculated for nodes in ascending order of indices: the
+     * children of a node are always created before the node itself. */
+    std::vector<size_t> counts((f < number_of_terminals) ? number_of_terminals : (f + 1), 0);
+    counts[unit_family] = 1;
+    for(size_t i = number_of_terminals; i <= f; ++i){
+        counts[i] = counts[nodes_[i].lo] + counts[nodes_[i].hi];
+    }
+    return counts[f];
+}
+
+template<typename T>
+size_t Zdd_for_set<T>::number_of_nodes() const
+{
+    return nodes_.size();
+}
+
+using Zdd_for_set_of_sizet    = Zdd_for_set<size_t>;
+using Zdd_for_set_of_sizetptr = std::shared_ptr<Zdd_for_set_of_sizet>;
+#endif
@@ -12,7 +12,7 @@
 #include <cstddef>
 #include "../include/aux_expr_scaner.h"
 #include "../include/aux_expr_lexem.h"
-#include "../include/knuth_find.h"
+#include "../include/eytzinger_find.h"
 #include "../include/belongs.h"
 #include "../include/print_char32.h"
 #include "../include/search_char.h"
@@ -20,6 +20,8 @@
 #include "../include/elem.h"
 #include "../include/aux_expr_scaner_classes_table.h"
 #include "../include/idx_to_string.h"
+#include "../include/char_conv.h"
+#include "../include/unicode_categories.h"
 
 template <class T, std::size_t N>
 constexpr size_t size(const T (&array)[N]) noexcept
@@ -34,33 +36,36 @@ enum class Category : uint16_t{
     Id_begin,    Id_body,         Percent
 };
 
-static const Segment_with_value<char32_t, uint64_t> categories_table[] = {
-    {{U'_'   , U'_'   },  1536 },  {{U'L'   , U'L'   },  1600 },
-    {{U'n'   , U'n'   },  1616 },  {{U'('   , U'+'   },  20   },
-    {{U'['   , U'['   },  48   },  {{U'd'   , U'd'   },  1600 },
-    {{U's'   , U'w'   },  1536 },  {{U'$'   , U'$'   },  272  },
-    {{U'\?'  , U'\?'  },  20   },  {{U'R'   , U'R'   },  1600 },
-    {{U']'   , U']'   },  16   },  {{U'b'   , U'b'   },  1600 },
-    {{U'l'   , U'l'   },  1600 },  {{U'p'   , U'q'   },  1536 },
-    {{U'y'   , U'z'   },  1536 },  {{U'\"'  , U'\"'  },  16   },
-    {{U'%'   , U'%'   },  2064 },  {{U'0'   , U'9'   },  1024 },
-    {{U'A'   , U'K'   },  1536 },  {{U'M'   , U'Q'   },  1536 },
-    {{U'S'   , U'Z'   },  1536 },  {{U'\\'  , U'\\'  },  24   },
-    {{U'^'   , U'^'   },  144  },  {{U'a'   , U'a'   },  1536 },
-    {{U'c'   , U'c'   },  1536 },  {{U'e'   , U'k'   },  1536 },
-    {{U'm'   , U'm'   },  1536 },  {{U'o'   , U'o'   },  1600 },
-    {{U'r'   , U'r'   },  1600 },  {{U'x'   , U'x'   },  1600 },
-    {{U'{'   , U'}'   },  20   },  {{U'\x01', U' '   },  1    }
+/* The pairs (segment of characters, set of categories) sorted in ascending order of
+ * segments. The search table categories_table is built from them at compile time. */
+static constexpr Segment_with_value<char32_t, uint64_t> sorted_categories[] = {
+    {{U'\x01', U' '   },  1    },  {{U'\"'  , U'\"'  },  16   },
+    {{U'$'   , U'$'   },  272  },  {{U'%'   , U'%'   },  2064 },
+    {{U'('   , U'+'   },  20   },  {{U'0'   , U'9'   },  1024 },
+    {{U'\?'  , U'\?'  },  20   },  {{U'A'   , U'K'   },  1536 },
+    {{U'L'   , U'L'   },  1600 },  {{U'M'   , U'Q'   },  1536 },
+    {{U'R'   , U'R'   },  1600 },  {{U'S'   , U'Z'   },  1536 },
+    {{U'['   , U'['   },  48   },  {{U'\\'  , U'\\'  },  24   },
+    {{U']'   , U']'   },  16   },  {{U'^'   , U'^'   },  144  },
+    {{U'_'   , U'_'   },  1536 },  {{U'a'   , U'a'   },  1536 },
+    {{U'b'   , U'b'   },  1600 },  {{U'c'   , U'c'   },  1536 },
+    {{U'd'   , U'd'   },  1600 },  {{U'e'   , U'k'   },  1536 },
+    {{U'l'   , U'l'   },  1600 },  {{U'm'   , U'm'   },  1536 },
+    {{U'n'   , U'n'   },  1616 },  {{U'o'   , U'o'   },  1600 },
+    {{U'p'   , U'q'   },  1536 },  {{U'r'   , U'r'   },  1600 },
+    {{U's'   , U'w'   },  1536 },  {{U'x'   , U'x'   },  1600 },
+    {{U'y'   , U'z'   },  1536 },  {{U'{'   , U'}'   },  20   }
 };
 
-static constexpr size_t num_of_elems_in_categories_table = size(categories_table);
+static_assert(are_sorted_segments(sorted_categories),
+              "The segments of sorted_categories must be sorted and disjoint.");
+
+static constexpr auto categories_table = build_eytzinger(sorted_categories);
 
 uint64_t get_categories_set(char32_t c)
 {
-    auto t = knuth_find(categories_table,
-                        categories_table + num_of_elems_in_categories_table,
-                        c);
-    return t.first ? categories_table[t.second].value :
+    auto t = eytzinger_find(categories_table, c);
+    return t.first ? categories_table.elems[t.second].value :
                      1ULL << static_cast<uint64_t>(Category::Other);
 }
 
@@ -73,14 +78,14 @@ Aux_expr_scaner::Automaton_proc Aux_expr_scaner::procs_[] = {
     &Aux_expr_scaner::start_proc,       &Aux_expr_scaner::backslash_proc,
     &Aux_expr_scaner::maybe_class_proc, &Aux_expr_scaner::class_proc,
     &Aux_expr_scaner::hat_proc,         &Aux_expr_scaner::action_proc,
-    &Aux_expr_scaner::regexp_name_proc
+    &Aux_expr_scaner::regexp_name_proc, &Aux_expr_scaner::unicode_class_proc
 };
 
 Aux_expr_scaner::Final_proc Aux_expr_scaner::finals_[] = {
     &Aux_expr_scaner::none_final_proc,        &Aux_expr_scaner::backslash_final_proc,
     &Aux_expr_scaner::maybe_class_final_proc, &Aux_expr_scaner::class_final_proc,
     &Aux_expr_scaner::hat_final_proc,         &Aux_expr_scaner::action_final_proc,
-    &Aux_expr_scaner::regexp_name_final_proc
+    &Aux_expr_scaner::regexp_name_final_proc, &Aux_expr_scaner::unicode_class_final_proc
 };
 
 static Aux_expr_lexem_code char32_to_delimiter(char32_t ch)
@@ -175,15 +180,6 @@ bool Aux_expr_scaner::start_proc()
     return false;
 }
 
-static const char* class_strings[] = {
-    "[:Latin:]",   "[:Letter:]",  "[:Russian:]",
-    "[:bdigits:]", "[:digits:]",  "[:latin:]",
-    "[:letter:]",  "[:odigits:]", "[:russian:]",
-    "[:xdigits:]", "[:ndq:]",     "[:nsq:]"
-};
-
-static const char* line_expects = "Error at line %zu: expected %s.\n";
-
 void Aux_expr_scaner::correct_class()
 {
     /* This function corrects the code of the token, most likely a character class,
@@ -191,7 +187,7 @@ void Aux_expr_scaner::correct_class()
     if(token_.lexeme_.code_ >= Aux_expr_lexem_code::M_Class_Latin){
         int y = static_cast<int>(token_.lexeme_.code_) -
                 static_cast<int>(Aux_expr_lexem_code::M_Class_Latin);
-        printf(line_expects, loc_->pos_.line_no_, class_strings[y]);
+        diags_->add(Diagnostic_code::Expected_char_class, loc_->pos_.line_no_, y);
         token_.lexeme_.code_ = static_cast<Aux_expr_lexem_code>(y +
                                static_cast<int>(Aux_expr_lexem_code::Class_Latin));
         en_ -> increment_number_of_errors();
@@ -200,10 +196,12 @@ void Aux_expr_scaner::correct_class()
 
 ascaner::Token<Aux_expr_lexem_info> Aux_expr_scaner::current_lexeme()
 {
-    automaton_           = A_start;
-    token_.lexeme_.code_ = Aux_expr_lexem_code::Nothing;
-    lexeme_begin_        = loc_->pcurrent_char_;
-    bool t               = true;
+    automaton_              = A_start;
+    token_.lexeme_.code_    = Aux_expr_lexem_code::Nothing;
+    token_.lexeme_.escaped_ = false;
+    lexeme_begin_           = loc_->pcurrent_char_;
+    lexeme_begin_pos_       = loc_->pos_;
+    bool t                  = true;
     while((ch_ = *(loc_->pcurrent_char_)++)){
         char_categories_ = get_categories_set(ch_);
         t = (this->*procs_[automaton_])();
@@ -251,13 +249,6 @@ static const State_for_char init_table_for_classes[] = {
     {54, U'n'}, {63, U'o'}, {72, U'r'}, {81, U'x'}
 };
 
-static const char* expects_LRbdlnorx =
-    "Error at line %zu. Expected one of the following characters: "
-    "L, R, b, d, l, n, o, r, x.\n";
-
-static const char* latin_letter_expected =
-    "A Latin letter or an underscore is expected at the line %zu.\n";
-
 bool Aux_expr_scaner::maybe_class_proc()
 {
     switch(ch_){
@@ -298,6 +289,16 @@ bool Aux_expr_scaner::class_proc()
         }
         return t;
     }
+    if(U'p' == ch_){
+        /* The lexeme [:pXx:] is the class of characters of the Unicode general
+         * category Xx, i.e. it is an analogue of \p{Xx}. */
+        automaton_           = A_unicode_class;
+        token_.lexeme_.code_ = Aux_expr_lexem_code::Class_unicode;
+        buffer_.clear();
+        lexeme_pos_.end_pos_.line_pos_++;
+        (loc_->pos_.line_pos_)++;
+        return true;
+    }
     if(belongs(Category::After_colon, char_categories_)){
         state_               = get_init_state(ch_, init_table_for_classes,
                                               size(init_table_for_classes));
@@ -306,16 +307,64 @@ bool Aux_expr_scaner::class_proc()
         lexeme_pos_.end_pos_.line_pos_++;
         (loc_->pos_.line_pos_)++;
     }else{
-        printf(expects_LRbdlnorx, loc_->pos_.line_no_);
+        diags_->add(Diagnostic_code::Expected_LRbdlnorx, loc_->pos_.line_no_);
         en_ -> increment_number_of_errors();
     }
     return t;
 }
 
+static inline bool is_latin_letter(char32_t c)
+{
+    return ((U'A' <= c) && (c <= U'Z')) || ((U'a' <= c) && (c <= U'z'));
+}
+
+void Aux_expr_scaner::finish_unicode_class()
+{
+    int idx = unicode_category_index(buffer_);
+    if(THERE_IS_NO_CATEGORY == idx){
+        if(!buffer_.empty()){
+            diags_->add(Diagnostic_code::Unknown_unicode_category, loc_->pos_.line_no_,
+                        diags_->add_text(buffer_));
+            en_ -> increment_number_of_errors();
+        }
+        idx = 0;
+    }
+    token_.lexeme_.code_           = Aux_expr_lexem_code::Class_unicode;
+    token_.lexeme_.category_index_ = idx;
+}
+
+bool Aux_expr_scaner::unicode_class_proc()
+{
+    /* In the state (-1) the name of the category is read, and the state 0 means
+     * that the colon after the name of the category is already read. */
+    if((-1 == state_) && is_latin_letter(ch_)){
+        buffer_ += ch_;
+    }else if((-1 == state_) && (U':' == ch_) && !buffer_.empty()){
+        state_ = 0;
+    }else if((0 == state_) && (U']' == ch_)){
+        lexeme_pos_.end_pos_.line_pos_++;
+        (loc_->pos_.line_pos_)++;
+        finish_unicode_class();
+        return false;
+    }else{
+        diags_->add(Diagnostic_code::Unicode_class_end_expected, loc_->pos_.line_no_);
+        en_ -> increment_number_of_errors();
+        (loc_->pcurrent_char_)--;
+        finish_unicode_class();
+        return false;
+    }
+    lexeme_pos_.end_pos_.line_pos_++;
+    (loc_->pos_.line_pos_)++;
+    return true;
+}
+
 bool Aux_expr_scaner::backslash_proc()
 {
-    if(belongs(Category::After_backslash, char_categories_)){
-        token_.lexeme_.c_ = (U'n' == ch_) ? U'\n' : ch_;
+    if(belongs(Category::After_backslash, char_categories_) ||
+       (inside_class_complement_ && (U'-' == ch_)))
+    {
+        token_.lexeme_.c_       = (U'n' == ch_) ? U'\n' : ch_;
+        token_.lexeme_.escaped_ = true;
         lexeme_pos_.end_pos_.line_pos_++;
         (loc_->pos_.line_pos_) += 2;
     }else{
@@ -339,7 +388,7 @@ bool Aux_expr_scaner::action_proc()
         }else{
             token_.lexeme_.code_ = Aux_expr_lexem_code::Character;
             token_.lexeme_.c_    = U'$';
-            printf(latin_letter_expected, loc_->pos_.line_no_);
+            diags_->add(Diagnostic_code::Latin_letter_expected, loc_->pos_.line_no_);
             en_ -> increment_number_of_errors();
             t                    = false;
             (loc_->pcurrent_char_)--;
@@ -371,7 +420,7 @@ bool Aux_expr_scaner::regexp_name_proc()
         }else{
             token_.lexeme_.code_ = Aux_expr_lexem_code::Character;
             token_.lexeme_.c_    = U'%';
-            printf(latin_letter_expected, loc_->pos_.line_no_);
+            diags_->add(Diagnostic_code::Latin_letter_expected, loc_->pos_.line_no_);
             en_ -> increment_number_of_errors();
             t                    = false;
             (loc_->pcurrent_char_)--;
@@ -429,6 +478,13 @@ void Aux_expr_scaner::regexp_name_final_proc()
     token_.lexeme_.regexp_name_index_ = ids_ -> insert(buffer_);
 }
 
+void Aux_expr_scaner::unicode_class_final_proc()
+{
+    diags_->add(Diagnostic_code::Unicode_class_end_expected, loc_->pos_.line_no_);
+    en_ -> increment_number_of_errors();
+    finish_unicode_class();
+}
+
 void Aux_expr_scaner::maybe_class_final_proc()
 {
     token_.lexeme_.code_ = Aux_expr_lexem_code::Character;
@@ -467,7 +523,8 @@ static const char* lexem_names[] = {
     "M_Class_Latin",   "M_Class_Letter",              "M_Class_Russian",
     "M_Class_bdigits", "M_Class_digits",              "M_Class_latin",
     "M_Class_letter",  "M_Class_odigits",             "M_Class_russian",
-    "M_Class_xdigits", "M_Class_ndq",                 "M_Class_nsq"
+    "M_Class_xdigits", "M_Class_ndq",                 "M_Class_nsq",
+    "Class_unicode"
 };
 
 std::string Aux_expr_scaner::lexeme_to_string(const Aux_expr_lexem_info& li)
@@ -489,6 +546,10 @@ std::string Aux_expr_scaner::lexeme_to_string(const Aux_expr_lexem_info& li)
                       ", name: "  + idx_to_string(ids_, li.regexp_name_index_) +
                       "]";
             break;
+        case Aux_expr_lexem_code::Class_unicode:
+            result += " ";
+            result += unicode_categories[li.category_index_].name_;
+            break;
         default:
             ;
     }
@@ -0,0 +1,54 @@
+/*
+    File:    command.cpp
+    Created: 19 October 2026 at 16:25 Moscow time
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+
+#include "../include/command.h"
+
+/* The operands of a command precede it in the buffer, so when the command is
+ * processed, its action is final and can be written into its operands. */
+static void resolve(Command_buffer& coms, const std::vector<uint32_t>& operands)
+{
+    for(size_t i = coms.size(); i-- > 0; ){
+        const Command& com = coms[i];
+        size_t         act = com.action_name_;
+        if(!act){
+            continue;
+        }
+        switch(com.name_){
+            case Command_name::Or:
+            case Command_name::Concat:
+                coms[com.args.first_].action_name_  = act;
+                coms[com.args.second_].action_name_ = act;
+                break;
+            case Command_name::Kleene:
+            case Command_name::Positive:
+            case Command_name::Optional:
+                coms[com.args.first_].action_name_  = act;
+                break;
+            case Command_name::Multior:
+            case Command_name::Multiconcat:
+                for(size_t k = 0; k < com.args.second_; ++k){
+                    coms[operands[com.args.first_ + k]].action_name_ = act;
+                }
+                break;
+            default:
+                ;
+        }
+    }
+}
+
+void resolve_actions(Command_buffer& buf)
+{
+    static const std::vector<uint32_t> no_operands;
+    resolve(buf, no_operands);
+}
+
+void resolve_actions(Flat_commands& buf)
+{
+    resolve(buf.commands_, buf.operands_);
+}
@@ -0,0 +1,414 @@
+/*
+    File:    command_passes.cpp
+    Created: 19 October 2026 at 16:50 Moscow time
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include "../include/command_passes.h"
+
+static bool is_binary(Command_name n)
+{
+    return (Command_name::Or == n) || (Command_name::Concat == n);
+}
+
+static Command_name n_ary_version(Command_name n)
+{
+    return (Command_name::Or == n) ? Command_name::Multior : Command_name::Multiconcat;
+}
+
+/* Checks whether an operand with the action operand_act can be merged into the
+ * enclosing command with the action act. */
+static bool compatible_actions(size_t operand_act, size_t act)
+{
+    return !operand_act || (operand_act == act);
+}
+
+Flat_commands flatten(const Command_buffer& buf)
+{
+    size_t            n = buf.size();
+    /* The element merged[i] is true, if the command i is merged into the command
+     * whose operand it is. Every command built by the parser is an operand of at
+     * most one command. */
+    std::vector<bool> merged(n, false);
+    for(const auto& com : buf){
+        if(!is_binary(com.name_)){
+            continue;
+        }
+        for(size_t op : {com.args.first_, com.args.second_}){
+            const Command& operand = buf[op];
+            merged[op] = (operand.name_ == com.name_) &&
+                         compatible_actions(operand.action_name_, com.action_name_);
+        }
+    }
+
+    Flat_commands         result;
+    auto&                 operands  = result.operands_;
+    std::vector<uint32_t> new_index(n);
+    /* The stack of commands whose operands are not yet collected; it replaces the
+     * recursion, since the depth of a chain can be equal to its length. */
+    std::vector<uint32_t> stack;
+    for(size_t i = 0; i < n; ++i){
+        if(merged[i]){
+            continue;
+        }
+        Command com = buf[i];
+        switch(com.name_){
+            case Command_name::Or:
+            case Command_name::Concat:
+                {
+                    size_t first = operands.size();
+                    stack.push_back(com.args.second_);
+                    stack.push_back(com.args.first_);
+                    while(!stack.empty()){
+                        uint32_t k = stack.back();
+                        stack.pop_back();
+                        if(merged[k]){
+                            stack.push_back(buf[k].args.second_);
+                            stack.push_back(buf[k].args.first_);
+                        }else{
+                            operands.push_back(new_index[k]);
+                        }
+                    }
+                    size_t number_of_operands = operands.size() - first;
+                    if(number_of_operands > 2){
+                        com.name_        = n_ary_version(com.name_);
+                        com.args.first_  = first;
+                        com.args.second_ = number_of_operands;
+                    }else{
+                        com.args.first_  = operands[first];
+                        com.args.second_ = operands[first + 1];
+                        operands.resize(first);
+                    }
+                }
+                break;
+            case Command_name::Kleene:
+            case Command_name::Positive:
+            case Command_name::Optional:
+                com.args.first_ = new_index[com.args.first_];
+                break;
+            default:
+                ;
+        }
+        new_index[i] = result.commands_.size();
+        result.commands_.push_back(com);
+    }
+    return result;
+}
+
+static bool is_closure(Command_name n)
+{
+    return (Command_name::Kleene   == n) || (Command_name::Positive == n) ||
+           (Command_name::Optional == n);
+}
+
+/* The closure equal to the closure outer applied to the closure inner. */
+static Command_name combined_closure(Command_name outer, Command_name inner)
+{
+    return (outer == inner) ? outer : Command_name::Kleene;
+}
+
+static bool is_char_or_class(Command_name n)
+{
+    return (Command_name::Char == n) || (Command_name::Char_class == n);
+}
+
+using Char_set = operations_with_segments::Set_of_segments<char32_t>;
+
+static Char_set set_of_command(const Command& com, const Trie_for_char_segments_ptr& sets)
+{
+    if(Command_name::Char == com.name_){
+        return Char_set(1, operations_with_segments::make_segment(com.c_, com.c_));
+    }
+    return sets->get_set(com.idx_of_set_);
+}
+
+/* Renumbers the operands of the command com by the array new_index. */
+static void renumber_operands(Command&                     com,
+                              std::vector<uint32_t>&       operands,
+                              const std::vector<uint32_t>& new_index)
+{
+    switch(com.name_){
+        case Command_name::Or:
+        case Command_name::Concat:
+            com.args.first_  = new_index[com.args.first_];
+            com.args.second_ = new_index[com.args.second_];
+            break;
+        case Command_name::Kleene:
+        case Command_name::Positive:
+        case Command_name::Optional:
+            com.args.first_  = new_index[com.args.first_];
+            break;
+        case Command_name::Multior:
+        case Command_name::Multiconcat:
+            for(size_t k = 0; k < com.args.second_; ++k){
+                auto& op = operands[com.args.first_ + k];
+                op       = new_index[op];
+            }
+            break;
+        default:
+            ;
+    }
+}
+
+Flat_commands simplify(const Flat_commands& buf, const Trie_for_char_segments_ptr& sets)
+{
+    const auto&           src       = buf.commands_;
+    size_t                n         = src.size();
+    Flat_commands         result;
+    auto&                 coms      = result.commands_;
+    auto&                 operands  = result.operands_;
+    /* Commands of the result that became operands of merged classes. */
+    std::vector<bool>     dead;
+    std::vector<uint32_t> new_index(n);
+    std::vector<uint32_t> alternatives;
+    for(size_t i = 0; i < n; ++i){
+        Command com = src[i];
+        if(is_closure(com.name_)){
+            uint32_t op    = new_index[com.args.first_];
+            Command& inner = coms[op];
+            if(is_closure(inner.name_) &&
+               compatible_actions(inner.action_name_, com.action_name_))
+            {
+                inner.name_        = combined_closure(com.name_, inner.name_);
+                inner.action_name_ = com.action_name_;
+                new_index[i]       = op;
+                continue;
+            }
+            com.args.first_ = op;
+        }else if((Command_name::Or == com.name_) || (Command_name::Multior == com.name_)){
+            alternatives.clear();
+            if(Command_name::Or == com.name_){
+                alternatives.push_back(new_index[com.args.first_]);
+                alternatives.push_back(new_index[com.args.second_]);
+            }else{
+                for(size_t k = 0; k < com.args.second_; ++k){
+                    alternatives.push_back(new_index[buf.operands_[com.args.first_ + k]]);
+                }
+            }
+            /* The characters and classes are replaced by their union, which takes
+             * the place of the first of them. */
+            Char_set united;
+            size_t   number_of_united = 0;
+            size_t   place            = 0;
+            for(size_t k = 0; k < alternatives.size(); ++k){
+                const Command& alt = coms[alternatives[k]];
+                if(is_char_or_class(alt.name_) &&
+                   compatible_actions(alt.action_name_, com.action_name_))
+                {
+                    using operations_with_segments::operator+;
+                    united = united + set_of_command(alt, sets);
+                    place  = number_of_united++ ? place : k;
+                }
+            }
+            if(number_of_united > 1){
+                Command cls;
+                cls.action_name_ = com.action_name_;
+                if((1 == united.size()) && (united[0].lower_bound == united[0].upper_bound)){
+                    cls.name_       = Command_name::Char;
+                    cls.c_          = united[0].lower_bound;
+                }else{
+                    cls.name_       = Command_name::Char_class;
+                    cls.idx_of_set_ = sets->insertSet(united);
+                }
+                uint32_t cls_index = coms.size();
+                coms.push_back(cls);
+                dead.push_back(false);
+                size_t   m         = 0;
+                for(size_t k = 0; k < alternatives.size(); ++k){
+                    const Command& alt = coms[alternatives[k]];
+                    if(is_char_or_class(alt.name_) &&
+                       compatible_actions(alt.action_name_, com.action_name_))
+                    {
+                        dead[alternatives[k]] = true;
+                        if(k != place){
+                            continue;
+                        }
+                        alternatives[k] = cls_index;
+                    }
+                    alternatives[m++] = alternatives[k];
+                }
+                alternatives.resize(m);
+            }
+            if(1 == alternatives.size()){
+                new_index[i] = alternatives[0];
+                continue;
+            }
+            if(2 == alternatives.size()){
+                com.name_        = Command_name::Or;
+                com.args.first_  = alternatives[0];
+                com.args.second_ = alternatives[1];
+            }else{
+                com.name_        = Command_name::Multior;
+                com.args.first_  = operands.size();
+                com.args.second_ = alternatives.size();
+                operands.insert(operands.end(), alternatives.begin(), alternatives.end());
+            }
+        }else if(Command_name::Multiconcat == com.name_){
+            uint32_t first = operands.size();
+            for(size_t k = 0; k < com.args.second_; ++k){
+                operands.push_back(new_index[buf.operands_[com.args.first_ + k]]);
+            }
+            com.args.first_ = first;
+        }else if(Command_name::Concat == com.name_){
+            com.args.first_  = new_index[com.args.first_];
+            com.args.second_ = new_index[com.args.second_];
+        }
+        new_index[i] = coms.size();
+        coms.push_back(com);
+        dead.push_back(false);
+    }
+
+    /* The merged characters and classes are removed. */
+    std::vector<uint32_t> compact_index(coms.size());
+    size_t                m = 0;
+    for(size_t k = 0; k < coms.size(); ++k){
+        if(dead[k]){
+            continue;
+        }
+        Command com = coms[k];
+        renumber_operands(com, operands, compact_index);
+        compact_index[k] = m;
+        coms[m++]        = com;
+    }
+    coms.resize(m);
+    return result;
+}
+
+/* The key of a command for hash-consing: the fields of the union that the
+ * command does not use are zero. The operands of n-ary commands are the
+ * elements of operands from first_ to first_ + second_. */
+struct Command_key{
+    Command_name name_;
+    uint32_t     action_name_;
+    uint32_t     first_;
+    uint32_t     second_;
+};
+
+struct Command_key_hash{
+    const std::vector<uint32_t>* operands;
+
+    size_t operator()(const Command_key& k) const
+    {
+        size_t h = (static_cast<size_t>(k.name_) << 24) ^ k.action_name_;
+        auto   combine = [&h](size_t x){
+            h ^= x + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+        };
+        if((Command_name::Multior == k.name_) || (Command_name::Multiconcat == k.name_)){
+            for(uint32_t i = 0; i < k.second_; ++i){
+                combine((*operands)[k.first_ + i]);
+            }
+        }else{
+            combine(k.first_);
+            combine(k.second_);
+        }
+        return h;
+    }
+};
+
+struct Command_key_equal{
+    const std::vector<uint32_t>* operands;
+
+    bool operator()(const Command_key& a, const Command_key& b) const
+    {
+        if((a.name_ != b.name_) || (a.action_name_ != b.action_name_) ||
+           (a.second_ != b.second_))
+        {
+            return false;
+        }
+        if((Command_name::Multior == a.name_) || (Command_name::Multiconcat == a.name_)){
+            auto first = operands->begin();
+            return std::equal(first + a.first_, first + a.first_ + a.second_,
+                              first + b.first_);
+        }
+        return a.first_ == b.first_;
+    }
+};
+
+Flat_commands hash_cons(const Flat_commands& buf, std::vector<uint32_t>& ref_counts)
+{
+    const auto&           src      = buf.commands_;
+    size_t                n        = src.size();
+    Flat_commands         result;
+    auto&                 coms     = result.commands_;
+    auto&                 operands = result.operands_;
+    std::vector<uint32_t> new_index(n);
+    std::unordered_map<Command_key, uint32_t, Command_key_hash, Command_key_equal>
+        known(n, Command_key_hash{&operands}, Command_key_equal{&operands});
+    for(size_t i = 0; i < n; ++i){
+        Command     com = src[i];
+        Command_key key = {com.name_, com.action_name_, 0, 0};
+        size_t      operands_size = operands.size();
+        switch(com.name_){
+            case Command_name::Or:
+            case Command_name::Concat:
+                key.first_  = com.args.first_  = new_index[com.args.first_];
+                key.second_ = com.args.second_ = new_index[com.args.second_];
+                break;
+            case Command_name::Kleene:
+            case Command_name::Positive:
+            case Command_name::Optional:
+                key.first_  = com.args.first_  = new_index[com.args.first_];
+                break;
+            case Command_name::Multior:
+            case Command_name::Multiconcat:
+                for(size_t k = 0; k < com.args.second_; ++k){
+                    operands.push_back(new_index[buf.operands_[com.args.first_ + k]]);
+                }
+                key.first_  = com.args.first_  = operands_size;
+                key.second_ = com.args.second_;
+                break;
+            case Command_name::Char:
+                key.first_  = com.c_;
+                break;
+            case Command_name::Char_class:
+            case Command_name::Char_class_complement:
+                key.first_  = com.idx_of_set_;
+                break;
+            case Command_name::Regexp_name:
+                key.first_  = com.idx_of_regexp_name_;
+                break;
+            default:
+                ;
+        }
+        auto it = known.find(key);
+        if(it != known.end()){
+            new_index[i] = it->second;
+            operands.resize(operands_size);
+            continue;
+        }
+        new_index[i] = coms.size();
+        known.insert({key, new_index[i]});
+        coms.push_back(com);
+    }
+
+    ref_counts.assign(coms.size(), 0);
+    for(const auto& com : coms){
+        switch(com.name_){
+            case Command_name::Or:
+            case Command_name::Concat:
+                ref_counts[com.args.first_]++;
+                ref_counts[com.args.second_]++;
+                break;
+            case Command_name::Kleene:
+            case Command_name::Positive:
+            case Command_name::Optional:
+                ref_counts[com.args.first_]++;
+                break;
+            case Command_name::Multior:
+            case Command_name::Multiconcat:
+                for(size_t k = 0; k < com.args.second_; ++k){
+                    ref_counts[operands[com.args.first_ + k]]++;
+                }
+                break;
+            default:
+                ;
+        }
+    }
+    return result;
+}
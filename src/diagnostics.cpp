@@ -0,0 +1,120 @@
+/*
+    File:    diagnostics.cpp
+    Created: 19 October 2026 at 15:40 Moscow time
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+
+#include <cstdio>
+#include "../include/diagnostics.h"
+#include "../include/idx_to_string.h"
+
+enum class Arg_kind{
+    None, Char_class, Text, Identifier
+};
+
+struct Diagnostic_info{
+    const char* fmt_;
+    Arg_kind    arg_kind_;
+};
+
+/* The order of elements of this array is the order of the enumeration
+ * Diagnostic_code. */
+static const Diagnostic_info diagnostic_infos[] = {
+    {"Error at line %zu: expected %s.\n", Arg_kind::Char_class},
+
+    {"Error at line %zu. Expected one of the following characters: "
+     "L, R, b, d, l, n, o, p, r, x.\n", Arg_kind::None},
+
+    {"Error at line %zu: unknown Unicode general category %s.\n", Arg_kind::Text},
+
+    {"Error at line %zu: a name of a Unicode general category followed by :] "
+     "is expected.\n", Arg_kind::None},
+
+    {"A Latin letter or an underscore is expected at the line %zu.\n", Arg_kind::None},
+
+    {"Error at line %zu: regexp name %s is undefined.\n", Arg_kind::Identifier},
+
+    {"Error at line %zu: character classes [:ndq:] and [:nsq:] are not admissible "
+     "in the character class complement.\n", Arg_kind::None},
+
+    {"Error at line %zu: expected a character or character class, with the "
+     "exception of [:nsq:] and [:ndq:].\n", Arg_kind::None},
+
+    {"Error at line %zu: the first character of a range of characters is greater "
+     "than the last one.\n", Arg_kind::None},
+
+    {"Error at line %zu: the action %s is not defined.\n", Arg_kind::Identifier},
+
+    {"Error at line %zu: the identifier %s is not an action.\n", Arg_kind::Identifier},
+
+    {"Error at line %zu: an opening curly brace is expected.\n", Arg_kind::None},
+
+    {"Error at line %zu: a character, a character class, or an "
+     "opening parenthesis are expected.\n", Arg_kind::None},
+
+    {"Error at line %zu: an operator | or closing brace are expected.\n", Arg_kind::None},
+
+    {"Error at line %zu: an unexpected action.\n", Arg_kind::None},
+
+    {"Error at line %zu: an unexpected postfix operator.\n", Arg_kind::None},
+
+    {"Error at line %zu: an unexpected end of text.\n", Arg_kind::None},
+
+    {"Error at line %zu: an unexpected opening brace.\n", Arg_kind::None},
+
+    {"Error at line %zu: an operator | or closing parenthesis are expected.\n",
+     Arg_kind::None},
+
+    {"Error at line %zu: too many identifiers to write the action %s into a "
+     "command.\n", Arg_kind::Identifier},
+
+    {"Error at line %zu: too many sets of characters to write a set into a "
+     "command.\n", Arg_kind::None},
+
+    {"Error at line %zu: too many identifiers to write the regexp name %s into a "
+     "command.\n", Arg_kind::Identifier}
+};
+
+static_assert(sizeof(diagnostic_infos) / sizeof(diagnostic_infos[0]) ==
+              static_cast<size_t>(Diagnostic_code::Number_of_codes),
+              "There must be one element of diagnostic_infos for every diagnostic code.");
+
+static const char* class_strings[] = {
+    "[:Latin:]",   "[:Letter:]",  "[:Russian:]",
+    "[:bdigits:]", "[:digits:]",  "[:latin:]",
+    "[:letter:]",  "[:odigits:]", "[:russian:]",
+    "[:xdigits:]", "[:ndq:]",     "[:nsq:]"
+};
+
+size_t Diagnostics::add_text(const std::u32string& text)
+{
+    return texts_->insert(text);
+}
+
+void Diagnostics::print(const Diagnostic& d) const
+{
+    const auto& info = diagnostic_infos[static_cast<size_t>(d.code_)];
+    switch(info.arg_kind_){
+        case Arg_kind::Char_class:
+            printf(info.fmt_, d.line_no_, class_strings[d.arg_]);
+            break;
+        case Arg_kind::Text:
+            printf(info.fmt_, d.line_no_, idx_to_string(texts_, d.arg_).c_str());
+            break;
+        case Arg_kind::Identifier:
+            printf(info.fmt_, d.line_no_, idx_to_string(ids_, d.arg_).c_str());
+            break;
+        default:
+            printf(info.fmt_, d.line_no_);
+    }
+}
+
+void Diagnostics::print() const
+{
+    for(const auto& d : records_){
+        print(d);
+    }
+}
@@ -8,17 +8,29 @@
 */
 
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <string>
 #include <memory>
+#include <chrono>
+#include <algorithm>
 #include "../include/get_processed_text.h"
 #include "../include/location.h"
 #include "../include/errors_and_tries.h"
 #include "../include/error_count.h"
+#include "../include/diagnostics.h"
 #include "../include/char_trie.h"
 #include "../include/scope.h"
 #include "../include/expr_scaner.h"
-#include "../include/trie_for_set.h"
+#include "../include/trie_for_set_of_segments.h"
+#include "../include/operations_with_segments.h"
 #include "../include/char_conv.h"
+#include "../include/command.h"
+#include "../include/expr_parser.h"
+#include "../include/expr_lr_tables.h"
+#include "../include/expr_direct_parser.h"
+#include "../include/expr_prec_parser.h"
+#include "../include/expr_source_cache.h"
 
 static const char* usage_str =
     R"~(expr-parser-test, программа для тестирования синтаксического разбора регулярных
@@ -32,13 +44,293 @@ static const char* usage_str =
 без предоставления каких-либо гарантий.
 
 Использование:
-    expr-parser-test файл-с-тестом
+    expr-parser-test [--direct | --precedence] [--true-complements] файл-с-тестом
+    expr-parser-test --benchmark файл-с-тестами [число-повторений]
+    expr-parser-test --compare файл-с-тестами
+
+Ключ --direct означает, что разбор выполняется непосредственно закодированным
+анализатором, а не анализатором, управляемым таблицами. Ключ --precedence означает
+разбор методом восхождения по приоритетам; при ошибке разбор выполняется заново
+анализатором, управляемым таблицами. Ключ --true-complements означает, что дополнения
+[^...^], [:ndq:] и [:nsq:] строятся как классы символов, т.е. как дополнения до
+множества всех кодов Unicode от 0 до 0x10FFFF. Ключ --benchmark означает сравнение скорости
+этих анализаторов: файл содержит записанные подряд выражения, все они разбираются
+каждым анализатором заданное число раз (по умолчанию 100), и проверяется, что все
+анализаторы построили одни и те же команды (также и для нескольких встроенных в
+программу выражений с ошибками). Кроме того, измеряется скорость разбора
+методом восхождения по приоритетам с кэшем: одинаковые выражения разбираются один раз,
+и проверяется, что при ключе --true-complements строятся верные дополнения. Ключ
+--compare означает проверку того, что для записанных подряд выражений из файла
+(как правильных, так и ошибочных) все анализаторы строят те же команды и выдают те
+же диагностические сообщения, что и анализатор, управляемый таблицами.
 )~";
 
 enum Myauka_exit_codes{
-    Success, No_args, File_processing_error, Syntax_error
+    Success, No_args, File_processing_error, Syntax_error, Different_results
+};
+
+enum class Parser_kind{
+    Table_driven, Direct_coded, Precedence_climbing, Cached
+};
+
+struct Parse_result{
+    Command_buffer               commands;
+    size_t                       number_of_errors;
+    std::shared_ptr<Diagnostics> diags;
+    Trie_for_char_segments_ptr   sets;
 };
 
+static bool only_spaces(const char32_t* p)
+{
+    for( ; *p; ++p){
+        if((*p != U' ') && (*p != U'\t') && (*p != U'\n') && (*p != U'\r')){
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Parses the expressions written one after another in the text by the parser of
+ * the kind k; the commands of all expressions are collected in one buffer. */
+static Parse_result parse_all(const std::u32string& text, Parser_kind k,
+                              bool true_complements = false)
+{
+    char32_t*         p      = const_cast<char32_t*>(text.c_str());
+    auto              loc    = std::make_shared<ascaner::Location>(p);
+    Errors_and_tries  et;
+    et.ec_                   = std::make_shared<Error_count>();
+    et.ids_trie_             = std::make_shared<Char_trie>();
+    et.strs_trie_            = std::make_shared<Char_trie>();
+    et.diags_                = std::make_shared<Diagnostics>(et.ids_trie_);
+    auto              scp    = std::make_shared<Scope>();
+    auto              ts     = std::make_shared<Trie_for_char_segments>();
+    auto              exprsc = std::make_shared<escaner::Expr_scaner>(loc, et, ts, scp,
+                                                                      true_complements);
+
+    SLR_act_expr_parser table_parser(exprsc, et, scp, expr_slr_tables);
+    Direct_expr_parser  direct_parser(exprsc, et, scp);
+    Prec_expr_parser    prec_parser(exprsc, et, scp);
+    Cached_expr_parser<Prec_expr_parser> cached_parser(loc, exprsc, et, scp);
+    Parse_result        result;
+    while(!only_spaces(loc->pcurrent_char_)){
+        const char32_t* before = loc->pcurrent_char_;
+        Command_buffer  commands;
+        switch(k){
+            case Parser_kind::Direct_coded:
+                direct_parser.compile(commands);
+                break;
+            case Parser_kind::Precedence_climbing:
+                prec_parser.compile(commands);
+                break;
+            case Parser_kind::Cached:
+                cached_parser.compile(commands);
+                break;
+            default:
+                table_parser.compile(commands);
+        }
+        result.commands.insert(result.commands.end(), commands.begin(), commands.end());
+        if(loc->pcurrent_char_ == before){
+            break;
+        }
+    }
+    result.number_of_errors = et.ec_->get_number_of_errors();
+    result.diags            = et.diags_;
+    result.sets             = ts;
+    return result;
+}
+
+static bool equal_commands(const Command& a, const Command& b)
+{
+    if((a.name_ != b.name_) || (a.action_name_ != b.action_name_)){
+        return false;
+    }
+    switch(a.name_){
+        case Command_name::Char:
+            return a.c_ == b.c_;
+        case Command_name::Char_class:
+        case Command_name::Char_class_complement:
+            return a.idx_of_set_ == b.idx_of_set_;
+        case Command_name::Regexp_name:
+            return a.idx_of_regexp_name_ == b.idx_of_regexp_name_;
+        case Command_name::Kleene:
+        case Command_name::Positive:
+        case Command_name::Optional:
+            return a.args.first_ == b.args.first_;
+        default:
+            return (a.args.first_ == b.args.first_) && (a.args.second_ == b.args.second_);
+    }
+}
+
+using Char_set = operations_with_segments::Set_of_segments<char32_t>;
+
+static bool equal_sets(const Char_set& a, const Char_set& b)
+{
+    return (a.size() == b.size()) &&
+           std::equal(a.begin(), a.end(), b.begin(),
+                      [](const Segment<char32_t>& x, const Segment<char32_t>& y){
+                          return (x.lower_bound == y.lower_bound) &&
+                                 (x.upper_bound == y.upper_bound);
+                      });
+}
+
+/* Checks that the commands of t, built with true complements, are the commands of
+ * c, in which every complement of a set is replaced by the class of characters not
+ * belonging to this set. Since the prefix trees of sets differ, sets are compared
+ * by their contents. */
+static bool are_true_complements(const Parse_result& c, const Parse_result& t)
+{
+    if((c.commands.size() != t.commands.size()) ||
+       (c.number_of_errors != t.number_of_errors))
+    {
+        return false;
+    }
+    for(size_t i = 0; i < c.commands.size(); ++i){
+        const Command& x = c.commands[i];
+        const Command& y = t.commands[i];
+        Char_set       expected;
+        switch(x.name_){
+            case Command_name::Char_class_complement:
+                expected = operations_with_segments::complement(c.sets->get_set(x.idx_of_set_),
+                                                                U'\0', escaner::max_code_point);
+                break;
+            case Command_name::Char_class:
+                expected = c.sets->get_set(x.idx_of_set_);
+                break;
+            default:
+                if(!equal_commands(x, y)){
+                    return false;
+                }
+                continue;
+        }
+        if((y.name_ != Command_name::Char_class) || (x.action_name_ != y.action_name_) ||
+           !equal_sets(expected, t.sets->get_set(y.idx_of_set_)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Compares the diagnostics of two sessions. The arguments of diagnostics are
+ * indices in tries, which are filled in the same order, if the parsers agree. */
+static bool equal_diagnostics(const Diagnostics& a, const Diagnostics& b)
+{
+    const auto& x = a.records();
+    const auto& y = b.records();
+    for(size_t i = 0; i < x.size(); ++i){
+        if((i == y.size()) || (x[i].code_ != y[i].code_) ||
+           (x[i].line_no_ != y[i].line_no_) || (x[i].arg_ != y[i].arg_))
+        {
+            printf("Diagnostic number %zu differs. Expected:\n", i + 1);
+            a.print(x[i]);
+            return false;
+        }
+    }
+    if(x.size() != y.size()){
+        printf("Diagnostic number %zu is extra:\n", x.size() + 1);
+        b.print(y[x.size()]);
+        return false;
+    }
+    return true;
+}
+
+static bool same_results(const Parse_result* results, size_t number_of_parsers)
+{
+    bool same = true;
+    for(size_t k = 1; same && (k < number_of_parsers); ++k){
+        const auto& c0 = results[0].commands;
+        const auto& c1 = results[k].commands;
+        same           = (c0.size() == c1.size()) &&
+                         (results[0].number_of_errors == results[k].number_of_errors);
+        for(size_t i = 0; same && (i < c0.size()); ++i){
+            same = equal_commands(c0[i], c1[i]);
+        }
+    }
+    return same;
+}
+
+static const Parser_kind kinds[]           = {
+    Parser_kind::Table_driven, Parser_kind::Direct_coded, Parser_kind::Precedence_climbing,
+    Parser_kind::Cached
+};
+
+static const char*       names[]           = {
+    "Table-driven parser", "Direct-coded parser", "Precedence climbing parser",
+    "Precedence climbing parser with the cache of sources"
+};
+
+static constexpr size_t  number_of_parsers = 4;
+
+/* Checks that every parser builds the same commands and reports the same
+ * diagnostics on the text as the table-driven parser. */
+static int compare(const std::u32string& text)
+{
+    Parse_result results[2];
+    results[0] = parse_all(text, Parser_kind::Table_driven);
+    bool same  = true;
+    for(size_t i = 1; i < number_of_parsers; ++i){
+        results[1] = parse_all(text, kinds[i]);
+        if(!same_results(results, 2) ||
+           !equal_diagnostics(*results[0].diags, *results[1].diags))
+        {
+            printf("%s differs from the table-driven parser.\n", names[i]);
+            same = false;
+        }
+    }
+    printf("%zu commands, %zu errors, %zu diagnostics.\n", results[0].commands.size(),
+           results[0].number_of_errors, results[0].diags->records().size());
+    puts(same ? "The parsers built the same commands and diagnostics." :
+                "The parsers built different commands or diagnostics.");
+    return same ? Success : Different_results;
+}
+
+static int benchmark(const std::u32string& text, size_t repetitions)
+{
+    using clock = std::chrono::steady_clock;
+    Parse_result results[number_of_parsers];
+    /* The parsers must also agree on these expressions, which contain lexemes
+     * that are not expected anywhere in an expression. */
+    static const std::u32string regression_inputs[] = {
+        U"{^]a}", U"{a^]b}", U"{a|^]}"
+    };
+    bool same = true;
+    for(const auto& input : regression_inputs){
+        for(size_t i = 0; i < number_of_parsers; ++i){
+            results[i] = parse_all(input, kinds[i]);
+        }
+        same = same && same_results(results, number_of_parsers);
+    }
+    for(size_t i = 0; i < number_of_parsers; ++i){
+        auto begin = clock::now();
+        for(size_t r = 0; r < repetitions; ++r){
+            results[i] = parse_all(text, kinds[i]);
+        }
+        std::chrono::duration<double, std::milli> d = clock::now() - begin;
+        /* Diagnostics are formatted outside of the measured time. */
+        results[i].diags->print();
+        printf("%s: %.3f ms per pass, %zu commands, %zu errors.\n",
+               names[i], d.count() / repetitions, results[i].commands.size(),
+               results[i].number_of_errors);
+    }
+    same = same && same_results(results, number_of_parsers);
+    puts(same ? "The parsers built the same commands." :
+                "The parsers built different commands.");
+
+    static const std::u32string complement_inputs[] = {
+        U"{[^a-z^][:ndq:]}", U"{[^\\-[:digits:]^]+|[:nsq:]*}", U"{a[^[:Latin:]_^]?}"
+    };
+    bool complements_ok = are_true_complements(results[0],
+                                               parse_all(text, Parser_kind::Table_driven, true));
+    for(const auto& input : complement_inputs){
+        complements_ok = complements_ok &&
+                         are_true_complements(parse_all(input, Parser_kind::Table_driven),
+                                              parse_all(input, Parser_kind::Table_driven, true));
+    }
+    puts(complements_ok ? "True complements are the complements of excluded sets." :
+                          "True complements differ from the complements of excluded sets.");
+    return (same && complements_ok) ? Success : Different_results;
+}
+
 // static void add_regexp_name(Errors_and_tries&       etr,
 //                             std::shared_ptr<Scope>& scope,
 //                             const std::u32string&   name)
@@ -68,14 +360,47 @@ enum Myauka_exit_codes{
 
 int main(int argc, char* argv[])
 {
-    if(1 == argc){
+    Parser_kind kind             = Parser_kind::Table_driven;
+    bool        bench            = false;
+    bool        comparison       = false;
+    bool        true_complements = false;
+    size_t      repetitions      = 100;
+    int         arg_idx          = 1;
+    if((argc > 1) && !strcmp(argv[1], "--direct")){
+        kind = Parser_kind::Direct_coded;
+        arg_idx++;
+    }else if((argc > 1) && !strcmp(argv[1], "--precedence")){
+        kind = Parser_kind::Precedence_climbing;
+        arg_idx++;
+    }else if((argc > 1) && !strcmp(argv[1], "--benchmark")){
+        bench = true;
+        arg_idx++;
+        if(argc > arg_idx + 1){
+            repetitions = strtoul(argv[arg_idx + 1], nullptr, 10);
+            repetitions = repetitions ? repetitions : 1;
+        }
+    }else if((argc > 1) && !strcmp(argv[1], "--compare")){
+        comparison = true;
+        arg_idx++;
+    }
+    if(!bench && !comparison && (argc > arg_idx) && !strcmp(argv[arg_idx], "--true-complements")){
+        true_complements = true;
+        arg_idx++;
+    }
+    if(argc <= arg_idx){
         printf(usage_str, argv[0]);
         return No_args;
     }
-    auto              text   = get_processed_text(argv[1]);
+    auto              text   = get_processed_text(argv[arg_idx]);
     if(!text.length()){
         return File_processing_error;
     }
+    if(bench){
+        return benchmark(text, repetitions);
+    }
+    if(comparison){
+        return compare(text);
+    }
 
     char32_t*         p      = const_cast<char32_t*>(text.c_str());
     auto              loc    = std::make_shared<ascaner::Location>(p);
@@ -83,11 +408,27 @@ int main(int argc, char* argv[])
     et.ec_                   = std::make_shared<Error_count>();
     et.ids_trie_             = std::make_shared<Char_trie>();
     et.strs_trie_            = std::make_shared<Char_trie>();
+    et.diags_                = std::make_shared<Diagnostics>(et.ids_trie_);
     auto              scp    = std::make_shared<Scope>();
 
 //     add_regexp_names(et, scp);
-    auto              ts     = std::make_shared<Trie_for_set_of_char32>();
-    auto              exprsc = std::make_shared<escaner::Expr_scaner>(loc, et, ts, scp);
+    auto              ts     = std::make_shared<Trie_for_char_segments>();
+    auto              exprsc = std::make_shared<escaner::Expr_scaner>(loc, et, ts, scp,
+                                                                      true_complements);
+
+    Command_buffer      commands;
+    if(Parser_kind::Direct_coded == kind){
+        Direct_expr_parser  parser(exprsc, et, scp);
+        parser.compile(commands);
+    }else if(Parser_kind::Precedence_climbing == kind){
+        Prec_expr_parser    parser(exprsc, et, scp);
+        parser.compile(commands);
+    }else{
+        SLR_act_expr_parser parser(exprsc, et, scp, expr_slr_tables);
+        parser.compile(commands);
+    }
 
-    return Success;
+    et.diags_->print();
+    et.ec_->print();
+    return et.ec_->get_number_of_errors() ? Syntax_error : Success;
 }
\ No newline at end of file
@@ -0,0 +1,343 @@
+/*
+    File:    expr_direct_parser.cpp
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+
+/* This file is generated by the script tools/gen_lr_tables.py from the grammar
+ * tools/expr_grammar.txt (SLR, the direct-coded parser). Do not edit it by hand. */
+
+#include "../include/expr_direct_parser.h"
+
+static_assert(Expr_grammar_traits::number_of_terminals == 9,
+              "The number of terminals does not match the traits of the grammar.");
+static_assert(Expr_grammar_traits::number_of_non_terminals == 6,
+              "The number of non-terminals does not match the traits of the grammar.");
+
+/* Terminals:     $ a b c d p q ( )
+ * Non-terminals: S T E F G H */
+
+void Direct_expr_parser::compile(Command_buffer& buf)
+{
+    Action_type pai;
+    start(buf);
+
+state_0:
+    current_state = 0;
+    read_lexeme();
+    switch(static_cast<size_t>(t)){
+        case 5 /* p */:
+            shift_to(2); goto state_2;
+        default:
+            goto error;
+    }
+
+state_1:
+    current_state = 1;
+    read_lexeme();
+    goto accept;
+
+state_2:
+    current_state = 2;
+    read_lexeme();
+    switch(static_cast<size_t>(t)){
+        case 4 /* d */:
+            shift_to(8); goto state_8;
+        case 7 /* ( */:
+            shift_to(9); goto state_9;
+        default:
+            goto error;
+    }
+
+state_3:
+    current_state = 3;
+    read_lexeme();
+    switch(static_cast<size_t>(t)){
+        case 2 /* b */:
+            shift_to(10); goto state_10;
+        case 6 /* q */:
+            shift_to(11); goto state_11;
+        default:
+            goto error;
+    }
+
+state_4:
+    current_state = 4;
+    read_lexeme();
+    switch(static_cast<size_t>(t)){
+        case 2 /* b */:
+        case 6 /* q */:
+        case 8 /* ) */:
+            return_lookahead(); goto reduce_T_is_E;
+        case 4 /* d */:
+            shift_to(8); goto state_8;
+        case 7 /* ( */:
+            shift_to(9); goto state_9;
+        default:
+            goto error;
+    }
+
+state_5:
+    current_state = 5;
+    goto reduce_E_is_F;
+
+state_6:
+    current_state = 6;
+    read_lexeme();
+    switch(static_cast<size_t>(t)){
+        case 0 /* $ */:
+        case 1 /* a */:
+        case 5 /* p */:
+            goto error;
+        case 3 /* c */:
+            shift_to(13); goto state_13;
+        default:
+            return_lookahead(); goto reduce_F_is_G;
+    }
+
+state_7:
+    current_state = 7;
+    read_lexeme();
+    switch(static_cast<size_t>(t)){
+        case 0 /* $ */:
+        case 5 /* p */:
+            goto error;
+        case 1 /* a */:
+            shift_to(14); goto state_14;
+        default:
+            return_lookahead(); goto reduce_G_is_H;
+    }
+
+state_8:
+    current_state = 8;
+    goto reduce_H_is_d;
+
+state_9:
+    current_state = 9;
+    read_lexeme();
+    switch(static_cast<size_t>(t)){
+        case 4 /* d */:
+            shift_to(8); goto state_8;
+        case 7 /* ( */:
+            shift_to(9); goto state_9;
+        default:
+            goto error;
+    }
+
+state_10:
+    current_state = 10;
+    read_lexeme();
+    switch(static_cast<size_t>(t)){
+        case 4 /* d */:
+            shift_to(8); goto state_8;
+        case 7 /* ( */:
+            shift_to(9); goto state_9;
+        default:
+            goto error;
+    }
+
+state_11:
+    current_state = 11;
+    goto reduce_S_is_pTq;
+
+state_12:
+    current_state = 12;
+    goto reduce_E_is_EF;
+
+state_13:
+    current_state = 13;
+    goto reduce_F_is_Gc;
+
+state_14:
+    current_state = 14;
+    goto reduce_G_is_Ha;
+
+state_15:
+    current_state = 15;
+    read_lexeme();
+    switch(static_cast<size_t>(t)){
+        case 2 /* b */:
+            shift_to(10); goto state_10;
+        case 8 /* ) */:
+            shift_to(17); goto state_17;
+        default:
+            goto error;
+    }
+
+state_16:
+    current_state = 16;
+    read_lexeme();
+    switch(static_cast<size_t>(t)){
+        case 2 /* b */:
+        case 6 /* q */:
+        case 8 /* ) */:
+            return_lookahead(); goto reduce_T_is_TbE;
+        case 4 /* d */:
+            shift_to(8); goto state_8;
+        case 7 /* ( */:
+            shift_to(9); goto state_9;
+        default:
+            goto error;
+    }
+
+state_17:
+    current_state = 17;
+    goto reduce_H_is_LP_T_RP;
+
+reduce_S_is_pTq:
+    reduce_by(S_is_pTq, 3);
+    state_stack.push(1); goto state_1;
+
+reduce_T_is_TbE:
+    reduce_by(T_is_TbE, 3);
+    switch(state_stack.top()){
+        case 9:
+            state_stack.push(15); goto state_15;
+        default:
+            state_stack.push(3); goto state_3;
+    }
+
+reduce_T_is_E:
+    reduce_by(T_is_E, 1);
+    switch(state_stack.top()){
+        case 9:
+            state_stack.push(15); goto state_15;
+        default:
+            state_stack.push(3); goto state_3;
+    }
+
+reduce_E_is_EF:
+    reduce_by(E_is_EF, 2);
+    switch(state_stack.top()){
+        case 10:
+            state_stack.push(16); goto state_16;
+        default:
+            state_stack.push(4); goto state_4;
+    }
+
+reduce_E_is_F:
+    reduce_by(E_is_F, 1);
+    switch(state_stack.top()){
+        case 10:
+            state_stack.push(16); goto state_16;
+        default:
+            state_stack.push(4); goto state_4;
+    }
+
+reduce_F_is_Gc:
+    reduce_by(F_is_Gc, 2);
+    switch(state_stack.top()){
+        case 4:
+        case 16:
+            state_stack.push(12); goto state_12;
+        default:
+            state_stack.push(5); goto state_5;
+    }
+
+reduce_F_is_G:
+    reduce_by(F_is_G, 1);
+    switch(state_stack.top()){
+        case 4:
+        case 16:
+            state_stack.push(12); goto state_12;
+        default:
+            state_stack.push(5); goto state_5;
+    }
+
+reduce_G_is_Ha:
+    reduce_by(G_is_Ha, 2);
+    state_stack.push(6); goto state_6;
+
+reduce_G_is_H:
+    reduce_by(G_is_H, 1);
+    state_stack.push(6); goto state_6;
+
+reduce_H_is_d:
+    reduce_by(H_is_d, 1);
+    state_stack.push(7); goto state_7;
+
+reduce_H_is_LP_T_RP:
+    reduce_by(H_is_LP_T_RP, 3);
+    state_stack.push(7); goto state_7;
+
+error:
+    pai = error_hadling(current_state);
+    switch(static_cast<Parser_action_name>(pai.kind)){
+        case Parser_action_name::Shift:
+            shift_to(pai.arg);
+            switch(pai.arg){
+                case 0:
+                    goto state_0;
+                case 1:
+                    goto state_1;
+                case 2:
+                    goto state_2;
+                case 3:
+                    goto state_3;
+                case 4:
+                    goto state_4;
+                case 5:
+                    goto state_5;
+                case 6:
+                    goto state_6;
+                case 7:
+                    goto state_7;
+                case 8:
+                    goto state_8;
+                case 9:
+                    goto state_9;
+                case 10:
+                    goto state_10;
+                case 11:
+                    goto state_11;
+                case 12:
+                    goto state_12;
+                case 13:
+                    goto state_13;
+                case 14:
+                    goto state_14;
+                case 15:
+                    goto state_15;
+                case 16:
+                    goto state_16;
+                default:
+                    goto state_17;
+            }
+        case Parser_action_name::Reduce:
+            return_lookahead();
+            /* The reduction itself is the same as for Reduce_without_back. */
+            [[fallthrough]];
+        case Parser_action_name::Reduce_without_back:
+            switch(pai.arg){
+                case S_is_pTq:
+                    goto reduce_S_is_pTq;
+                case T_is_TbE:
+                    goto reduce_T_is_TbE;
+                case T_is_E:
+                    goto reduce_T_is_E;
+                case E_is_EF:
+                    goto reduce_E_is_EF;
+                case E_is_F:
+                    goto reduce_E_is_F;
+                case F_is_Gc:
+                    goto reduce_F_is_Gc;
+                case F_is_G:
+                    goto reduce_F_is_G;
+                case G_is_Ha:
+                    goto reduce_G_is_Ha;
+                case G_is_H:
+                    goto reduce_G_is_H;
+                case H_is_d:
+                    goto reduce_H_is_d;
+                default:
+                    goto reduce_H_is_LP_T_RP;
+            }
+        default:
+            goto accept;
+    }
+
+accept:
+    finish();
+}
@@ -0,0 +1,104 @@
+/*
+    File:    expr_lr_tables.cpp
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+
+/* This file is generated by the script tools/gen_lr_tables.py from the grammar
+ * tools/expr_grammar.txt (SLR, the layout dense). Do not edit it by hand. */
+
+#include <cstdint>
+#include <type_traits>
+#include "../include/expr_lr_tables.h"
+
+static_assert(Expr_grammar_traits::table_layout == Table_layout::Dense,
+              "The layout of tables does not match the traits of the grammar.");
+static_assert(std::is_same<Expr_grammar_traits::State_t, uint8_t>::value &&
+              std::is_same<Expr_grammar_traits::Action_info_t, Parser_action_info>::value,
+              "The encoding of tables does not match the traits of the grammar.");
+static_assert(Expr_grammar_traits::number_of_terminals == 9,
+              "The number of terminals does not match the traits of the grammar.");
+static_assert(Expr_grammar_traits::number_of_non_terminals == 6,
+              "The number of non-terminals does not match the traits of the grammar.");
+
+static const Rule_info<Non_terminal> rules[] = {
+    {Non_terminal::Nt_S, 3}, {Non_terminal::Nt_T, 3}, {Non_terminal::Nt_T, 1},
+    {Non_terminal::Nt_E, 2}, {Non_terminal::Nt_E, 1}, {Non_terminal::Nt_F, 2},
+    {Non_terminal::Nt_F, 1}, {Non_terminal::Nt_G, 2}, {Non_terminal::Nt_G, 1},
+    {Non_terminal::Nt_H, 1}, {Non_terminal::Nt_H, 3}
+};
+
+/* Terminals:     $ a b c d p q ( )
+ * Non-terminals: S T E F G H */
+
+/* Reductions performed without reading a lookahead; ERR means that the state has
+ * no such reduction. */
+static const Parser_action_info default_actions[] = {
+    ERR, ERR, ERR, ERR, ERR, REDUCE(E_is_F), ERR, ERR, REDUCE(H_is_d), ERR, ERR,
+    REDUCE(S_is_pTq), REDUCE(E_is_EF), REDUCE(F_is_Gc), REDUCE(G_is_Ha), ERR, ERR,
+    REDUCE(H_is_LP_T_RP)
+};
+
+static const uint8_t goto_values[] = {
+    /*  0 */ 1, 0, 0, 0, 0, 0,
+    /*  1 */ 0, 0, 0, 0, 0, 0,
+    /*  2 */ 0, 3, 4, 5, 6, 7,
+    /*  3 */ 0, 0, 0, 0, 0, 0,
+    /*  4 */ 0, 0, 0, 12, 6, 7,
+    /*  5 */ 0, 0, 0, 0, 0, 0,
+    /*  6 */ 0, 0, 0, 0, 0, 0,
+    /*  7 */ 0, 0, 0, 0, 0, 0,
+    /*  8 */ 0, 0, 0, 0, 0, 0,
+    /*  9 */ 0, 15, 4, 5, 6, 7,
+    /* 10 */ 0, 0, 16, 5, 6, 7,
+    /* 11 */ 0, 0, 0, 0, 0, 0,
+    /* 12 */ 0, 0, 0, 0, 0, 0,
+    /* 13 */ 0, 0, 0, 0, 0, 0,
+    /* 14 */ 0, 0, 0, 0, 0, 0,
+    /* 15 */ 0, 0, 0, 0, 0, 0,
+    /* 16 */ 0, 0, 0, 12, 6, 7,
+    /* 17 */ 0, 0, 0, 0, 0, 0
+};
+
+static const Parser_action_info action_values[] = {
+    /*  0 */ ERR, ERR, ERR, ERR, ERR, SHIFT(2), ERR, ERR, ERR,
+    /*  1 */ ACCESS, ACCESS, ACCESS, ACCESS, ACCESS, ACCESS, ACCESS, ACCESS, ACCESS,
+    /*  2 */ ERR, ERR, ERR, ERR, SHIFT(8), ERR, ERR, SHIFT(9), ERR,
+    /*  3 */ ERR, ERR, SHIFT(10), ERR, ERR, ERR, SHIFT(11), ERR, ERR,
+    /*  4 */ ERR, ERR, REDUCE(T_is_E), ERR, SHIFT(8), ERR, REDUCE(T_is_E), SHIFT(9),
+             REDUCE(T_is_E),
+    /*  5 */ ERR, ERR, REDUCE(E_is_F), ERR, REDUCE(E_is_F), ERR, REDUCE(E_is_F),
+             REDUCE(E_is_F), REDUCE(E_is_F),
+    /*  6 */ ERR, ERR, REDUCE(F_is_G), SHIFT(13), REDUCE(F_is_G), ERR, REDUCE(F_is_G),
+             REDUCE(F_is_G), REDUCE(F_is_G),
+    /*  7 */ ERR, SHIFT(14), REDUCE(G_is_H), REDUCE(G_is_H), REDUCE(G_is_H), ERR,
+             REDUCE(G_is_H), REDUCE(G_is_H), REDUCE(G_is_H),
+    /*  8 */ ERR, REDUCE(H_is_d), REDUCE(H_is_d), REDUCE(H_is_d), REDUCE(H_is_d), ERR,
+             REDUCE(H_is_d), REDUCE(H_is_d), REDUCE(H_is_d),
+    /*  9 */ ERR, ERR, ERR, ERR, SHIFT(8), ERR, ERR, SHIFT(9), ERR,
+    /* 10 */ ERR, ERR, ERR, ERR, SHIFT(8), ERR, ERR, SHIFT(9), ERR,
+    /* 11 */ REDUCE(S_is_pTq), REDUCE(S_is_pTq), REDUCE(S_is_pTq), REDUCE(S_is_pTq),
+             REDUCE(S_is_pTq), REDUCE(S_is_pTq), REDUCE(S_is_pTq), REDUCE(S_is_pTq),
+             REDUCE(S_is_pTq),
+    /* 12 */ ERR, ERR, REDUCE(E_is_EF), ERR, REDUCE(E_is_EF), ERR, REDUCE(E_is_EF),
+             REDUCE(E_is_EF), REDUCE(E_is_EF),
+    /* 13 */ ERR, ERR, REDUCE(F_is_Gc), ERR, REDUCE(F_is_Gc), ERR, REDUCE(F_is_Gc),
+             REDUCE(F_is_Gc), REDUCE(F_is_Gc),
+    /* 14 */ ERR, ERR, REDUCE(G_is_Ha), REDUCE(G_is_Ha), REDUCE(G_is_Ha), ERR,
+             REDUCE(G_is_Ha), REDUCE(G_is_Ha), REDUCE(G_is_Ha),
+    /* 15 */ ERR, ERR, SHIFT(10), ERR, ERR, ERR, ERR, ERR, SHIFT(17),
+    /* 16 */ ERR, ERR, REDUCE(T_is_TbE), ERR, SHIFT(8), ERR, REDUCE(T_is_TbE), SHIFT(9),
+             REDUCE(T_is_TbE),
+    /* 17 */ ERR, REDUCE(H_is_LP_T_RP), REDUCE(H_is_LP_T_RP), REDUCE(H_is_LP_T_RP),
+             REDUCE(H_is_LP_T_RP), ERR, REDUCE(H_is_LP_T_RP), REDUCE(H_is_LP_T_RP),
+             REDUCE(H_is_LP_T_RP)
+};
+
+const LR_parser_tables<Expr_grammar_traits> expr_slr_tables = {
+    rules,
+    {goto_values,   nullptr, nullptr},
+    {action_values, nullptr, nullptr},
+    default_actions
+};
@@ -14,7 +14,6 @@
 #include "../include/belongs.h"
 #include "../include/expr_lexem_info.h"
 #include "../include/expr_traits.h"
-#include "../include/idx_to_string.h"
 
 static const Terminal lexem2terminal_map[] = {
     Terminal::End_of_text, Terminal::End_of_text, Terminal::Term_a,
@@ -24,9 +23,15 @@ static const Terminal lexem2terminal_map[] = {
     Terminal::Term_q,      Terminal::Term_d,      Terminal::Term_d
 };
 
+static constexpr size_t number_of_lexem_codes =
+    sizeof(lexem2terminal_map) / sizeof(lexem2terminal_map[0]);
+
+/* A lexeme with an unknown code is treated as the unknown lexeme, i.e. as the end
+ * of text, so a parser reports a syntax error and stops at it. */
 Terminal SLR_act_expr_parser::lexem2terminal(const escaner::Expr_token& l)
 {
-    return lexem2terminal_map[static_cast<uint16_t>(l.lexeme_.code_)];
+    size_t code = static_cast<uint16_t>(l.lexeme_.code_);
+    return (code < number_of_lexem_codes) ? lexem2terminal_map[code] : Terminal::End_of_text;
 }
 
 /* Grammar rules:
@@ -52,45 +57,6 @@ Terminal SLR_act_expr_parser::lexem2terminal(const escaner::Expr_token& l)
  * curly bracket), q means } (closing curly bracket).
  */
 
-// static const char* opening_curly_brace_is_expected =
-//     "An opening curly brace is expected at line %zu.\n";
-//
-// static const char* char_or_char_class_expected =
-//     "A character, a character class, or an opening parenthesis are "
-//     "expected at line %zu.\n";
-//
-// static const char* or_operator_or_brace_expected =
-//     "An operator | or closing brace are expected at line %zu.\n";
-//
-// static const char* unexpected_action =
-//     "Unexpected action at line %zu.\n";
-//
-// static const char* unexpected_postfix_operator =
-//     "Unexpected postfix operator at line %zu.\n";
-//
-// static const char* unexpected_end_of_text =
-//     "Unexpected end of text at line %zu.\n";
-//
-// static const char* unexpected_opening_brace =
-//     "Unexpected opening brace at line %zu.\n";
-//
-// static const char* or_operator_or_round_br_closed =
-//     "An operator | or closing parenthesis are expected at line %zu.\n";
-//
-SLR_act_expr_parser::Attrib_calculator SLR_act_expr_parser::attrib_calculator[] = {
-    &SLR_act_expr_parser::attrib_by_S_is_pTq,
-    &SLR_act_expr_parser::attrib_by_T_is_TbE,
-    &SLR_act_expr_parser::attrib_by_T_is_E,
-    &SLR_act_expr_parser::attrib_by_E_is_EF,
-    &SLR_act_expr_parser::attrib_by_E_is_F,
-    &SLR_act_expr_parser::attrib_by_F_is_Gc,
-    &SLR_act_expr_parser::attrib_by_F_is_G,
-    &SLR_act_expr_parser::attrib_by_G_is_Ha,
-    &SLR_act_expr_parser::attrib_by_G_is_H,
-    &SLR_act_expr_parser::attrib_by_H_is_d,
-    &SLR_act_expr_parser::attrib_by_H_is_LP_T_RP
-};
-
 SLR_act_expr_parser::Error_handler SLR_act_expr_parser::error_hadler[] = {
     &SLR_act_expr_parser::state00_error_handler, // 0  +
     &SLR_act_expr_parser::state01_error_handler, // 1  +
@@ -129,16 +95,16 @@ void SLR_act_expr_parser::generate_E_is_EF()
 {
     Command com;
     com.name_        = Command_name::Concat;
-    com.args.first_  = rule_body[0].attr.indeces.end_index;
-    com.args.second_ = rule_body[1].attr.indeces.end_index;
+    com.args.first_  = rule_body[0].indeces.end_index;
+    com.args.second_ = rule_body[1].indeces.end_index;
     com.action_name_ = 0;
-    buf_.push_back(com);
+    buf_->push_back(com);
 }
 
 void SLR_act_expr_parser::generate_by_F_is_Gc()
 {
     Command com;
-    switch(rule_body[1].attr.li.lexeme_.code_){
+    switch(rule_body[1].li.code_){
         case escaner::Expr_lexem_code::Kleene_closure:
             com.name_ = Command_name::Kleene;
             break;
@@ -151,121 +117,101 @@ void SLR_act_expr_parser::generate_by_F_is_Gc()
         default:
             ;
     }
-    com.args.first_  = rule_body[0].attr.indeces.end_index;
+    com.args.first_  = rule_body[0].indeces.end_index;
     com.args.second_ = 0;
     com.action_name_ = 0;
-    buf_.push_back(com);
+    buf_->push_back(com);
+}
+
+/* Returns idx, if it does not exceed max_idx. Otherwise reports the error code
+ * and returns zero, so a truncated index never gets into a command. */
+size_t SLR_act_expr_parser::checked_index(size_t idx, size_t max_idx, Diagnostic_code code)
+{
+    if(idx <= max_idx){
+        return idx;
+    }
+    et_.diags_->add(code, li.range_.begin_pos_.line_no_, idx);
+    et_.ec_ -> increment_number_of_errors();
+    return 0;
 }
 
 void SLR_act_expr_parser::generate_by_H_is_d()
 {
     Command com;
-    switch(rule_body[0].attr.li.lexeme_.code_){
+    switch(rule_body[0].li.code_){
         case escaner::Expr_lexem_code::Character:
             com.name_        = Command_name::Char;
-            com.c_           = rule_body[0].attr.li.lexeme_.c_;
+            com.c_           = rule_body[0].li.c_;
             break;
         case escaner::Expr_lexem_code::Class_complement:
             com.name_        = Command_name::Char_class_complement;
-            com.idx_of_set_  = rule_body[0].attr.li.lexeme_.index_of_set_of_char_;
+            com.idx_of_set_  = checked_index(rule_body[0].li.index_of_set_of_char_,
+                                             max_set_index,
+                                             Diagnostic_code::Too_large_set_index);
             break;
         case escaner::Expr_lexem_code::Character_class:
             com.name_        = Command_name::Char_class;
-            com.idx_of_set_  = rule_body[0].attr.li.lexeme_.index_of_set_of_char_;
+            com.idx_of_set_  = checked_index(rule_body[0].li.index_of_set_of_char_,
+                                             max_set_index,
+                                             Diagnostic_code::Too_large_set_index);
+            break;
+        case escaner::Expr_lexem_code::Regexp_name:
+            /* The reference to a named regexp is a link to its commands, which are
+             * compiled once (see Regexp_registry). */
+            com.name_               = Command_name::Regexp_name;
+            com.idx_of_regexp_name_ =
+                checked_index(rule_body[0].li.regexp_name_index_, max_regexp_name_index,
+                              Diagnostic_code::Too_large_regexp_name_index);
             break;
         default:
             ;
     }
     com.action_name_ = 0;
-    buf_.push_back(com);
+    buf_->push_back(com);
 }
 
-enum Msg_kind{
-    Undefined_action,                It_is_not_action,
-    Opening_curly_brace_is_expected, Char_or_char_class_expected,
-    Or_operator_or_brace_expected,   Unexpected_action,
-    Unexpected_postfix_operator,     Unexpected_end_of_text,
-    Unexpected_opening_brace,        Or_operator_or_round_br_closed
-};
-
-static const char* msgs[] = {
-    "Error at line %zu: the action %s is not defined.\n",
-
-    "Error at line %zu: the identifier %s is not an action.\n",
-
-    "Error at line %zu: an opening curly brace is expected.\n",
-
-    "Error at line %zu: a character, a character class, or an "
-    "opening parenthesis are expected.\n",
-
-    "Error at line %zu: an operator | or closing brace are expected.\n",
-
-    "Error at line %zu: an unexpected action.\n",
-
-    "Error at line %zu: an unexpected postfix operator.\n",
-
-    "Error at line %zu: an unexpected end of text.\n",
-
-    "Error at line %zu: an unexpected opening brace.\n",
-
-    "Error at line %zu: an operator | or closing parenthesis are expected.\n"
-};
-
-template<typename... T>
-void print_diagnostic(const char* fmt, T... args)
+bool SLR_act_expr_parser::is_defined_action(size_t act_index) const
 {
-    printf(fmt, args...);
+    auto it = scope_->idsc_.find(act_index);
+    return (it != scope_->idsc_.end()) &&
+           (it->second.kind_ == static_cast<std::uint8_t>(Id_kind::Action_name));
 }
 
 void SLR_act_expr_parser::generate_by_G_is_Ha()
 {
     Id_scope::iterator it;
     size_t             act_index;
-    size_t             min_index;
-    size_t             max_index;
     /* If the action a is not yet defined, then we display an error message and
         * assume that no action is specified. Otherwise, write down the index of
-        * the action name. */
-    act_index = rule_body[1].attr.li.lexeme_.action_name_index_;
+        * the action name into the last command of the subexpression; the function
+        * resolve_actions() spreads it over the other commands. */
+    act_index = rule_body[1].li.action_name_index_;
     it        = scope_->idsc_.find(act_index);
     if(it == scope_->idsc_.end()){
-        auto s = idx_to_string(et_.ids_trie_, act_index);
-        print_diagnostic(msgs[Undefined_action],
-                         li.range_.begin_pos_.line_no_,
-                         s.c_str());
-//         printf("The action ");
-//         et_.ids_trie_->print(act_index);
-//         printf(" is not defined at line %zu.\n",
-//                 scaner->lexem_begin_line_number());
+        et_.diags_->add(Diagnostic_code::Undefined_action,
+                        li.range_.begin_pos_.line_no_,
+                        act_index);
         et_.ec_ -> increment_number_of_errors();
         return;
     } else if(it->second.kind_ != static_cast<std::uint8_t>(Id_kind::Action_name)){
-        auto s = idx_to_string(et_.ids_trie_, act_index);
-        print_diagnostic(msgs[It_is_not_action],
-                         li.range_.begin_pos_.line_no_,
-                         s.c_str());
-//         printf("The identifier ");
-//         et_.ids_trie_->print(act_index);
-//         printf(" is not action name at line %zu.\n",
-//                 scaner->lexem_begin_line_number());
+        et_.diags_->add(Diagnostic_code::It_is_not_action,
+                        li.range_.begin_pos_.line_no_,
+                        act_index);
         et_.ec_ -> increment_number_of_errors();
         return;
     };
-    min_index = rule_body[0].attr.indeces.begin_index;
-    max_index = rule_body[0].attr.indeces.end_index + 1;
-    for(size_t i = min_index; i < max_index; i++){
-        buf_[i].action_name_ = act_index;
-    }
+    (*buf_)[rule_body[0].indeces.end_index].action_name_ =
+        checked_index(act_index, max_action_name_index, Diagnostic_code::Too_large_action_index);
 }
 
 void SLR_act_expr_parser::generate_by_T_is_TbE()
 {
     Command com;
     com.name_        = Command_name::Or;
-    com.args.first_  = rule_body[0].attr.indeces.end_index;
-    com.args.second_ = rule_body[2].attr.indeces.end_index;
+    com.args.first_  = rule_body[0].indeces.end_index;
+    com.args.second_ = rule_body[2].indeces.end_index;
     com.action_name_ = 0;
-    buf_.push_back(com);
+    buf_->push_back(com);
 }
 
 void SLR_act_expr_parser::generate_command(Rule r)
@@ -297,160 +243,205 @@ void SLR_act_expr_parser::generate_command(Rule r)
 }
 
 /* Functions for calculating of attributes: */
-Attributes<escaner::Expr_token> SLR_act_expr_parser::attrib_by_S_is_pTq()
+SLR_act_expr_parser::Attrib_type SLR_act_expr_parser::attrib_by_S_is_pTq()
 {
-    return rule_body[1].attr;
+    return rule_body[1];
 }
 
-Attributes<escaner::Expr_token> SLR_act_expr_parser::attrib_by_T_is_TbE()
+SLR_act_expr_parser::Attrib_type SLR_act_expr_parser::attrib_by_T_is_TbE()
 {
-    Attributes<escaner::Expr_token> s = rule_body[0].attr;
-    s.indeces.end_index = buf_.size() - 1;
+    Attrib_type s = rule_body[0];
+    s.indeces.end_index = buf_->size() - 1;
     return s;
 }
 
-Attributes<escaner::Expr_token> SLR_act_expr_parser::attrib_by_T_is_E()
+SLR_act_expr_parser::Attrib_type SLR_act_expr_parser::attrib_by_T_is_E()
 {
-    return rule_body[0].attr;
+    return rule_body[0];
 }
 
-Attributes<escaner::Expr_token> SLR_act_expr_parser::attrib_by_E_is_EF()
+SLR_act_expr_parser::Attrib_type SLR_act_expr_parser::attrib_by_E_is_EF()
 {
-    Attributes<escaner::Expr_token> s = rule_body[0].attr;
-    s.indeces.end_index = buf_.size() - 1;
+    Attrib_type s = rule_body[0];
+    s.indeces.end_index = buf_->size() - 1;
     return s;
 }
 
-Attributes<escaner::Expr_token> SLR_act_expr_parser::attrib_by_E_is_F()
+SLR_act_expr_parser::Attrib_type SLR_act_expr_parser::attrib_by_E_is_F()
 {
-    return rule_body[0].attr;
+    return rule_body[0];
 }
 
-Attributes<escaner::Expr_token> SLR_act_expr_parser::attrib_by_F_is_Gc()
+SLR_act_expr_parser::Attrib_type SLR_act_expr_parser::attrib_by_F_is_Gc()
 {
-    Attributes<escaner::Expr_token> s = rule_body[0].attr;
-    s.indeces.end_index = buf_.size() - 1;
+    Attrib_type s = rule_body[0];
+    s.indeces.end_index = buf_->size() - 1;
     return s;
 }
 
-Attributes<escaner::Expr_token> SLR_act_expr_parser::attrib_by_F_is_G()
+SLR_act_expr_parser::Attrib_type SLR_act_expr_parser::attrib_by_F_is_G()
 {
-    return rule_body[0].attr;
+    return rule_body[0];
 }
 
-Attributes<escaner::Expr_token> SLR_act_expr_parser::attrib_by_G_is_Ha()
+SLR_act_expr_parser::Attrib_type SLR_act_expr_parser::attrib_by_G_is_Ha()
 {
-    return rule_body[0].attr;
+    return rule_body[0];
 }
 
-Attributes<escaner::Expr_token> SLR_act_expr_parser::attrib_by_G_is_H()
+SLR_act_expr_parser::Attrib_type SLR_act_expr_parser::attrib_by_G_is_H()
 {
-    return rule_body[0].attr;
+    return rule_body[0];
 }
 
-Attributes<escaner::Expr_token> SLR_act_expr_parser::attrib_by_H_is_d()
+SLR_act_expr_parser::Attrib_type SLR_act_expr_parser::attrib_by_H_is_d()
 {
-    Attributes<escaner::Expr_token> s;
-    s.indeces.begin_index = s.indeces.end_index = buf_.size() - 1;
+    Attrib_type s;
+    s.indeces.begin_index = s.indeces.end_index = buf_->size() - 1;
     return s;
 }
 
-Attributes<escaner::Expr_token> SLR_act_expr_parser::attrib_by_H_is_LP_T_RP(){
-    return rule_body[1].attr;
+SLR_act_expr_parser::Attrib_type SLR_act_expr_parser::attrib_by_H_is_LP_T_RP(){
+    return rule_body[1];
 }
 
-Attributes<escaner::Expr_token> SLR_act_expr_parser::attrib_calc(Rule r)
+SLR_act_expr_parser::Attrib_type SLR_act_expr_parser::attrib_calc(Rule r)
 {
-    return (this->*attrib_calculator[r])();
+    switch(r){
+        case S_is_pTq:
+            return attrib_by_S_is_pTq();
+
+        case T_is_TbE:
+            return attrib_by_T_is_TbE();
+
+        case T_is_E:
+            return attrib_by_T_is_E();
+
+        case E_is_EF:
+            return attrib_by_E_is_EF();
+
+        case E_is_F:
+            return attrib_by_E_is_F();
+
+        case F_is_Gc:
+            return attrib_by_F_is_Gc();
+
+        case F_is_G:
+            return attrib_by_F_is_G();
+
+        case G_is_Ha:
+            return attrib_by_G_is_Ha();
+
+        case G_is_H:
+            return attrib_by_G_is_H();
+
+        case H_is_d:
+            return attrib_by_H_is_d();
+
+        case H_is_LP_T_RP:
+        default:
+            return attrib_by_H_is_LP_T_RP();
+    }
 }
 
 /* Functions for error handling: */
-Parser_action_info SLR_act_expr_parser::state00_error_handler()
-{
-//         auto s = idx_to_string(et_.ids_trie_, act_index);
-//         print_diagnostic(msgs[Undefined_action],
-//                          li.range_.begin_pos_.line_no_,
-//                          s.c_str());
-    print_diagnostic(msgs[Opening_curly_brace_is_expected],
-                     li.range_.begin_pos_.line_no_);
-//     printf(opening_curly_brace_is_expected, scaner->lexem_begin_line_number());
+const char32_t* SLR_act_expr_parser::error_point() const
+{
+    return scaner->read_begin().pcurrent_char_;
+}
+
+void SLR_act_expr_parser::report_once(Diagnostic_code code)
+{
+    const char32_t* p = error_point();
+    if(p == last_error_point_){
+        return;
+    }
+    last_error_point_ = p;
+    et_.diags_->add(code, li.range_.begin_pos_.line_no_);
+    et_.ec_->increment_number_of_errors();
+}
+
+SLR_act_expr_parser::Action_type SLR_act_expr_parser::state00_error_handler()
+{
+    et_.diags_->add(Diagnostic_code::Opening_curly_brace_is_expected,
+                    li.range_.begin_pos_.line_no_);
     et_.ec_->increment_number_of_errors();
+    last_error_point_ = error_point();
     if(li.lexeme_.code_ != escaner::Expr_lexem_code::Closed_round_brack){
-        scaner->back();
+        return_lookahead();
     }
     li.lexeme_.code_ = escaner::Expr_lexem_code::Begin_expression;
-    Parser_action_info pa;
+    Action_type pa;
     pa.kind   = static_cast<uint16_t>(Parser_action_name::Shift); pa.arg = 2;
     return pa;
 }
 
-Parser_action_info SLR_act_expr_parser::state01_error_handler()
+SLR_act_expr_parser::Action_type SLR_act_expr_parser::state01_error_handler()
 {
-    Parser_action_info pa;
+    Action_type pa;
     pa.kind = static_cast<uint16_t>(Parser_action_name::OK); pa.arg = 0;
     return pa;
 }
 
-Parser_action_info SLR_act_expr_parser::state02_error_handler()
+SLR_act_expr_parser::Action_type SLR_act_expr_parser::state02_error_handler()
 {
-    print_diagnostic(msgs[Char_or_char_class_expected],
-                     li.range_.begin_pos_.line_no_);
-//     printf(char_or_char_class_expected, scaner->lexem_begin_line_number());
+    et_.diags_->add(Diagnostic_code::Char_or_char_class_expected,
+                    li.range_.begin_pos_.line_no_);
     et_.ec_->increment_number_of_errors();
-    scaner->back();
+    last_error_point_ = error_point();
+    return_lookahead();
     li.lexeme_.code_ = escaner::Expr_lexem_code::Character;
     li.lexeme_.c_    = 'a';
-    Parser_action_info pa;
+    Action_type pa;
     pa.kind = static_cast<uint16_t>(Parser_action_name::Shift); pa.arg = 8;
     return pa;
 }
 
-Parser_action_info SLR_act_expr_parser::state03_error_handler()
+SLR_act_expr_parser::Action_type SLR_act_expr_parser::state03_error_handler()
 {
-    print_diagnostic(msgs[Or_operator_or_brace_expected],
-                     li.range_.begin_pos_.line_no_);
-//     printf(or_operator_or_brace_expected, scaner->lexem_begin_line_number());
+    et_.diags_->add(Diagnostic_code::Or_operator_or_brace_expected,
+                    li.range_.begin_pos_.line_no_);
     et_.ec_->increment_number_of_errors();
-    if(t != Terminal::Term_p){
-        scaner->back();
+    last_error_point_ = error_point();
+    Action_type pa;
+    pa.kind = static_cast<uint16_t>(Parser_action_name::Shift);
+    if(Terminal::End_of_text == t){
+        /* The closing brace is missing: we assume that it is present. */
+        return_lookahead();
+        li.lexeme_.code_ = escaner::Expr_lexem_code::End_expression;
+        pa.arg           = 11;
+        return pa;
+    }
+    /* An opening brace and an unbalanced closing parenthesis are skipped. */
+    if((t != Terminal::Term_p) && (t != Terminal::Term_RP)){
+        return_lookahead();
     }
     li.lexeme_.code_ = escaner::Expr_lexem_code::Or;
-    Parser_action_info pa;
-    pa.kind = static_cast<uint16_t>(Parser_action_name::Shift); pa.arg = 10;
+    pa.arg           = 10;
     return pa;
 }
 
-Parser_action_info SLR_act_expr_parser::state04_error_handler()
+SLR_act_expr_parser::Action_type SLR_act_expr_parser::state04_error_handler()
 {
     Rule r = static_cast<Rule>(reduce_rules[current_state]);
-    Parser_action_info pa;
+    Action_type pa;
+    pa.kind = static_cast<uint16_t>(Parser_action_name::Reduce); pa.arg = r;
     switch(t){
         case Terminal::Term_a:
-        print_diagnostic(msgs[Unexpected_action],
-                         li.range_.begin_pos_.line_no_);
-//             printf(unexpected_action, scaner->lexem_begin_line_number());
-            pa.kind = static_cast<uint16_t>(Parser_action_name::Reduce); pa.arg = r;
+            report_once(Diagnostic_code::Unexpected_action);
             break;
 
         case Terminal::Term_c:
-            print_diagnostic(msgs[Unexpected_postfix_operator],
-                             li.range_.begin_pos_.line_no_);
-//             printf(unexpected_postfix_operator, scaner->lexem_begin_line_number());
-            pa.kind = static_cast<uint16_t>(Parser_action_name::Reduce); pa.arg = r;
+            report_once(Diagnostic_code::Unexpected_postfix_operator);
             break;
 
         case Terminal::End_of_text:
-            print_diagnostic(msgs[Unexpected_end_of_text],
-                             li.range_.begin_pos_.line_no_);
-//             printf(unexpected_end_of_text, scaner->lexem_begin_line_number());
-            pa.kind = static_cast<uint16_t>(Parser_action_name::Reduce); pa.arg = r;
+            report_once(Diagnostic_code::Unexpected_end_of_text);
             break;
 
         case Terminal::Term_p:
-            print_diagnostic(msgs[Unexpected_opening_brace],
-                             li.range_.begin_pos_.line_no_);
-//             printf(unexpected_opening_brace, scaner->lexem_begin_line_number());
-            pa.kind = static_cast<uint16_t>(Parser_action_name::Reduce_without_back); pa.arg = r;
+            report_once(Diagnostic_code::Unexpected_opening_brace);
+            pa.kind = static_cast<uint16_t>(Parser_action_name::Reduce_without_back);
             break;
 
         default:
@@ -459,30 +450,22 @@ Parser_action_info SLR_act_expr_parser::state04_error_handler()
     return pa;
 }
 
-Parser_action_info SLR_act_expr_parser::state06_error_handler()
+SLR_act_expr_parser::Action_type SLR_act_expr_parser::state06_error_handler()
 {
     Rule r = static_cast<Rule>(reduce_rules[current_state]);
-    Parser_action_info pa;
+    Action_type pa;
+    pa.kind = static_cast<uint16_t>(Parser_action_name::Reduce_without_back); pa.arg = r;
     switch(t){
         case Terminal::Term_a:
-            print_diagnostic(msgs[Unexpected_action],
-                             li.range_.begin_pos_.line_no_);
-//             printf(unexpected_action, scaner->lexem_begin_line_number());
-            pa.kind = static_cast<uint16_t>(Parser_action_name::Reduce_without_back); pa.arg = r;
+            report_once(Diagnostic_code::Unexpected_action);
             break;
 
         case Terminal::Term_p:
-            print_diagnostic(msgs[Unexpected_opening_brace],
-                             li.range_.begin_pos_.line_no_);
-//             printf(unexpected_opening_brace, scaner->lexem_begin_line_number());
-            pa.kind = static_cast<uint16_t>(Parser_action_name::Reduce_without_back); pa.arg = r;
+            report_once(Diagnostic_code::Unexpected_opening_brace);
             break;
 
         case Terminal::End_of_text:
-            print_diagnostic(msgs[Unexpected_end_of_text],
-                             li.range_.begin_pos_.line_no_);
-//             printf(unexpected_end_of_text, scaner->lexem_begin_line_number());
-            pa.kind = static_cast<uint16_t>(Parser_action_name::Reduce_without_back); pa.arg = r;
+            report_once(Diagnostic_code::Unexpected_end_of_text);
             break;
 
         default:
@@ -491,46 +474,54 @@ Parser_action_info SLR_act_expr_parser::state06_error_handler()
     return pa;
 }
 
-Parser_action_info SLR_act_expr_parser::state07_error_handler()
+SLR_act_expr_parser::Action_type SLR_act_expr_parser::state07_error_handler()
 {
     Rule r = static_cast<Rule>(reduce_rules[current_state]);
-    Parser_action_info pa;
+    Action_type pa;
+    pa.kind = static_cast<uint16_t>(Parser_action_name::Reduce_without_back); pa.arg = r;
     if(Terminal::Term_p == t){
-        print_diagnostic(msgs[Unexpected_opening_brace], li.range_.begin_pos_.line_no_);
-//         printf(unexpected_opening_brace, scaner->lexem_begin_line_number());
-        pa.kind = static_cast<uint16_t>(Parser_action_name::Reduce_without_back); pa.arg = r;
+        report_once(Diagnostic_code::Unexpected_opening_brace);
     }else{
-        print_diagnostic(msgs[Unexpected_end_of_text], li.range_.begin_pos_.line_no_);
-//         printf(unexpected_end_of_text, scaner->lexem_begin_line_number());
-        pa.kind = static_cast<uint16_t>(Parser_action_name::Reduce_without_back); pa.arg = r;
+        report_once(Diagnostic_code::Unexpected_end_of_text);
     }
-    et_.ec_->increment_number_of_errors();
     return pa;
 }
 
-Parser_action_info SLR_act_expr_parser::state11_error_handler()
+SLR_act_expr_parser::Action_type SLR_act_expr_parser::state11_error_handler()
 {
-    Parser_action_info pa;
+    Action_type pa;
     pa.kind = static_cast<uint16_t>(Parser_action_name::Reduce); pa.arg = S_is_pTq;
     return pa;
 }
 
-Parser_action_info SLR_act_expr_parser::state15_error_handler()
+SLR_act_expr_parser::Action_type SLR_act_expr_parser::state15_error_handler()
 {
-    print_diagnostic(msgs[Or_operator_or_round_br_closed], li.range_.begin_pos_.line_no_);
-//     printf(or_operator_or_round_br_closed, scaner->lexem_begin_line_number());
+    et_.diags_->add(Diagnostic_code::Or_operator_or_round_br_closed,
+                    li.range_.begin_pos_.line_no_);
     et_.ec_->increment_number_of_errors();
+    last_error_point_ = error_point();
+    Action_type pa;
+    pa.kind = static_cast<uint16_t>(Parser_action_name::Shift);
+    if((Terminal::End_of_text == t) || (Terminal::Term_q == t)){
+        /* The closing parenthesis is missing: we assume that it is present. */
+        return_lookahead();
+        li.lexeme_.code_ = escaner::Expr_lexem_code::Closed_round_brack;
+        pa.arg           = 17;
+        return pa;
+    }
     if(t != Terminal::Term_p){
-        scaner->back();
+        return_lookahead();
     }
     li.lexeme_.code_ = escaner::Expr_lexem_code::Or;
-    Parser_action_info pa;
-    pa.kind = static_cast<uint16_t>(Parser_action_name::Shift); pa.arg = 10;
+    pa.arg           = 10;
     return pa;
 }
 
 
-Parser_action_info SLR_act_expr_parser::error_hadling(size_t s)
+SLR_act_expr_parser::Action_type SLR_act_expr_parser::error_hadling(size_t s)
 {
     return (this->*error_hadler[s])();
-}
\ No newline at end of file
+}
+
+template class Basic_LR_parser<SLR_act_expr_parser, Expr_grammar_traits,
+                               Expr_scaner_traits, Command_buffer>;
@@ -0,0 +1,134 @@
+/*
+    File:    expr_prec_parser.cpp
+    Created: 19 October 2026 at 14:55 Moscow time
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+
+#include "../include/expr_prec_parser.h"
+
+/* Precedences of binary operators: the concatenation has no lexeme, so it is
+ * recognized by the lexeme starting its second operand. Zero means that the lexeme
+ * does not continue the expression. */
+static unsigned binary_precedence(Terminal t)
+{
+    switch(t){
+        case Terminal::Term_b:
+            return 1;
+        case Terminal::Term_d:
+        case Terminal::Term_LP:
+            return 2;
+        default:
+            return 0;
+    }
+}
+
+bool Prec_expr_parser::next()
+{
+    size_t number_of_errors = ec_->get_number_of_errors();
+    li                      = scaner->current_lexeme();
+    t                       = lexem2terminal(li);
+    return ec_->get_number_of_errors() == number_of_errors;
+}
+
+Prec_expr_parser::Attrib_type Prec_expr_parser::reduce_by(Rule r, const Attrib_type* body)
+{
+    rule_body = body;
+    generate_command(r);
+    return attrib_calc(r);
+}
+
+bool Prec_expr_parser::parse_operand(Attrib_type& result)
+{
+    Attrib_type body[2];
+    switch(t){
+        case Terminal::Term_d:
+            body[0].li = li.lexeme_;
+            result     = reduce_by(H_is_d, body);
+            break;
+        case Terminal::Term_LP:
+            if(!next() || !parse_expr(1, result) || (t != Terminal::Term_RP)){
+                return false;
+            }
+            /* The attribute of (T) is the attribute of T. */
+            break;
+        default:
+            return false;
+    }
+    if(!next()){
+        return false;
+    }
+    if(Terminal::Term_a == t){
+        if(!is_defined_action(li.lexeme_.action_name_index_)){
+            return false;
+        }
+        body[0]    = result;
+        body[1].li = li.lexeme_;
+        result     = reduce_by(G_is_Ha, body);
+        if(!next()){
+            return false;
+        }
+    }
+    if(Terminal::Term_c == t){
+        body[0]    = result;
+        body[1].li = li.lexeme_;
+        result     = reduce_by(F_is_Gc, body);
+        if(!next()){
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Prec_expr_parser::parse_expr(unsigned min_prec, Attrib_type& result)
+{
+    if(!parse_operand(result)){
+        return false;
+    }
+    for( ; ; ){
+        unsigned prec = binary_precedence(t);
+        if(!prec || (prec < min_prec)){
+            return true;
+        }
+        bool is_or = Terminal::Term_b == t;
+        if(is_or && !next()){
+            return false;
+        }
+        /* Both operators are left associative. */
+        Attrib_type body[3];
+        if(!parse_expr(prec + 1, body[2])){
+            return false;
+        }
+        body[0] = result;
+        if(is_or){
+            result  = reduce_by(T_is_TbE, body);
+        }else{
+            body[1] = body[2];
+            result  = reduce_by(E_is_EF, body);
+        }
+    }
+}
+
+void Prec_expr_parser::compile(Command_buffer& buf)
+{
+    buf_                = &buf;
+    size_t initial_size = buf.size();
+    scaner->mark();
+    Attrib_type result;
+    bool        ok = next() && (Terminal::Term_p == t) && next() &&
+                     parse_expr(1, result) && (Terminal::Term_q == t);
+    if(!ok){
+        /* The parser stops at the first lexical error, so the lexemes before li
+         * are read again without diagnostics, and li is not read again. */
+        scaner->rescan(li);
+        buf.resize(initial_size);
+        SLR_act_expr_parser::compile(buf);
+        return;
+    }
+    /* As the SLR parser does, the lexeme after the expression is read and returned
+     * into the text. */
+    scaner->current_lexeme();
+    scaner->back();
+}
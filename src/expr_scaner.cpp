@@ -14,10 +14,49 @@
 #include "../include/belongs.h"
 #include "../include/aux_expr_lexem.h"
 #include "../include/print_char32.h"
-#include "../include/operations_with_sets.h"
+#include "../include/operations_with_segments.h"
+#include "../include/unicode_categories.h"
 
 namespace escaner{
     Expr_token Expr_scaner::current_lexeme()
+    {
+        read_begin_pos_ = loc_->pos_;
+        if(has_pending_ && (loc_->pcurrent_char_ == pending_read_begin_)){
+            has_pending_  = false;
+            read_begin_   = pending_read_begin_;
+            lexeme_begin_ = pending_lexeme_begin_;
+            lexeme_pos_   = pending_lexeme_pos_;
+            *loc_         = pending_end_;
+            return pending_token_;
+        }
+        read_begin_ = loc_->pcurrent_char_;
+        return read_lexeme();
+    }
+
+    void Expr_scaner::mark()
+    {
+        mark_ = *loc_;
+    }
+
+    ascaner::Location Expr_scaner::read_begin() const
+    {
+        ascaner::Location result(read_begin_);
+        result.pos_ = read_begin_pos_;
+        return result;
+    }
+
+    void Expr_scaner::rescan(const Expr_token& current)
+    {
+        has_pending_          = true;
+        pending_token_        = current;
+        pending_read_begin_   = read_begin_;
+        pending_lexeme_begin_ = lexeme_begin_;
+        pending_lexeme_pos_   = lexeme_pos_;
+        pending_end_          = *loc_;
+        *loc_                 = mark_;
+    }
+
+    Expr_token Expr_scaner::read_lexeme()
     {
         Expr_token eti;
 
@@ -27,12 +66,12 @@ namespace escaner{
         switch(aetic_){
             case Aux_expr_lexem_code::Begin_char_class_complement:
                 aux_scaner_->back();
-                eti.lexeme_.code_                 = Expr_lexem_code::Class_complement;
-                eti.lexeme_.index_of_set_of_char_ = get_set_complement();
+                set_complement(eti.lexeme_, get_set_complement());
                 break;
             case Aux_expr_lexem_code::End_char_class_complement:
                 eti.lexeme_.code_                 = Expr_lexem_code::UnknownLexem;
                 eti.range_                        = lexeme_pos_;
+                break;
             default:
                 eti.lexeme_                       = convert_lexeme(aeti_);
                 eti.range_                        = lexeme_pos_;
@@ -54,13 +93,22 @@ namespace escaner{
         return static_cast<uint64_t>(e) - first_code_of_char_class;
     }
 
-    static inline std::set<char32_t> char_class_set_by_lexeme(Aux_expr_lexem_code e)
+    static inline const Set_for_class& char_class_set_by_lexeme(Aux_expr_lexem_code e)
     {
         return sets_for_char_classes[char_class_to_array_index(e)];
     }
 
-    static const std::set<char32_t> single_quote = {U'\''};
-    static const std::set<char32_t> double_quote = {U'\"'};
+    static constexpr Segment<char32_t> single_quote[] = {{U'\'', U'\''}};
+    static constexpr Segment<char32_t> double_quote[] = {{U'\"', U'\"'}};
+
+    using operations_with_segments::Set_of_segments;
+
+    static inline Set_of_segments<char32_t> unicode_class_set(size_t category_index)
+    {
+        const auto& info = unicode_categories[category_index];
+        return operations_with_segments::from_array(info.segments_,
+                                                    info.number_of_segments_);
+    }
 
     Expr_lexem_info Expr_scaner::convert_lexeme(const Aux_token& aeti)
     {
@@ -87,16 +135,26 @@ namespace escaner{
                 eli.code_                 = Expr_lexem_code::Action;
                 break;
             case Aux_expr_lexem_code::Class_Latin ... Aux_expr_lexem_code::Class_xdigits:
-                eli.index_of_set_of_char_ = set_trie_->insertSet(char_class_set_by_lexeme(aelic));
-                eli.code_                 = Expr_lexem_code::Character_class;
+                {
+                    const auto& s             = char_class_set_by_lexeme(aelic);
+                    eli.index_of_set_of_char_ =
+                        set_trie_->insert_segments(s.segments_, s.number_of_segments_);
+                    eli.code_                 = Expr_lexem_code::Character_class;
+                }
                 break;
             case Aux_expr_lexem_code::Class_ndq:
-                eli.index_of_set_of_char_ = set_trie_->insertSet(double_quote);
-                eli.code_                 = Expr_lexem_code::Class_complement;
+                set_complement(eli, set_trie_->insert_segments(double_quote, 1));
                 break;
             case Aux_expr_lexem_code::Class_nsq:
-                eli.index_of_set_of_char_ = set_trie_->insertSet(single_quote);
-                eli.code_                 = Expr_lexem_code::Class_complement;
+                set_complement(eli, set_trie_->insert_segments(single_quote, 1));
+                break;
+            case Aux_expr_lexem_code::Class_unicode:
+                {
+                    const auto& info          = unicode_categories[aeli.category_index_];
+                    eli.index_of_set_of_char_ =
+                        set_trie_->insert_segments(info.segments_, info.number_of_segments_);
+                    eli.code_                 = Expr_lexem_code::Character_class;
+                }
                 break;
             case Aux_expr_lexem_code::Regexp_name:
                 eli.regexp_name_index_    = aeli.regexp_name_index_;
@@ -110,8 +168,30 @@ namespace escaner{
         return eli;
     }
 
-    static const char* undefined_regexp_name = "Error at line %zu: regexp name %s is "
-                                               "undefined.\n";
+    size_t Expr_scaner::complement_idx(size_t excluded_idx)
+    {
+        auto it = complements_.find(excluded_idx);
+        if(it != complements_.end()){
+            return it->second;
+        }
+        auto excluded = set_trie_->get_set(excluded_idx);
+        auto result   = set_trie_->insertSet(
+            operations_with_segments::complement(excluded, U'\0', max_code_point)
+        );
+        complements_[excluded_idx] = result;
+        return result;
+    }
+
+    void Expr_scaner::set_complement(Expr_lexem_info& eli, size_t excluded_idx)
+    {
+        if(true_complements_){
+            eli.code_                 = Expr_lexem_code::Character_class;
+            eli.index_of_set_of_char_ = complement_idx(excluded_idx);
+        }else{
+            eli.code_                 = Expr_lexem_code::Class_complement;
+            eli.index_of_set_of_char_ = excluded_idx;
+        }
+    }
 
     void Expr_scaner::check_regexp_name(size_t idx)
     {
@@ -120,8 +200,8 @@ namespace escaner{
         if((it == idsc.end()) ||
            !belongs(static_cast<uint64_t>(Id_kind::Regexp_name), (it->second).kind_))
         {
-            auto s = idx_to_string(et_.ids_trie_, idx);
-            printf(undefined_regexp_name, lexeme_pos_.begin_pos_.line_no_, s.c_str());
+            et_.diags_->add(Diagnostic_code::Undefined_regexp_name,
+                            lexeme_pos_.begin_pos_.line_no_, idx);
             et_.ec_->increment_number_of_errors();
             return;
         }
@@ -134,6 +214,7 @@ namespace escaner{
 
         curr_set_.clear();
 
+        aux_scaner_->set_class_complement_mode(true);
         while((aetic_ = (aeti_ = aux_scaner_->current_lexeme()).lexeme_.code_) !=
               Aux_expr_lexem_code::Nothing)
         {
@@ -142,6 +223,7 @@ namespace escaner{
                 break;
             }
         }
+        aux_scaner_->set_class_complement_mode(false);
         return set_idx_;
     }
 
@@ -149,6 +231,8 @@ namespace escaner{
         &Expr_scaner::begin_class_complement_proc,
         &Expr_scaner::first_char_proc,
         &Expr_scaner::body_chars_proc,
+        &Expr_scaner::char_or_range_proc,
+        &Expr_scaner::range_hyphen_proc,
         &Expr_scaner::end_class_complement_proc
     };
 
@@ -167,7 +251,8 @@ namespace escaner{
         (1ULL << static_cast<uint64_t>(Aux_expr_lexem_code::Class_letter))  |
         (1ULL << static_cast<uint64_t>(Aux_expr_lexem_code::Class_odigits)) |
         (1ULL << static_cast<uint64_t>(Aux_expr_lexem_code::Class_russian)) |
-        (1ULL << static_cast<uint64_t>(Aux_expr_lexem_code::Class_xdigits));
+        (1ULL << static_cast<uint64_t>(Aux_expr_lexem_code::Class_xdigits)) |
+        (1ULL << static_cast<uint64_t>(Aux_expr_lexem_code::Class_unicode));
 
     static constexpr uint64_t classes_of_chars_with_complement =
         (1ULL << static_cast<uint64_t>(Aux_expr_lexem_code::Class_ndq)) |
@@ -178,29 +263,37 @@ namespace escaner{
         return ::belongs(static_cast<uint64_t>(e), s);
     }
 
-    static const char* not_admissible_nsq_ndq =
-        "Error at line %zu: character classes [:ndq:] and [:nsq:] are not admissible "
-        "in the character class complement.\n";
-
-    static const char* not_admissible_lexeme =
-        "Error at line %zu: expected a character or character class, with the "
-        "exception of [:nsq:] and [:ndq:].\n";
+    bool Expr_scaner::add_class_to_curr_set()
+    {
+        using operations_with_segments::operator+;
+        if(Aux_expr_lexem_code::Class_unicode == aetic_){
+            curr_set_ = curr_set_ + unicode_class_set(aeti_.lexeme_.category_index_);
+        }else if(belongs(aetic_, classes_of_chars_without_complement)){
+            const auto& s = char_class_set_by_lexeme(aetic_);
+            curr_set_     = curr_set_ +
+                            operations_with_segments::from_array(s.segments_,
+                                                                 s.number_of_segments_);
+        }else{
+            return false;
+        }
+        return true;
+    }
 
     void Expr_scaner::first_char_proc()
     {
         state_ = State::Body_chars;
         if(Aux_expr_lexem_code::Character == aetic_){
-            curr_set_.insert(aeti_.lexeme_.c_);
-        }else if(belongs(aetic_, classes_of_chars_without_complement)){
-            const auto& s = sets_for_char_classes[char_class_to_array_index(aetic_)];
-            curr_set_.insert(s.begin(), s.end());
+            range_lower_ = aeti_.lexeme_.c_;
+            state_       = State::Char_or_range;
+        }else if(add_class_to_curr_set()){
+            return;
         }else if(belongs(aetic_, classes_of_chars_with_complement)){
             auto pos = aux_scaner_->lexeme_pos();
-            printf(not_admissible_nsq_ndq, pos.begin_pos_.line_no_);
+            et_.diags_->add(Diagnostic_code::Not_admissible_nsq_ndq, pos.begin_pos_.line_no_);
             et_.ec_->increment_number_of_errors();
         }else{
             auto pos = aux_scaner_->lexeme_pos();
-            printf(not_admissible_lexeme, pos.begin_pos_.line_no_);
+            et_.diags_->add(Diagnostic_code::Not_admissible_lexeme, pos.begin_pos_.line_no_);
             et_.ec_->increment_number_of_errors();
         }
     }
@@ -209,13 +302,13 @@ namespace escaner{
     {
         state_ = State::Body_chars;
         if(Aux_expr_lexem_code::Character == aetic_){
-            curr_set_.insert(aeti_.lexeme_.c_);
-        }else if(belongs(aetic_, classes_of_chars_without_complement)){
-            const auto& s = sets_for_char_classes[char_class_to_array_index(aetic_)];
-            curr_set_.insert(s.begin(), s.end());
+            range_lower_ = aeti_.lexeme_.c_;
+            state_       = State::Char_or_range;
+        }else if(add_class_to_curr_set()){
+            return;
         }else if(belongs(aetic_, classes_of_chars_with_complement)){
             auto pos = aux_scaner_->lexeme_pos();
-            printf(not_admissible_nsq_ndq, pos.begin_pos_.line_no_);
+            et_.diags_->add(Diagnostic_code::Not_admissible_nsq_ndq, pos.begin_pos_.line_no_);
             et_.ec_->increment_number_of_errors();
         }else if(Aux_expr_lexem_code::End_char_class_complement == aetic_){
             set_idx_             = set_trie_->insertSet(curr_set_);
@@ -224,11 +317,42 @@ namespace escaner{
             lexeme_pos_.end_pos_ = pos.end_pos_;
         }else{
             auto pos = aux_scaner_->lexeme_pos();
-            printf(not_admissible_lexeme, pos.begin_pos_.line_no_);
+            et_.diags_->add(Diagnostic_code::Not_admissible_lexeme, pos.begin_pos_.line_no_);
             et_.ec_->increment_number_of_errors();
         }
     }
 
+    void Expr_scaner::char_or_range_proc()
+    {
+        if((Aux_expr_lexem_code::Character == aetic_) && (U'-' == aeti_.lexeme_.c_) &&
+           !aeti_.lexeme_.escaped_)
+        {
+            state_ = State::Range_hyphen;
+            return;
+        }
+        operations_with_segments::add_elem(curr_set_, range_lower_);
+        body_chars_proc();
+    }
+
+    void Expr_scaner::range_hyphen_proc()
+    {
+        if(Aux_expr_lexem_code::Character == aetic_){
+            char32_t range_upper = aeti_.lexeme_.c_;
+            if(range_lower_ > range_upper){
+                auto pos = aux_scaner_->lexeme_pos();
+                et_.diags_->add(Diagnostic_code::Reversed_range, pos.begin_pos_.line_no_);
+                et_.ec_->increment_number_of_errors();
+                std::swap(range_lower_, range_upper);
+            }
+            operations_with_segments::add_segment(curr_set_, range_lower_, range_upper);
+            state_ = State::Body_chars;
+            return;
+        }
+        operations_with_segments::add_elem(curr_set_, range_lower_);
+        operations_with_segments::add_elem(curr_set_, U'-');
+        body_chars_proc();
+    }
+
     void Expr_scaner::end_class_complement_proc()
     {
     }
@@ -244,8 +368,9 @@ namespace escaner{
 
     void Expr_scaner::back()
     {
-        loc_->pcurrent_char_ = lexeme_begin_;
-        loc_->pos_           = lexeme_pos_.begin_pos_;
+        has_pending_         = false;
+        loc_->pcurrent_char_ = read_begin_;
+        loc_->pos_           = read_begin_pos_;
     }
 
     std::string Expr_scaner::token_to_string(const Expr_token& tok)
@@ -264,7 +389,7 @@ namespace escaner{
         return result;
     }
 
-    static const std::string codes_str[] = {
+    static const char* codes_str[] = {
         "Nothing ",             "UnknownLexem ",        "Action ",
         "Regexp_name ",         "Opened_round_brack ",  "Closed_round_brack ",
         "Or ",                  "Kleene_closure ",      "Positive_closure ",
@@ -274,7 +399,7 @@ namespace escaner{
 
     std::string Expr_scaner::lexeme_to_string(const Expr_lexem_info& li)
     {
-        using namespace operations_with_sets;
+        using namespace operations_with_segments;
         std::string result;
         auto        lic    = li.code_;
         result             = codes_str[static_cast<unsigned>(lic)];
@@ -0,0 +1,149 @@
+/*
+    File:    expr_source_cache.cpp
+    Created: 19 October 2026 at 18:20 Moscow time
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+
+#include "../include/expr_source_cache.h"
+#include "../include/belongs.h"
+
+/* The FNV-1a hash of the text from p up to the first closing brace inclusive. */
+static uint64_t hash_of_beginning(const char32_t* p)
+{
+    uint64_t h = 14695981039346656037ULL;
+    for(char32_t c; (c = *p); ++p){
+        h = (h ^ c) * 1099511628211ULL;
+        if(U'}' == c){
+            break;
+        }
+    }
+    return h;
+}
+
+static bool starts_with(const char32_t* p, const std::u32string& text)
+{
+    for(char32_t c : text){
+        if(*p++ != c){
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Renumbers the operands of com so that the command with the index from becomes
+ * the command with the index to. */
+static Command renumbered(Command com, uint32_t from, uint32_t to)
+{
+    switch(com.name_){
+        case Command_name::Or:
+        case Command_name::Concat:
+            com.args.first_  = com.args.first_  - from + to;
+            com.args.second_ = com.args.second_ - from + to;
+            break;
+        case Command_name::Kleene:
+        case Command_name::Positive:
+        case Command_name::Optional:
+            com.args.first_  = com.args.first_  - from + to;
+            break;
+        default:
+            ;
+    }
+    return com;
+}
+
+bool Expr_source_cache::names_are_defined(const Source& src) const
+{
+    /* The same checks as in SLR_act_expr_parser::is_defined_action and in
+     * Expr_scaner::check_regexp_name. */
+    const auto& idsc = scope_->idsc_;
+    for(const Command& com : src.commands_){
+        if(com.action_name_){
+            auto it = idsc.find(com.action_name_);
+            if((it == idsc.end()) ||
+               (it->second.kind_ != static_cast<std::uint8_t>(Id_kind::Action_name)))
+            {
+                return false;
+            }
+        }
+        if(Command_name::Regexp_name == com.name_){
+            auto it = idsc.find(com.idx_of_regexp_name_);
+            if((it == idsc.end()) ||
+               !belongs(static_cast<uint64_t>(Id_kind::Regexp_name), (it->second).kind_))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool Expr_source_cache::reuse(Command_buffer& buf)
+{
+    begin_ = *loc_;
+    for( ; *begin_.pcurrent_char_ && (*begin_.pcurrent_char_ <= U' '); ++begin_.pcurrent_char_){
+        if(U'\n' == *begin_.pcurrent_char_){
+            begin_.pos_.line_pos_ = 1;
+            begin_.pos_.line_no_++;
+        }else{
+            begin_.pos_.line_pos_++;
+        }
+    }
+    begin_hash_ = hash_of_beginning(begin_.pcurrent_char_);
+    auto range  = index_.equal_range(begin_hash_);
+    for(auto it = range.first; it != range.second; ++it){
+        const Source& src = sources_[it->second];
+        if(!starts_with(begin_.pcurrent_char_, src.text_)){
+            continue;
+        }
+        if(!names_are_defined(src)){
+            /* The scope has changed since the source was compiled; the compilation
+             * of the source will report the error. */
+            index_.erase(it);
+            break;
+        }
+        uint32_t base = buf.size();
+        for(const Command& com : src.commands_){
+            buf.push_back(renumbered(com, 0, base));
+        }
+        *loc_                = begin_;
+        loc_->pcurrent_char_ += src.text_.length();
+        if(src.new_lines_){
+            loc_->pos_.line_no_  += src.new_lines_;
+            loc_->pos_.line_pos_ =  src.line_pos_;
+        }else{
+            loc_->pos_.line_pos_ += src.line_pos_;
+        }
+        return true;
+    }
+    begin_size_       = buf.size();
+    number_of_errors_ = et_.ec_->get_number_of_errors();
+    number_of_diags_  = et_.diags_->records().size();
+    return false;
+}
+
+void Expr_source_cache::finish(const Command_buffer& buf, const ascaner::Location& source_end)
+{
+    const char32_t* b = begin_.pcurrent_char_;
+    const char32_t* e = source_end.pcurrent_char_;
+    bool is_cached    = (number_of_errors_ == et_.ec_->get_number_of_errors()) &&
+                        (number_of_diags_  == et_.diags_->records().size())    &&
+                        (loc_->pcurrent_char_ == e) && (e > b) && (U'}' == e[-1]) &&
+                        (buf.size() > begin_size_);
+    if(!is_cached){
+        return;
+    }
+    Source src;
+    src.text_      = std::u32string(b, e);
+    src.new_lines_ = source_end.pos_.line_no_ - begin_.pos_.line_no_;
+    src.line_pos_  = src.new_lines_ ? source_end.pos_.line_pos_ :
+                                      source_end.pos_.line_pos_ - begin_.pos_.line_pos_;
+    src.commands_.reserve(buf.size() - begin_size_);
+    for(size_t i = begin_size_; i < buf.size(); ++i){
+        src.commands_.push_back(renumbered(buf[i], begin_size_, 0));
+    }
+    index_.emplace(begin_hash_, sources_.size());
+    sources_.push_back(std::move(src));
+}
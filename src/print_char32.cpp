@@ -8,33 +8,43 @@
 */
 
 #include <string>
-#include <map>
 #include "../include/print_char32.h"
 #include "../include/char_conv.h"
 
-static const std::map<char32_t, std::string> esc_char_strings = {
-    {U'\'', R"~(\')~"},       {U'\"', R"~(\")~"},       {U'\?', R"~('\?')~"},
-    {U'\\', R"~('\\')~"},     {U'\0', R"~('\0')~"},     {U'\a', R"~('\a')~"},
-    {U'\b', R"~('\b')~"},     {U'\f', R"~('\f')~"},     {U'\n', R"~('\n')~"},
-    {U'\r', R"~('\r')~"},     {U'\t', R"~('\t')~"},     {U'\v', R"~('\v')~"},
-    {U'\x01', R"~('\X01')~"}, {U'\x02', R"~('\X02')~"}, {U'\x03', R"~('\X03')~"},
-    {U'\x04', R"~('\X04')~"}, {U'\x05', R"~('\X05')~"}, {U'\x06', R"~('\X06')~"},
-    {U'\x0e', R"~('\X0e')~"}, {U'\x0f', R"~('\X0f')~"}, {U'\x10', R"~('\X10')~"},
-    {U'\x11', R"~('\X11')~"}, {U'\x12', R"~('\X12')~"}, {U'\x13', R"~('\X13')~"},
-    {U'\x14', R"~('\X14')~"}, {U'\x15', R"~('\X15')~"}, {U'\x16', R"~('\X16')~"},
-    {U'\x17', R"~('\X17')~"}, {U'\x18', R"~('\X18')~"}, {U'\x19', R"~('\X19')~"},
-    {U'\x1a', R"~('\X1a')~"}, {U'\x1b', R"~('\X1b')~"}, {U'\x1c', R"~('\X1c')~"},
-    {U'\x1d', R"~('\X1d')~"}, {U'\x1e', R"~('\X1e')~"}, {U'\x1f', R"~('\X1f')~"}
+/* Representations of the characters with codes from 0 to 0x1F; the table is indexed
+ * by the code of a character. */
+static const char* control_char_strings[] = {
+    R"~('\0')~",   R"~('\X01')~", R"~('\X02')~", R"~('\X03')~",
+    R"~('\X04')~", R"~('\X05')~", R"~('\X06')~", R"~('\a')~",
+    R"~('\b')~",   R"~('\t')~",   R"~('\n')~",   R"~('\v')~",
+    R"~('\f')~",   R"~('\r')~",   R"~('\X0e')~", R"~('\X0f')~",
+    R"~('\X10')~", R"~('\X11')~", R"~('\X12')~", R"~('\X13')~",
+    R"~('\X14')~", R"~('\X15')~", R"~('\X16')~", R"~('\X17')~",
+    R"~('\X18')~", R"~('\X19')~", R"~('\X1a')~", R"~('\X1b')~",
+    R"~('\X1c')~", R"~('\X1d')~", R"~('\X1e')~", R"~('\X1f')~"
 };
 
 std::string show_char32(const char32_t c)
 {
     std::string result;
-    auto it = esc_char_strings.find(c);
-    if(it != esc_char_strings.end()){
-        result = it->second;
-    }else{
-        result = '\'' + char32_to_utf8(c) + '\'';
+    switch(c){
+        case U'\0' ... U'\x1f':
+            result = control_char_strings[c];
+            break;
+        case U'\'':
+            result = R"~(\')~";
+            break;
+        case U'\"':
+            result = R"~(\")~";
+            break;
+        case U'\?':
+            result = R"~('\?')~";
+            break;
+        case U'\\':
+            result = R"~('\\')~";
+            break;
+        default:
+            result = '\'' + char32_to_utf8(c) + '\'';
     }
     return result;
 }
@@ -0,0 +1,80 @@
+/*
+    File:    regexp_registry.cpp
+    Created: 19 October 2026 at 17:45 Moscow time
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+
+#include <algorithm>
+#include <utility>
+#include "../include/regexp_registry.h"
+
+void Regexp_registry::add(size_t name_idx, Command_buffer&& body)
+{
+    bodies_[name_idx] = std::move(body);
+}
+
+const Command_buffer* Regexp_registry::find(size_t name_idx) const
+{
+    auto it = bodies_.find(name_idx);
+    return (it != bodies_.end()) ? &(it->second) : nullptr;
+}
+
+Command_buffer Regexp_registry::expand(const Command_buffer& buf) const
+{
+    Command_buffer      result;
+    std::vector<size_t> expanded_names;
+    result.reserve(buf.size());
+    append_expanded(buf, result, expanded_names);
+    return result;
+}
+
+/* Appends the commands of buf to result, replacing links by the commands of
+ * regexps. The vector expanded_names contains the names of regexps whose commands
+ * are being appended, so a regexp is not expanded inside itself. */
+void Regexp_registry::append_expanded(const Command_buffer& buf,
+                                      Command_buffer&       result,
+                                      std::vector<size_t>&  expanded_names) const
+{
+    std::vector<uint32_t> new_index(buf.size());
+    for(size_t i = 0; i < buf.size(); ++i){
+        Command com = buf[i];
+        switch(com.name_){
+            case Command_name::Regexp_name:
+                {
+                    size_t name = com.idx_of_regexp_name_;
+                    auto   body = find(name);
+                    bool   is_expanded = std::find(expanded_names.begin(),
+                                                   expanded_names.end(),
+                                                   name) != expanded_names.end();
+                    if(body && !body->empty() && !is_expanded){
+                        expanded_names.push_back(name);
+                        append_expanded(*body, result, expanded_names);
+                        expanded_names.pop_back();
+                        if(com.action_name_){
+                            result.back().action_name_ = com.action_name_;
+                        }
+                        new_index[i] = result.size() - 1;
+                        continue;
+                    }
+                }
+                break;
+            case Command_name::Or:
+            case Command_name::Concat:
+                com.args.first_  = new_index[com.args.first_];
+                com.args.second_ = new_index[com.args.second_];
+                break;
+            case Command_name::Kleene:
+            case Command_name::Positive:
+            case Command_name::Optional:
+                com.args.first_  = new_index[com.args.first_];
+                break;
+            default:
+                ;
+        }
+        new_index[i] = result.size();
+        result.push_back(com);
+    }
+}
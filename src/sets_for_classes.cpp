@@ -8,36 +8,57 @@
 */
 
 #include "../include/sets_for_classes.h"
-#include <string>
-static const std::u32string latin_upper_letters   = U"ABCDEFGHIJKLMNOPQRSTUVWXYZ";
-static const std::u32string latin_lower_letters   = U"abcdefghijklmnopqrstuvwxyz";
-static const std::u32string russian_upper_letters = U"АБВГДЕЁЖЗИЙКЛМНОПРСТУФХЦЧШЩЪЫЬЭЮЯ";
-static const std::u32string russian_lower_letters = U"абвгдеёжзийклмнопрстуфхцчшщъыьэюя";
-static const std::u32string binary_digits         = U"01";
-static const std::u32string octal_digits          = U"01234567";
-static const std::u32string decimal_digits        = U"0123456789";
-static const std::u32string hexadecimal_digits    = U"0123456789ABCDEFabcdef";
-static const std::u32string upper_letters         =
-    latin_upper_letters + russian_upper_letters;
-static const std::u32string lower_letters =
-    latin_lower_letters + russian_lower_letters;
 
-/* This function builds a set consisting of str string characters. The representation
- * of the set is std :: set <char32_t>. */
-static std::set<char32_t> u32string2set(const std::u32string& s)
+template <class T, std::size_t N>
+constexpr size_t size(const T (&array)[N]) noexcept
 {
-    std::set<char32_t> result;
-    for(const char32_t c : s){
-        result.insert(c);
-    }
-    return result;
+    return N;
 }
 
-const std::set<char32_t> sets_for_char_classes[] = {
-    u32string2set(latin_upper_letters),    u32string2set(upper_letters),
-    u32string2set(russian_upper_letters),  u32string2set(binary_digits),
-    u32string2set(decimal_digits),         u32string2set(latin_lower_letters),
-    u32string2set(lower_letters),          u32string2set(octal_digits),
-    u32string2set(russian_lower_letters),  u32string2set(hexadecimal_digits),
-    std::set<char32_t>(),                  std::set<char32_t>()
-};
\ No newline at end of file
+/* Here Ё and ё are separate segments, because they are outside the segments А-Я
+ * and а-я respectively. */
+static constexpr Segment<char32_t> latin_upper_letters[]   = {
+    {U'A', U'Z'}
+};
+static constexpr Segment<char32_t> latin_lower_letters[]   = {
+    {U'a', U'z'}
+};
+static constexpr Segment<char32_t> russian_upper_letters[] = {
+    {U'Ё', U'Ё'}, {U'А', U'Я'}
+};
+static constexpr Segment<char32_t> russian_lower_letters[] = {
+    {U'а', U'я'}, {U'ё', U'ё'}
+};
+static constexpr Segment<char32_t> binary_digits[]         = {
+    {U'0', U'1'}
+};
+static constexpr Segment<char32_t> octal_digits[]          = {
+    {U'0', U'7'}
+};
+static constexpr Segment<char32_t> decimal_digits[]        = {
+    {U'0', U'9'}
+};
+static constexpr Segment<char32_t> hexadecimal_digits[]    = {
+    {U'0', U'9'}, {U'A', U'F'}, {U'a', U'f'}
+};
+static constexpr Segment<char32_t> upper_letters[]         = {
+    {U'A', U'Z'}, {U'Ё', U'Ё'}, {U'А', U'Я'}
+};
+static constexpr Segment<char32_t> lower_letters[]         = {
+    {U'a', U'z'}, {U'а', U'я'}, {U'ё', U'ё'}
+};
+
+const Set_for_class sets_for_char_classes[] = {
+    {latin_upper_letters,   size(latin_upper_letters)  },
+    {upper_letters,         size(upper_letters)        },
+    {russian_upper_letters, size(russian_upper_letters)},
+    {binary_digits,         size(binary_digits)        },
+    {decimal_digits,        size(decimal_digits)       },
+    {latin_lower_letters,   size(latin_lower_letters)  },
+    {lower_letters,         size(lower_letters)        },
+    {octal_digits,          size(octal_digits)         },
+    {russian_lower_letters, size(russian_lower_letters)},
+    {hexadecimal_digits,    size(hexadecimal_digits)   },
+    {nullptr,               0                          },
+    {nullptr,               0                          }
+};
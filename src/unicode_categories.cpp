@@ -0,0 +1,44 @@
+/*
+    File:    unicode_categories.cpp
+    Created: 19 October 2026 at 11:30 Moscow time
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+
+#include "../include/unicode_categories.h"
+
+/* Compares a name written in UTF-32 with a category name written in ASCII. */
+static int compare_names(const std::u32string& name, const char* category_name)
+{
+    size_t i = 0;
+    for( ; i < name.length() && category_name[i]; ++i){
+        char32_t c = static_cast<unsigned char>(category_name[i]);
+        if(name[i] != c){
+            return (name[i] < c) ? -1 : 1;
+        }
+    }
+    if(i < name.length()){
+        return 1;
+    }
+    return category_name[i] ? -1 : 0;
+}
+
+int unicode_category_index(const std::u32string& name)
+{
+    int lower = 0;
+    int upper = static_cast<int>(number_of_unicode_categories) - 1;
+    while(lower <= upper){
+        int middle = (lower + upper) >> 1;
+        int cmp    = compare_names(name, unicode_categories[middle].name_);
+        if(!cmp){
+            return middle;
+        }else if(cmp > 0){
+            lower = middle + 1;
+        }else{
+            upper = middle - 1;
+        }
+    }
+    return THERE_IS_NO_CATEGORY;
+}
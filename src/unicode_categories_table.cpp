@@ -0,0 +1,1734 @@
+/*
+    File:    unicode_categories_table.cpp
+    Created: 19 October 2026 at 11:02 Moscow time
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+
+/* This file is generated by the script tools/gen_unicode_categories.py
+ * from the Unicode Character Database, version 14.0.0. Do not edit it by hand. */
+
+#include "../include/unicode_categories.h"
+
+template <class T, std::size_t N>
+constexpr size_t size(const T (&array)[N]) noexcept
+{
+    return N;
+}
+
+static const Segment<char32_t> segments_C[] = {
+    {0x000000, 0x00001F}, {0x00007F, 0x00009F}, {0x0000AD, 0x0000AD}, {0x000378, 0x000379},
+    {0x000380, 0x000383}, {0x00038B, 0x00038B}, {0x00038D, 0x00038D}, {0x0003A2, 0x0003A2},
+    {0x000530, 0x000530}, {0x000557, 0x000558}, {0x00058B, 0x00058C}, {0x000590, 0x000590},
+    {0x0005C8, 0x0005CF}, {0x0005EB, 0x0005EE}, {0x0005F5, 0x000605}, {0x00061C, 0x00061C},
+    {0x0006DD, 0x0006DD}, {0x00070E, 0x00070F}, {0x00074B, 0x00074C}, {0x0007B2, 0x0007BF},
+    {0x0007FB, 0x0007FC}, {0x00082E, 0x00082F}, {0x00083F, 0x00083F}, {0x00085C, 0x00085D},
+    {0x00085F, 0x00085F}, {0x00086B, 0x00086F}, {0x00088F, 0x000897}, {0x0008E2, 0x0008E2},
+    {0x000984, 0x000984}, {0x00098D, 0x00098E}, {0x000991, 0x000992}, {0x0009A9, 0x0009A9},
+    {0x0009B1, 0x0009B1}, {0x0009B3, 0x0009B5}, {0x0009BA, 0x0009BB}, {0x0009C5, 0x0009C6},
+    {0x0009C9, 0x0009CA}, {0x0009CF, 0x0009D6}, {0x0009D8, 0x0009DB}, {0x0009DE, 0x0009DE},
+    {0x0009E4, 0x0009E5}, {0x0009FF, 0x000A00}, {0x000A04, 0x000A04}, {0x000A0B, 0x000A0E},
+    {0x000A11, 0x000A12}, {0x000A29, 0x000A29}, {0x000A31, 0x000A31}, {0x000A34, 0x000A34},
+    {0x000A37, 0x000A37}, {0x000A3A, 0x000A3B}, {0x000A3D, 0x000A3D}, {0x000A43, 0x000A46},
+    {0x000A49, 0x000A4A}, {0x000A4E, 0x000A50}, {0x000A52, 0x000A58}, {0x000A5D, 0x000A5D},
+    {0x000A5F, 0x000A65}, {0x000A77, 0x000A80}, {0x000A84, 0x000A84}, {0x000A8E, 0x000A8E},
+    {0x000A92, 0x000A92}, {0x000AA9, 0x000AA9}, {0x000AB1, 0x000AB1}, {0x000AB4, 0x000AB4},
+    {0x000ABA, 0x000ABB}, {0x000AC6, 0x000AC6}, {0x000ACA, 0x000ACA}, {0x000ACE, 0x000ACF},
+    {0x000AD1, 0x000ADF}, {0x000AE4, 0x000AE5}, {0x000AF2, 0x000AF8}, {0x000B00, 0x000B00},
+    {0x000B04, 0x000B04}, {0x000B0D, 0x000B0E}, {0x000B11, 0x000B12}, {0x000B29, 0x000B29},
+    {0x000B31, 0x000B31}, {0x000B34, 0x000B34}, {0x000B3A, 0x000B3B}, {0x000B45, 0x000B46},
+    {0x000B49, 0x000B4A}, {0x000B4E, 0x000B54}, {0x000B58, 0x000B5B}, {0x000B5E, 0x000B5E},
+    {0x000B64, 0x000B65}, {0x000B78, 0x000B81}, {0x000B84, 0x000B84}, {0x000B8B, 0x000B8D},
+    {0x000B91, 0x000B91}, {0x000B96, 0x000B98}, {0x000B9B, 0x000B9B}, {0x000B9D, 0x000B9D},
+    {0x000BA0, 0x000BA2}, {0x000BA5, 0x000BA7}, {0x000BAB, 0x000BAD}, {0x000BBA, 0x000BBD},
+    {0x000BC3, 0x000BC5}, {0x000BC9, 0x000BC9}, {0x000BCE, 0x000BCF}, {0x000BD1, 0x000BD6},
+    {0x000BD8, 0x000BE5}, {0x000BFB, 0x000BFF}, {0x000C0D, 0x000C0D}, {0x000C11, 0x000C11},
+    {0x000C29, 0x000C29}, {0x000C3A, 0x000C3B}, {0x000C45, 0x000C45}, {0x000C49, 0x000C49},
+    {0x000C4E, 0x000C54}, {0x000C57, 0x000C57}, {0x000C5B, 0x000C5C}, {0x000C5E, 0x000C5F},
+    {0x000C64, 0x000C65}, {0x000C70, 0x000C76}, {0x000C8D, 0x000C8D}, {0x000C91, 0x000C91},
+    {0x000CA9, 0x000CA9}, {0x000CB4, 0x000CB4}, {0x000CBA, 0x000CBB}, {0x000CC5, 0x000CC5},
+    {0x000CC9, 0x000CC9}, {0x000CCE, 0x000CD4}, {0x000CD7, 0x000CDC}, {0x000CDF, 0x000CDF},
+    {0x000CE4, 0x000CE5}, {0x000CF0, 0x000CF0}, {0x000CF3, 0x000CFF}, {0x000D0D, 0x000D0D},
+    {0x000D11, 0x000D11}, {0x000D45, 0x000D45}, {0x000D49, 0x000D49}, {0x000D50, 0x000D53},
+    {0x000D64, 0x000D65}, {0x000D80, 0x000D80}, {0x000D84, 0x000D84}, {0x000D97, 0x000D99},
+    {0x000DB2, 0x000DB2}, {0x000DBC, 0x000DBC}, {0x000DBE, 0x000DBF}, {0x000DC7, 0x000DC9},
+    {0x000DCB, 0x000DCE}, {0x000DD5, 0x000DD5}, {0x000DD7, 0x000DD7}, {0x000DE0, 0x000DE5},
+    {0x000DF0, 0x000DF1}, {0x000DF5, 0x000E00}, {0x000E3B, 0x000E3E}, {0x000E5C, 0x000E80},
+    {0x000E83, 0x000E83}, {0x000E85, 0x000E85}, {0x000E8B, 0x000E8B}, {0x000EA4, 0x000EA4},
+    {0x000EA6, 0x000EA6}, {0x000EBE, 0x000EBF}, {0x000EC5, 0x000EC5}, {0x000EC7, 0x000EC7},
+    {0x000ECE, 0x000ECF}, {0x000EDA, 0x000EDB}, {0x000EE0, 0x000EFF}, {0x000F48, 0x000F48},
+    {0x000F6D, 0x000F70}, {0x000F98, 0x000F98}, {0x000FBD, 0x000FBD}, {0x000FCD, 0x000FCD},
+    {0x000FDB, 0x000FFF}, {0x0010C6, 0x0010C6}, {0x0010C8, 0x0010CC}, {0x0010CE, 0x0010CF},
+    {0x001249, 0x001249}, {0x00124E, 0x00124F}, {0x001257, 0x001257}, {0x001259, 0x001259},
+    {0x00125E, 0x00125F}, {0x001289, 0x001289}, {0x00128E, 0x00128F}, {0x0012B1, 0x0012B1},
+    {0x0012B6, 0x0012B7}, {0x0012BF, 0x0012BF}, {0x0012C1, 0x0012C1}, {0x0012C6, 0x0012C7},
+    {0x0012D7, 0x0012D7}, {0x001311, 0x001311}, {0x001316, 0x001317}, {0x00135B, 0x00135C},
+    {0x00137D, 0x00137F}, {0x00139A, 0x00139F}, {0x0013F6, 0x0013F7}, {0x0013FE, 0x0013FF},
+    {0x00169D, 0x00169F}, {0x0016F9, 0x0016FF}, {0x001716, 0x00171E}, {0x001737, 0x00173F},
+    {0x001754, 0x00175F}, {0x00176D, 0x00176D}, {0x001771, 0x001771}, {0x001774, 0x00177F},
+    {0x0017DE, 0x0017DF}, {0x0017EA, 0x0017EF}, {0x0017FA, 0x0017FF}, {0x00180E, 0x00180E},
+    {0x00181A, 0x00181F}, {0x001879, 0x00187F}, {0x0018AB, 0x0018AF}, {0x0018F6, 0x0018FF},
+    {0x00191F, 0x00191F}, {0x00192C, 0x00192F}, {0x00193C, 0x00193F}, {0x001941, 0x001943},
+    {0x00196E, 0x00196F}, {0x001975, 0x00197F}, {0x0019AC, 0x0019AF}, {0x0019CA, 0x0019CF},
+    {0x0019DB, 0x0019DD}, {0x001A1C, 0x001A1D}, {0x001A5F, 0x001A5F}, {0x001A7D, 0x001A7E},
+    {0x001A8A, 0x001A8F}, {0x001A9A, 0x001A9F}, {0x001AAE, 0x001AAF}, {0x001ACF, 0x001AFF},
+    {0x001B4D, 0x001B4F}, {0x001B7F, 0x001B7F}, {0x001BF4, 0x001BFB}, {0x001C38, 0x001C3A},
+    {0x001C4A, 0x001C4C}, {0x001C89, 0x001C8F}, {0x001CBB, 0x001CBC}, {0x001CC8, 0x001CCF},
+    {0x001CFB, 0x001CFF}, {0x001F16, 0x001F17}, {0x001F1E, 0x001F1F}, {0x001F46, 0x001F47},
+    {0x001F4E, 0x001F4F}, {0x001F58, 0x001F58}, {0x001F5A, 0x001F5A}, {0x001F5C, 0x001F5C},
+    {0x001F5E, 0x001F5E}, {0x001F7E, 0x001F7F}, {0x001FB5, 0x001FB5}, {0x001FC5, 0x001FC5},
+    {0x001FD4, 0x001FD5}, {0x001FDC, 0x001FDC}, {0x001FF0, 0x001FF1}, {0x001FF5, 0x001FF5},
+    {0x001FFF, 0x001FFF}, {0x00200B, 0x00200F}, {0x00202A, 0x00202E}, {0x002060, 0x00206F},
+    {0x002072, 0x002073}, {0x00208F, 0x00208F}, {0x00209D, 0x00209F}, {0x0020C1, 0x0020CF},
+    {0x0020F1, 0x0020FF}, {0x00218C, 0x00218F}, {0x002427, 0x00243F}, {0x00244B, 0x00245F},
+    {0x002B74, 0x002B75}, {0x002B96, 0x002B96}, {0x002CF4, 0x002CF8}, {0x002D26, 0x002D26},
+    {0x002D28, 0x002D2C}, {0x002D2E, 0x002D2F}, {0x002D68, 0x002D6E}, {0x002D71, 0x002D7E},
+    {0x002D97, 0x002D9F}, {0x002DA7, 0x002DA7}, {0x002DAF, 0x002DAF}, {0x002DB7, 0x002DB7},
+    {0x002DBF, 0x002DBF}, {0x002DC7, 0x002DC7}, {0x002DCF, 0x002DCF}, {0x002DD7, 0x002DD7},
+    {0x002DDF, 0x002DDF}, {0x002E5E, 0x002E7F}, {0x002E9A, 0x002E9A}, {0x002EF4, 0x002EFF},
+    {0x002FD6, 0x002FEF}, {0x002FFC, 0x002FFF}, {0x003040, 0x003040}, {0x003097, 0x003098},
+    {0x003100, 0x003104}, {0x003130, 0x003130}, {0x00318F, 0x00318F}, {0x0031E4, 0x0031EF},
+    {0x00321F, 0x00321F}, {0x00A48D, 0x00A48F}, {0x00A4C7, 0x00A4CF}, {0x00A62C, 0x00A63F},
+    {0x00A6F8, 0x00A6FF}, {0x00A7CB, 0x00A7CF}, {0x00A7D2, 0x00A7D2}, {0x00A7D4, 0x00A7D4},
+    {0x00A7DA, 0x00A7F1}, {0x00A82D, 0x00A82F}, {0x00A83A, 0x00A83F}, {0x00A878, 0x00A87F},
+    {0x00A8C6, 0x00A8CD}, {0x00A8DA, 0x00A8DF}, {0x00A954, 0x00A95E}, {0x00A97D, 0x00A97F},
+    {0x00A9CE, 0x00A9CE}, {0x00A9DA, 0x00A9DD}, {0x00A9FF, 0x00A9FF}, {0x00AA37, 0x00AA3F},
+    {0x00AA4E, 0x00AA4F}, {0x00AA5A, 0x00AA5B}, {0x00AAC3, 0x00AADA}, {0x00AAF7, 0x00AB00},
+    {0x00AB07, 0x00AB08}, {0x00AB0F, 0x00AB10}, {0x00AB17, 0x00AB1F}, {0x00AB27, 0x00AB27},
+    {0x00AB2F, 0x00AB2F}, {0x00AB6C, 0x00AB6F}, {0x00ABEE, 0x00ABEF}, {0x00ABFA, 0x00ABFF},
+    {0x00D7A4, 0x00D7AF}, {0x00D7C7, 0x00D7CA}, {0x00D7FC, 0x00F8FF}, {0x00FA6E, 0x00FA6F},
+    {0x00FADA, 0x00FAFF}, {0x00FB07, 0x00FB12}, {0x00FB18, 0x00FB1C}, {0x00FB37, 0x00FB37},
+    {0x00FB3D, 0x00FB3D}, {0x00FB3F, 0x00FB3F}, {0x00FB42, 0x00FB42}, {0x00FB45, 0x00FB45},
+    {0x00FBC3, 0x00FBD2}, {0x00FD90, 0x00FD91}, {0x00FDC8, 0x00FDCE}, {0x00FDD0, 0x00FDEF},
+    {0x00FE1A, 0x00FE1F}, {0x00FE53, 0x00FE53}, {0x00FE67, 0x00FE67}, {0x00FE6C, 0x00FE6F},
+    {0x00FE75, 0x00FE75}, {0x00FEFD, 0x00FF00}, {0x00FFBF, 0x00FFC1}, {0x00FFC8, 0x00FFC9},
+    {0x00FFD0, 0x00FFD1}, {0x00FFD8, 0x00FFD9}, {0x00FFDD, 0x00FFDF}, {0x00FFE7, 0x00FFE7},
+    {0x00FFEF, 0x00FFFB}, {0x00FFFE, 0x00FFFF}, {0x01000C, 0x01000C}, {0x010027, 0x010027},
+    {0x01003B, 0x01003B}, {0x01003E, 0x01003E}, {0x01004E, 0x01004F}, {0x01005E, 0x01007F},
+    {0x0100FB, 0x0100FF}, {0x010103, 0x010106}, {0x010134, 0x010136}, {0x01018F, 0x01018F},
+    {0x01019D, 0x01019F}, {0x0101A1, 0x0101CF}, {0x0101FE, 0x01027F}, {0x01029D, 0x01029F},
+    {0x0102D1, 0x0102DF}, {0x0102FC, 0x0102FF}, {0x010324, 0x01032C}, {0x01034B, 0x01034F},
+    {0x01037B, 0x01037F}, {0x01039E, 0x01039E}, {0x0103C4, 0x0103C7}, {0x0103D6, 0x0103FF},
+    {0x01049E, 0x01049F}, {0x0104AA, 0x0104AF}, {0x0104D4, 0x0104D7}, {0x0104FC, 0x0104FF},
+    {0x010528, 0x01052F}, {0x010564, 0x01056E}, {0x01057B, 0x01057B}, {0x01058B, 0x01058B},
+    {0x010593, 0x010593}, {0x010596, 0x010596}, {0x0105A2, 0x0105A2}, {0x0105B2, 0x0105B2},
+    {0x0105BA, 0x0105BA}, {0x0105BD, 0x0105FF}, {0x010737, 0x01073F}, {0x010756, 0x01075F},
+    {0x010768, 0x01077F}, {0x010786, 0x010786}, {0x0107B1, 0x0107B1}, {0x0107BB, 0x0107FF},
+    {0x010806, 0x010807}, {0x010809, 0x010809}, {0x010836, 0x010836}, {0x010839, 0x01083B},
+    {0x01083D, 0x01083E}, {0x010856, 0x010856}, {0x01089F, 0x0108A6}, {0x0108B0, 0x0108DF},
+    {0x0108F3, 0x0108F3}, {0x0108F6, 0x0108FA}, {0x01091C, 0x01091E}, {0x01093A, 0x01093E},
+    {0x010940, 0x01097F}, {0x0109B8, 0x0109BB}, {0x0109D0, 0x0109D1}, {0x010A04, 0x010A04},
+    {0x010A07, 0x010A0B}, {0x010A14, 0x010A14}, {0x010A18, 0x010A18}, {0x010A36, 0x010A37},
+    {0x010A3B, 0x010A3E}, {0x010A49, 0x010A4F}, {0x010A59, 0x010A5F}, {0x010AA0, 0x010ABF},
+    {0x010AE7, 0x010AEA}, {0x010AF7, 0x010AFF}, {0x010B36, 0x010B38}, {0x010B56, 0x010B57},
+    {0x010B73, 0x010B77}, {0x010B92, 0x010B98}, {0x010B9D, 0x010BA8}, {0x010BB0, 0x010BFF},
+    {0x010C49, 0x010C7F}, {0x010CB3, 0x010CBF}, {0x010CF3, 0x010CF9}, {0x010D28, 0x010D2F},
+    {0x010D3A, 0x010E5F}, {0x010E7F, 0x010E7F}, {0x010EAA, 0x010EAA}, {0x010EAE, 0x010EAF},
+    {0x010EB2, 0x010EFF}, {0x010F28, 0x010F2F}, {0x010F5A, 0x010F6F}, {0x010F8A, 0x010FAF},
+    {0x010FCC, 0x010FDF}, {0x010FF7, 0x010FFF}, {0x01104E, 0x011051}, {0x011076, 0x01107E},
+    {0x0110BD, 0x0110BD}, {0x0110C3, 0x0110CF}, {0x0110E9, 0x0110EF}, {0x0110FA, 0x0110FF},
+    {0x011135, 0x011135}, {0x011148, 0x01114F}, {0x011177, 0x01117F}, {0x0111E0, 0x0111E0},
+    {0x0111F5, 0x0111FF}, {0x011212, 0x011212}, {0x01123F, 0x01127F}, {0x011287, 0x011287},
+    {0x011289, 0x011289}, {0x01128E, 0x01128E}, {0x01129E, 0x01129E}, {0x0112AA, 0x0112AF},
+    {0x0112EB, 0x0112EF}, {0x0112FA, 0x0112FF}, {0x011304, 0x011304}, {0x01130D, 0x01130E},
+    {0x011311, 0x011312}, {0x011329, 0x011329}, {0x011331, 0x011331}, {0x011334, 0x011334},
+    {0x01133A, 0x01133A}, {0x011345, 0x011346}, {0x011349, 0x01134A}, {0x01134E, 0x01134F},
+    {0x011351, 0x011356}, {0x011358, 0x01135C}, {0x011364, 0x011365}, {0x01136D, 0x01136F},
+    {0x011375, 0x0113FF}, {0x01145C, 0x01145C}, {0x011462, 0x01147F}, {0x0114C8, 0x0114CF},
+    {0x0114DA, 0x01157F}, {0x0115B6, 0x0115B7}, {0x0115DE, 0x0115FF}, {0x011645, 0x01164F},
+    {0x01165A, 0x01165F}, {0x01166D, 0x01167F}, {0x0116BA, 0x0116BF}, {0x0116CA, 0x0116FF},
+    {0x01171B, 0x01171C}, {0x01172C, 0x01172F}, {0x011747, 0x0117FF}, {0x01183C, 0x01189F},
+    {0x0118F3, 0x0118FE}, {0x011907, 0x011908}, {0x01190A, 0x01190B}, {0x011914, 0x011914},
+    {0x011917, 0x011917}, {0x011936, 0x011936}, {0x011939, 0x01193A}, {0x011947, 0x01194F},
+    {0x01195A, 0x01199F}, {0x0119A8, 0x0119A9}, {0x0119D8, 0x0119D9}, {0x0119E5, 0x0119FF},
+    {0x011A48, 0x011A4F}, {0x011AA3, 0x011AAF}, {0x011AF9, 0x011BFF}, {0x011C09, 0x011C09},
+    {0x011C37, 0x011C37}, {0x011C46, 0x011C4F}, {0x011C6D, 0x011C6F}, {0x011C90, 0x011C91},
+    {0x011CA8, 0x011CA8}, {0x011CB7, 0x011CFF}, {0x011D07, 0x011D07}, {0x011D0A, 0x011D0A},
+    {0x011D37, 0x011D39}, {0x011D3B, 0x011D3B}, {0x011D3E, 0x011D3E}, {0x011D48, 0x011D4F},
+    {0x011D5A, 0x011D5F}, {0x011D66, 0x011D66}, {0x011D69, 0x011D69}, {0x011D8F, 0x011D8F},
+    {0x011D92, 0x011D92}, {0x011D99, 0x011D9F}, {0x011DAA, 0x011EDF}, {0x011EF9, 0x011FAF},
+    {0x011FB1, 0x011FBF}, {0x011FF2, 0x011FFE}, {0x01239A, 0x0123FF}, {0x01246F, 0x01246F},
+    {0x012475, 0x01247F}, {0x012544, 0x012F8F}, {0x012FF3, 0x012FFF}, {0x01342F, 0x0143FF},
+    {0x014647, 0x0167FF}, {0x016A39, 0x016A3F}, {0x016A5F, 0x016A5F}, {0x016A6A, 0x016A6D},
+    {0x016ABF, 0x016ABF}, {0x016ACA, 0x016ACF}, {0x016AEE, 0x016AEF}, {0x016AF6, 0x016AFF},
+    {0x016B46, 0x016B4F}, {0x016B5A, 0x016B5A}, {0x016B62, 0x016B62}, {0x016B78, 0x016B7C},
+    {0x016B90, 0x016E3F}, {0x016E9B, 0x016EFF}, {0x016F4B, 0x016F4E}, {0x016F88, 0x016F8E},
+    {0x016FA0, 0x016FDF}, {0x016FE5, 0x016FEF}, {0x016FF2, 0x016FFF}, {0x0187F8, 0x0187FF},
+    {0x018CD6, 0x018CFF}, {0x018D09, 0x01AFEF}, {0x01AFF4, 0x01AFF4}, {0x01AFFC, 0x01AFFC},
+    {0x01AFFF, 0x01AFFF}, {0x01B123, 0x01B14F}, {0x01B153, 0x01B163}, {0x01B168, 0x01B16F},
+    {0x01B2FC, 0x01BBFF}, {0x01BC6B, 0x01BC6F}, {0x01BC7D, 0x01BC7F}, {0x01BC89, 0x01BC8F},
+    {0x01BC9A, 0x01BC9B}, {0x01BCA0, 0x01CEFF}, {0x01CF2E, 0x01CF2F}, {0x01CF47, 0x01CF4F},
+    {0x01CFC4, 0x01CFFF}, {0x01D0F6, 0x01D0FF}, {0x01D127, 0x01D128}, {0x01D173, 0x01D17A},
+    {0x01D1EB, 0x01D1FF}, {0x01D246, 0x01D2DF}, {0x01D2F4, 0x01D2FF}, {0x01D357, 0x01D35F},
+    {0x01D379, 0x01D3FF}, {0x01D455, 0x01D455}, {0x01D49D, 0x01D49D}, {0x01D4A0, 0x01D4A1},
+    {0x01D4A3, 0x01D4A4}, {0x01D4A7, 0x01D4A8}, {0x01D4AD, 0x01D4AD}, {0x01D4BA, 0x01D4BA},
+    {0x01D4BC, 0x01D4BC}, {0x01D4C4, 0x01D4C4}, {0x01D506, 0x01D506}, {0x01D50B, 0x01D50C},
+    {0x01D515, 0x01D515}, {0x01D51D, 0x01D51D}, {0x01D53A, 0x01D53A}, {0x01D53F, 0x01D53F},
+    {0x01D545, 0x01D545}, {0x01D547, 0x01D549}, {0x01D551, 0x01D551}, {0x01D6A6, 0x01D6A7},
+    {0x01D7CC, 0x01D7CD}, {0x01DA8C, 0x01DA9A}, {0x01DAA0, 0x01DAA0}, {0x01DAB0, 0x01DEFF},
+    {0x01DF1F, 0x01DFFF}, {0x01E007, 0x01E007}, {0x01E019, 0x01E01A}, {0x01E022, 0x01E022},
+    {0x01E025, 0x01E025}, {0x01E02B, 0x01E0FF}, {0x01E12D, 0x01E12F}, {0x01E13E, 0x01E13F},
+    {0x01E14A, 0x01E14D}, {0x01E150, 0x01E28F}, {0x01E2AF, 0x01E2BF}, {0x01E2FA, 0x01E2FE},
+    {0x01E300, 0x01E7DF}, {0x01E7E7, 0x01E7E7}, {0x01E7EC, 0x01E7EC}, {0x01E7EF, 0x01E7EF},
+    {0x01E7FF, 0x01E7FF}, {0x01E8C5, 0x01E8C6}, {0x01E8D7, 0x01E8FF}, {0x01E94C, 0x01E94F},
+    {0x01E95A, 0x01E95D}, {0x01E960, 0x01EC70}, {0x01ECB5, 0x01ED00}, {0x01ED3E, 0x01EDFF},
+    {0x01EE04, 0x01EE04}, {0x01EE20, 0x01EE20}, {0x01EE23, 0x01EE23}, {0x01EE25, 0x01EE26},
+    {0x01EE28, 0x01EE28}, {0x01EE33, 0x01EE33}, {0x01EE38, 0x01EE38}, {0x01EE3A, 0x01EE3A},
+    {0x01EE3C, 0x01EE41}, {0x01EE43, 0x01EE46}, {0x01EE48, 0x01EE48}, {0x01EE4A, 0x01EE4A},
+    {0x01EE4C, 0x01EE4C}, {0x01EE50, 0x01EE50}, {0x01EE53, 0x01EE53}, {0x01EE55, 0x01EE56},
+    {0x01EE58, 0x01EE58}, {0x01EE5A, 0x01EE5A}, {0x01EE5C, 0x01EE5C}, {0x01EE5E, 0x01EE5E},
+    {0x01EE60, 0x01EE60}, {0x01EE63, 0x01EE63}, {0x01EE65, 0x01EE66}, {0x01EE6B, 0x01EE6B},
+    {0x01EE73, 0x01EE73}, {0x01EE78, 0x01EE78}, {0x01EE7D, 0x01EE7D}, {0x01EE7F, 0x01EE7F},
+    {0x01EE8A, 0x01EE8A}, {0x01EE9C, 0x01EEA0}, {0x01EEA4, 0x01EEA4}, {0x01EEAA, 0x01EEAA},
+    {0x01EEBC, 0x01EEEF}, {0x01EEF2, 0x01EFFF}, {0x01F02C, 0x01F02F}, {0x01F094, 0x01F09F},
+    {0x01F0AF, 0x01F0B0}, {0x01F0C0, 0x01F0C0}, {0x01F0D0, 0x01F0D0}, {0x01F0F6, 0x01F0FF},
+    {0x01F1AE, 0x01F1E5}, {0x01F203, 0x01F20F}, {0x01F23C, 0x01F23F}, {0x01F249, 0x01F24F},
+    {0x01F252, 0x01F25F}, {0x01F266, 0x01F2FF}, {0x01F6D8, 0x01F6DC}, {0x01F6ED, 0x01F6EF},
+    {0x01F6FD, 0x01F6FF}, {0x01F774, 0x01F77F}, {0x01F7D9, 0x01F7DF}, {0x01F7EC, 0x01F7EF},
+    {0x01F7F1, 0x01F7FF}, {0x01F80C, 0x01F80F}, {0x01F848, 0x01F84F}, {0x01F85A, 0x01F85F},
+    {0x01F888, 0x01F88F}, {0x01F8AE, 0x01F8AF}, {0x01F8B2, 0x01F8FF}, {0x01FA54, 0x01FA5F},
+    {0x01FA6E, 0x01FA6F}, {0x01FA75, 0x01FA77}, {0x01FA7D, 0x01FA7F}, {0x01FA87, 0x01FA8F},
+    {0x01FAAD, 0x01FAAF}, {0x01FABB, 0x01FABF}, {0x01FAC6, 0x01FACF}, {0x01FADA, 0x01FADF},
+    {0x01FAE8, 0x01FAEF}, {0x01FAF7, 0x01FAFF}, {0x01FB93, 0x01FB93}, {0x01FBCB, 0x01FBEF},
+    {0x01FBFA, 0x01FFFF}, {0x02A6E0, 0x02A6FF}, {0x02B739, 0x02B73F}, {0x02B81E, 0x02B81F},
+    {0x02CEA2, 0x02CEAF}, {0x02EBE1, 0x02F7FF}, {0x02FA1E, 0x02FFFF}, {0x03134B, 0x0E00FF},
+    {0x0E01F0, 0x10FFFF}
+};
+
+static const Segment<char32_t> segments_Cc[] = {
+    {0x000000, 0x00001F}, {0x00007F, 0x00009F}
+};
+
+static const Segment<char32_t> segments_Cf[] = {
+    {0x0000AD, 0x0000AD}, {0x000600, 0x000605}, {0x00061C, 0x00061C}, {0x0006DD, 0x0006DD},
+    {0x00070F, 0x00070F}, {0x000890, 0x000891}, {0x0008E2, 0x0008E2}, {0x00180E, 0x00180E},
+    {0x00200B, 0x00200F}, {0x00202A, 0x00202E}, {0x002060, 0x002064}, {0x002066, 0x00206F},
+    {0x00FEFF, 0x00FEFF}, {0x00FFF9, 0x00FFFB}, {0x0110BD, 0x0110BD}, {0x0110CD, 0x0110CD},
+    {0x013430, 0x013438}, {0x01BCA0, 0x01BCA3}, {0x01D173, 0x01D17A}, {0x0E0001, 0x0E0001},
+    {0x0E0020, 0x0E007F}
+};
+
+static const Segment<char32_t> segments_Cn[] = {
+    {0x000378, 0x000379}, {0x000380, 0x000383}, {0x00038B, 0x00038B}, {0x00038D, 0x00038D},
+    {0x0003A2, 0x0003A2}, {0x000530, 0x000530}, {0x000557, 0x000558}, {0x00058B, 0x00058C},
+    {0x000590, 0x000590}, {0x0005C8, 0x0005CF}, {0x0005EB, 0x0005EE}, {0x0005F5, 0x0005FF},
+    {0x00070E, 0x00070E}, {0x00074B, 0x00074C}, {0x0007B2, 0x0007BF}, {0x0007FB, 0x0007FC},
+    {0x00082E, 0x00082F}, {0x00083F, 0x00083F}, {0x00085C, 0x00085D}, {0x00085F, 0x00085F},
+    {0x00086B, 0x00086F}, {0x00088F, 0x00088F}, {0x000892, 0x000897}, {0x000984, 0x000984},
+    {0x00098D, 0x00098E}, {0x000991, 0x000992}, {0x0009A9, 0x0009A9}, {0x0009B1, 0x0009B1},
+    {0x0009B3, 0x0009B5}, {0x0009BA, 0x0009BB}, {0x0009C5, 0x0009C6}, {0x0009C9, 0x0009CA},
+    {0x0009CF, 0x0009D6}, {0x0009D8, 0x0009DB}, {0x0009DE, 0x0009DE}, {0x0009E4, 0x0009E5},
+    {0x0009FF, 0x000A00}, {0x000A04, 0x000A04}, {0x000A0B, 0x000A0E}, {0x000A11, 0x000A12},
+    {0x000A29, 0x000A29}, {0x000A31, 0x000A31}, {0x000A34, 0x000A34}, {0x000A37, 0x000A37},
+    {0x000A3A, 0x000A3B}, {0x000A3D, 0x000A3D}, {0x000A43, 0x000A46}, {0x000A49, 0x000A4A},
+    {0x000A4E, 0x000A50}, {0x000A52, 0x000A58}, {0x000A5D, 0x000A5D}, {0x000A5F, 0x000A65},
+    {0x000A77, 0x000A80}, {0x000A84, 0x000A84}, {0x000A8E, 0x000A8E}, {0x000A92, 0x000A92},
+    {0x000AA9, 0x000AA9}, {0x000AB1, 0x000AB1}, {0x000AB4, 0x000AB4}, {0x000ABA, 0x000ABB},
+    {0x000AC6, 0x000AC6}, {0x000ACA, 0x000ACA}, {0x000ACE, 0x000ACF}, {0x000AD1, 0x000ADF},
+    {0x000AE4, 0x000AE5}, {0x000AF2, 0x000AF8}, {0x000B00, 0x000B00}, {0x000B04, 0x000B04},
+    {0x000B0D, 0x000B0E}, {0x000B11, 0x000B12}, {0x000B29, 0x000B29}, {0x000B31, 0x000B31},
+    {0x000B34, 0x000B34}, {0x000B3A, 0x000B3B}, {0x000B45, 0x000B46}, {0x000B49, 0x000B4A},
+    {0x000B4E, 0x000B54}, {0x000B58, 0x000B5B}, {0x000B5E, 0x000B5E}, {0x000B64, 0x000B65},
+    {0x000B78, 0x000B81}, {0x000B84, 0x000B84}, {0x000B8B, 0x000B8D}, {0x000B91, 0x000B91},
+    {0x000B96, 0x000B98}, {0x000B9B, 0x000B9B}, {0x000B9D, 0x000B9D}, {0x000BA0, 0x000BA2},
+    {0x000BA5, 0x000BA7}, {0x000BAB, 0x000BAD}, {0x000BBA, 0x000BBD}, {0x000BC3, 0x000BC5},
+    {0x000BC9, 0x000BC9}, {0x000BCE, 0x000BCF}, {0x000BD1, 0x000BD6}, {0x000BD8, 0x000BE5},
+    {0x000BFB, 0x000BFF}, {0x000C0D, 0x000C0D}, {0x000C11, 0x000C11}, {0x000C29, 0x000C29},
+    {0x000C3A, 0x000C3B}, {0x000C45, 0x000C45}, {0x000C49, 0x000C49}, {0x000C4E, 0x000C54},
+    {0x000C57, 0x000C57}, {0x000C5B, 0x000C5C}, {0x000C5E, 0x000C5F}, {0x000C64, 0x000C65},
+    {0x000C70, 0x000C76}, {0x000C8D, 0x000C8D}, {0x000C91, 0x000C91}, {0x000CA9, 0x000CA9},
+    {0x000CB4, 0x000CB4}, {0x000CBA, 0x000CBB}, {0x000CC5, 0x000CC5}, {0x000CC9, 0x000CC9},
+    {0x000CCE, 0x000CD4}, {0x000CD7, 0x000CDC}, {0x000CDF, 0x000CDF}, {0x000CE4, 0x000CE5},
+    {0x000CF0, 0x000CF0}, {0x000CF3, 0x000CFF}, {0x000D0D, 0x000D0D}, {0x000D11, 0x000D11},
+    {0x000D45, 0x000D45}, {0x000D49, 0x000D49}, {0x000D50, 0x000D53}, {0x000D64, 0x000D65},
+    {0x000D80, 0x000D80}, {0x000D84, 0x000D84}, {0x000D97, 0x000D99}, {0x000DB2, 0x000DB2},
+    {0x000DBC, 0x000DBC}, {0x000DBE, 0x000DBF}, {0x000DC7, 0x000DC9}, {0x000DCB, 0x000DCE},
+    {0x000DD5, 0x000DD5}, {0x000DD7, 0x000DD7}, {0x000DE0, 0x000DE5}, {0x000DF0, 0x000DF1},
+    {0x000DF5, 0x000E00}, {0x000E3B, 0x000E3E}, {0x000E5C, 0x000E80}, {0x000E83, 0x000E83},
+    {0x000E85, 0x000E85}, {0x000E8B, 0x000E8B}, {0x000EA4, 0x000EA4}, {0x000EA6, 0x000EA6},
+    {0x000EBE, 0x000EBF}, {0x000EC5, 0x000EC5}, {0x000EC7, 0x000EC7}, {0x000ECE, 0x000ECF},
+    {0x000EDA, 0x000EDB}, {0x000EE0, 0x000EFF}, {0x000F48, 0x000F48}, {0x000F6D, 0x000F70},
+    {0x000F98, 0x000F98}, {0x000FBD, 0x000FBD}, {0x000FCD, 0x000FCD}, {0x000FDB, 0x000FFF},
+    {0x0010C6, 0x0010C6}, {0x0010C8, 0x0010CC}, {0x0010CE, 0x0010CF}, {0x001249, 0x001249},
+    {0x00124E, 0x00124F}, {0x001257, 0x001257}, {0x001259, 0x001259}, {0x00125E, 0x00125F},
+    {0x001289, 0x001289}, {0x00128E, 0x00128F}, {0x0012B1, 0x0012B1}, {0x0012B6, 0x0012B7},
+    {0x0012BF, 0x0012BF}, {0x0012C1, 0x0012C1}, {0x0012C6, 0x0012C7}, {0x0012D7, 0x0012D7},
+    {0x001311, 0x001311}, {0x001316, 0x001317}, {0x00135B, 0x00135C}, {0x00137D, 0x00137F},
+    {0x00139A, 0x00139F}, {0x0013F6, 0x0013F7}, {0x0013FE, 0x0013FF}, {0x00169D, 0x00169F},
+    {0x0016F9, 0x0016FF}, {0x001716, 0x00171E}, {0x001737, 0x00173F}, {0x001754, 0x00175F},
+    {0x00176D, 0x00176D}, {0x001771, 0x001771}, {0x001774, 0x00177F}, {0x0017DE, 0x0017DF},
+    {0x0017EA, 0x0017EF}, {0x0017FA, 0x0017FF}, {0x00181A, 0x00181F}, {0x001879, 0x00187F},
+    {0x0018AB, 0x0018AF}, {0x0018F6, 0x0018FF}, {0x00191F, 0x00191F}, {0x00192C, 0x00192F},
+    {0x00193C, 0x00193F}, {0x001941, 0x001943}, {0x00196E, 0x00196F}, {0x001975, 0x00197F},
+    {0x0019AC, 0x0019AF}, {0x0019CA, 0x0019CF}, {0x0019DB, 0x0019DD}, {0x001A1C, 0x001A1D},
+    {0x001A5F, 0x001A5F}, {0x001A7D, 0x001A7E}, {0x001A8A, 0x001A8F}, {0x001A9A, 0x001A9F},
+    {0x001AAE, 0x001AAF}, {0x001ACF, 0x001AFF}, {0x001B4D, 0x001B4F}, {0x001B7F, 0x001B7F},
+    {0x001BF4, 0x001BFB}, {0x001C38, 0x001C3A}, {0x001C4A, 0x001C4C}, {0x001C89, 0x001C8F},
+    {0x001CBB, 0x001CBC}, {0x001CC8, 0x001CCF}, {0x001CFB, 0x001CFF}, {0x001F16, 0x001F17},
+    {0x001F1E, 0x001F1F}, {0x001F46, 0x001F47}, {0x001F4E, 0x001F4F}, {0x001F58, 0x001F58},
+    {0x001F5A, 0x001F5A}, {0x001F5C, 0x001F5C}, {0x001F5E, 0x001F5E}, {0x001F7E, 0x001F7F},
+    {0x001FB5, 0x001FB5}, {0x001FC5, 0x001FC5}, {0x001FD4, 0x001FD5}, {0x001FDC, 0x001FDC},
+    {0x001FF0, 0x001FF1}, {0x001FF5, 0x001FF5}, {0x001FFF, 0x001FFF}, {0x002065, 0x002065},
+    {0x002072, 0x002073}, {0x00208F, 0x00208F}, {0x00209D, 0x00209F}, {0x0020C1, 0x0020CF},
+    {0x0020F1, 0x0020FF}, {0x00218C, 0x00218F}, {0x002427, 0x00243F}, {0x00244B, 0x00245F},
+    {0x002B74, 0x002B75}, {0x002B96, 0x002B96}, {0x002CF4, 0x002CF8}, {0x002D26, 0x002D26},
+    {0x002D28, 0x002D2C}, {0x002D2E, 0x002D2F}, {0x002D68, 0x002D6E}, {0x002D71, 0x002D7E},
+    {0x002D97, 0x002D9F}, {0x002DA7, 0x002DA7}, {0x002DAF, 0x002DAF}, {0x002DB7, 0x002DB7},
+    {0x002DBF, 0x002DBF}, {0x002DC7, 0x002DC7}, {0x002DCF, 0x002DCF}, {0x002DD7, 0x002DD7},
+    {0x002DDF, 0x002DDF}, {0x002E5E, 0x002E7F}, {0x002E9A, 0x002E9A}, {0x002EF4, 0x002EFF},
+    {0x002FD6, 0x002FEF}, {0x002FFC, 0x002FFF}, {0x003040, 0x003040}, {0x003097, 0x003098},
+    {0x003100, 0x003104}, {0x003130, 0x003130}, {0x00318F, 0x00318F}, {0x0031E4, 0x0031EF},
+    {0x00321F, 0x00321F}, {0x00A48D, 0x00A48F}, {0x00A4C7, 0x00A4CF}, {0x00A62C, 0x00A63F},
+    {0x00A6F8, 0x00A6FF}, {0x00A7CB, 0x00A7CF}, {0x00A7D2, 0x00A7D2}, {0x00A7D4, 0x00A7D4},
+    {0x00A7DA, 0x00A7F1}, {0x00A82D, 0x00A82F}, {0x00A83A, 0x00A83F}, {0x00A878, 0x00A87F},
+    {0x00A8C6, 0x00A8CD}, {0x00A8DA, 0x00A8DF}, {0x00A954, 0x00A95E}, {0x00A97D, 0x00A97F},
+    {0x00A9CE, 0x00A9CE}, {0x00A9DA, 0x00A9DD}, {0x00A9FF, 0x00A9FF}, {0x00AA37, 0x00AA3F},
+    {0x00AA4E, 0x00AA4F}, {0x00AA5A, 0x00AA5B}, {0x00AAC3, 0x00AADA}, {0x00AAF7, 0x00AB00},
+    {0x00AB07, 0x00AB08}, {0x00AB0F, 0x00AB10}, {0x00AB17, 0x00AB1F}, {0x00AB27, 0x00AB27},
+    {0x00AB2F, 0x00AB2F}, {0x00AB6C, 0x00AB6F}, {0x00ABEE, 0x00ABEF}, {0x00ABFA, 0x00ABFF},
+    {0x00D7A4, 0x00D7AF}, {0x00D7C7, 0x00D7CA}, {0x00D7FC, 0x00D7FF}, {0x00FA6E, 0x00FA6F},
+    {0x00FADA, 0x00FAFF}, {0x00FB07, 0x00FB12}, {0x00FB18, 0x00FB1C}, {0x00FB37, 0x00FB37},
+    {0x00FB3D, 0x00FB3D}, {0x00FB3F, 0x00FB3F}, {0x00FB42, 0x00FB42}, {0x00FB45, 0x00FB45},
+    {0x00FBC3, 0x00FBD2}, {0x00FD90, 0x00FD91}, {0x00FDC8, 0x00FDCE}, {0x00FDD0, 0x00FDEF},
+    {0x00FE1A, 0x00FE1F}, {0x00FE53, 0x00FE53}, {0x00FE67, 0x00FE67}, {0x00FE6C, 0x00FE6F},
+    {0x00FE75, 0x00FE75}, {0x00FEFD, 0x00FEFE}, {0x00FF00, 0x00FF00}, {0x00FFBF, 0x00FFC1},
+    {0x00FFC8, 0x00FFC9}, {0x00FFD0, 0x00FFD1}, {0x00FFD8, 0x00FFD9}, {0x00FFDD, 0x00FFDF},
+    {0x00FFE7, 0x00FFE7}, {0x00FFEF, 0x00FFF8}, {0x00FFFE, 0x00FFFF}, {0x01000C, 0x01000C},
+    {0x010027, 0x010027}, {0x01003B, 0x01003B}, {0x01003E, 0x01003E}, {0x01004E, 0x01004F},
+    {0x01005E, 0x01007F}, {0x0100FB, 0x0100FF}, {0x010103, 0x010106}, {0x010134, 0x010136},
+    {0x01018F, 0x01018F}, {0x01019D, 0x01019F}, {0x0101A1, 0x0101CF}, {0x0101FE, 0x01027F},
+    {0x01029D, 0x01029F}, {0x0102D1, 0x0102DF}, {0x0102FC, 0x0102FF}, {0x010324, 0x01032C},
+    {0x01034B, 0x01034F}, {0x01037B, 0x01037F}, {0x01039E, 0x01039E}, {0x0103C4, 0x0103C7},
+    {0x0103D6, 0x0103FF}, {0x01049E, 0x01049F}, {0x0104AA, 0x0104AF}, {0x0104D4, 0x0104D7},
+    {0x0104FC, 0x0104FF}, {0x010528, 0x01052F}, {0x010564, 0x01056E}, {0x01057B, 0x01057B},
+    {0x01058B, 0x01058B}, {0x010593, 0x010593}, {0x010596, 0x010596}, {0x0105A2, 0x0105A2},
+    {0x0105B2, 0x0105B2}, {0x0105BA, 0x0105BA}, {0x0105BD, 0x0105FF}, {0x010737, 0x01073F},
+    {0x010756, 0x01075F}, {0x010768, 0x01077F}, {0x010786, 0x010786}, {0x0107B1, 0x0107B1},
+    {0x0107BB, 0x0107FF}, {0x010806, 0x010807}, {0x010809, 0x010809}, {0x010836, 0x010836},
+    {0x010839, 0x01083B}, {0x01083D, 0x01083E}, {0x010856, 0x010856}, {0x01089F, 0x0108A6},
+    {0x0108B0, 0x0108DF}, {0x0108F3, 0x0108F3}, {0x0108F6, 0x0108FA}, {0x01091C, 0x01091E},
+    {0x01093A, 0x01093E}, {0x010940, 0x01097F}, {0x0109B8, 0x0109BB}, {0x0109D0, 0x0109D1},
+    {0x010A04, 0x010A04}, {0x010A07, 0x010A0B}, {0x010A14, 0x010A14}, {0x010A18, 0x010A18},
+    {0x010A36, 0x010A37}, {0x010A3B, 0x010A3E}, {0x010A49, 0x010A4F}, {0x010A59, 0x010A5F},
+    {0x010AA0, 0x010ABF}, {0x010AE7, 0x010AEA}, {0x010AF7, 0x010AFF}, {0x010B36, 0x010B38},
+    {0x010B56, 0x010B57}, {0x010B73, 0x010B77}, {0x010B92, 0x010B98}, {0x010B9D, 0x010BA8},
+    {0x010BB0, 0x010BFF}, {0x010C49, 0x010C7F}, {0x010CB3, 0x010CBF}, {0x010CF3, 0x010CF9},
+    {0x010D28, 0x010D2F}, {0x010D3A, 0x010E5F}, {0x010E7F, 0x010E7F}, {0x010EAA, 0x010EAA},
+    {0x010EAE, 0x010EAF}, {0x010EB2, 0x010EFF}, {0x010F28, 0x010F2F}, {0x010F5A, 0x010F6F},
+    {0x010F8A, 0x010FAF}, {0x010FCC, 0x010FDF}, {0x010FF7, 0x010FFF}, {0x01104E, 0x011051},
+    {0x011076, 0x01107E}, {0x0110C3, 0x0110CC}, {0x0110CE, 0x0110CF}, {0x0110E9, 0x0110EF},
+    {0x0110FA, 0x0110FF}, {0x011135, 0x011135}, {0x011148, 0x01114F}, {0x011177, 0x01117F},
+    {0x0111E0, 0x0111E0}, {0x0111F5, 0x0111FF}, {0x011212, 0x011212}, {0x01123F, 0x01127F},
+    {0x011287, 0x011287}, {0x011289, 0x011289}, {0x01128E, 0x01128E}, {0x01129E, 0x01129E},
+    {0x0112AA, 0x0112AF}, {0x0112EB, 0x0112EF}, {0x0112FA, 0x0112FF}, {0x011304, 0x011304},
+    {0x01130D, 0x01130E}, {0x011311, 0x011312}, {0x011329, 0x011329}, {0x011331, 0x011331},
+    {0x011334, 0x011334}, {0x01133A, 0x01133A}, {0x011345, 0x011346}, {0x011349, 0x01134A},
+    {0x01134E, 0x01134F}, {0x011351, 0x011356}, {0x011358, 0x01135C}, {0x011364, 0x011365},
+    {0x01136D, 0x01136F}, {0x011375, 0x0113FF}, {0x01145C, 0x01145C}, {0x011462, 0x01147F},
+    {0x0114C8, 0x0114CF}, {0x0114DA, 0x01157F}, {0x0115B6, 0x0115B7}, {0x0115DE, 0x0115FF},
+    {0x011645, 0x01164F}, {0x01165A, 0x01165F}, {0x01166D, 0x01167F}, {0x0116BA, 0x0116BF},
+    {0x0116CA, 0x0116FF}, {0x01171B, 0x01171C}, {0x01172C, 0x01172F}, {0x011747, 0x0117FF},
+    {0x01183C, 0x01189F}, {0x0118F3, 0x0118FE}, {0x011907, 0x011908}, {0x01190A, 0x01190B},
+    {0x011914, 0x011914}, {0x011917, 0x011917}, {0x011936, 0x011936}, {0x011939, 0x01193A},
+    {0x011947, 0x01194F}, {0x01195A, 0x01199F}, {0x0119A8, 0x0119A9}, {0x0119D8, 0x0119D9},
+    {0x0119E5, 0x0119FF}, {0x011A48, 0x011A4F}, {0x011AA3, 0x011AAF}, {0x011AF9, 0x011BFF},
+    {0x011C09, 0x011C09}, {0x011C37, 0x011C37}, {0x011C46, 0x011C4F}, {0x011C6D, 0x011C6F},
+    {0x011C90, 0x011C91}, {0x011CA8, 0x011CA8}, {0x011CB7, 0x011CFF}, {0x011D07, 0x011D07},
+    {0x011D0A, 0x011D0A}, {0x011D37, 0x011D39}, {0x011D3B, 0x011D3B}, {0x011D3E, 0x011D3E},
+    {0x011D48, 0x011D4F}, {0x011D5A, 0x011D5F}, {0x011D66, 0x011D66}, {0x011D69, 0x011D69},
+    {0x011D8F, 0x011D8F}, {0x011D92, 0x011D92}, {0x011D99, 0x011D9F}, {0x011DAA, 0x011EDF},
+    {0x011EF9, 0x011FAF}, {0x011FB1, 0x011FBF}, {0x011FF2, 0x011FFE}, {0x01239A, 0x0123FF},
+    {0x01246F, 0x01246F}, {0x012475, 0x01247F}, {0x012544, 0x012F8F}, {0x012FF3, 0x012FFF},
+    {0x01342F, 0x01342F}, {0x013439, 0x0143FF}, {0x014647, 0x0167FF}, {0x016A39, 0x016A3F},
+    {0x016A5F, 0x016A5F}, {0x016A6A, 0x016A6D}, {0x016ABF, 0x016ABF}, {0x016ACA, 0x016ACF},
+    {0x016AEE, 0x016AEF}, {0x016AF6, 0x016AFF}, {0x016B46, 0x016B4F}, {0x016B5A, 0x016B5A},
+    {0x016B62, 0x016B62}, {0x016B78, 0x016B7C}, {0x016B90, 0x016E3F}, {0x016E9B, 0x016EFF},
+    {0x016F4B, 0x016F4E}, {0x016F88, 0x016F8E}, {0x016FA0, 0x016FDF}, {0x016FE5, 0x016FEF},
+    {0x016FF2, 0x016FFF}, {0x0187F8, 0x0187FF}, {0x018CD6, 0x018CFF}, {0x018D09, 0x01AFEF},
+    {0x01AFF4, 0x01AFF4}, {0x01AFFC, 0x01AFFC}, {0x01AFFF, 0x01AFFF}, {0x01B123, 0x01B14F},
+    {0x01B153, 0x01B163}, {0x01B168, 0x01B16F}, {0x01B2FC, 0x01BBFF}, {0x01BC6B, 0x01BC6F},
+    {0x01BC7D, 0x01BC7F}, {0x01BC89, 0x01BC8F}, {0x01BC9A, 0x01BC9B}, {0x01BCA4, 0x01CEFF},
+    {0x01CF2E, 0x01CF2F}, {0x01CF47, 0x01CF4F}, {0x01CFC4, 0x01CFFF}, {0x01D0F6, 0x01D0FF},
+    {0x01D127, 0x01D128}, {0x01D1EB, 0x01D1FF}, {0x01D246, 0x01D2DF}, {0x01D2F4, 0x01D2FF},
+    {0x01D357, 0x01D35F}, {0x01D379, 0x01D3FF}, {0x01D455, 0x01D455}, {0x01D49D, 0x01D49D},
+    {0x01D4A0, 0x01D4A1}, {0x01D4A3, 0x01D4A4}, {0x01D4A7, 0x01D4A8}, {0x01D4AD, 0x01D4AD},
+    {0x01D4BA, 0x01D4BA}, {0x01D4BC, 0x01D4BC}, {0x01D4C4, 0x01D4C4}, {0x01D506, 0x01D506},
+    {0x01D50B, 0x01D50C}, {0x01D515, 0x01D515}, {0x01D51D, 0x01D51D}, {0x01D53A, 0x01D53A},
+    {0x01D53F, 0x01D53F}, {0x01D545, 0x01D545}, {0x01D547, 0x01D549}, {0x01D551, 0x01D551},
+    {0x01D6A6, 0x01D6A7}, {0x01D7CC, 0x01D7CD}, {0x01DA8C, 0x01DA9A}, {0x01DAA0, 0x01DAA0},
+    {0x01DAB0, 0x01DEFF}, {0x01DF1F, 0x01DFFF}, {0x01E007, 0x01E007}, {0x01E019, 0x01E01A},
+    {0x01E022, 0x01E022}, {0x01E025, 0x01E025}, {0x01E02B, 0x01E0FF}, {0x01E12D, 0x01E12F},
+    {0x01E13E, 0x01E13F}, {0x01E14A, 0x01E14D}, {0x01E150, 0x01E28F}, {0x01E2AF, 0x01E2BF},
+    {0x01E2FA, 0x01E2FE}, {0x01E300, 0x01E7DF}, {0x01E7E7, 0x01E7E7}, {0x01E7EC, 0x01E7EC},
+    {0x01E7EF, 0x01E7EF}, {0x01E7FF, 0x01E7FF}, {0x01E8C5, 0x01E8C6}, {0x01E8D7, 0x01E8FF},
+    {0x01E94C, 0x01E94F}, {0x01E95A, 0x01E95D}, {0x01E960, 0x01EC70}, {0x01ECB5, 0x01ED00},
+    {0x01ED3E, 0x01EDFF}, {0x01EE04, 0x01EE04}, {0x01EE20, 0x01EE20}, {0x01EE23, 0x01EE23},
+    {0x01EE25, 0x01EE26}, {0x01EE28, 0x01EE28}, {0x01EE33, 0x01EE33}, {0x01EE38, 0x01EE38},
+    {0x01EE3A, 0x01EE3A}, {0x01EE3C, 0x01EE41}, {0x01EE43, 0x01EE46}, {0x01EE48, 0x01EE48},
+    {0x01EE4A, 0x01EE4A}, {0x01EE4C, 0x01EE4C}, {0x01EE50, 0x01EE50}, {0x01EE53, 0x01EE53},
+    {0x01EE55, 0x01EE56}, {0x01EE58, 0x01EE58}, {0x01EE5A, 0x01EE5A}, {0x01EE5C, 0x01EE5C},
+    {0x01EE5E, 0x01EE5E}, {0x01EE60, 0x01EE60}, {0x01EE63, 0x01EE63}, {0x01EE65, 0x01EE66},
+    {0x01EE6B, 0x01EE6B}, {0x01EE73, 0x01EE73}, {0x01EE78, 0x01EE78}, {0x01EE7D, 0x01EE7D},
+    {0x01EE7F, 0x01EE7F}, {0x01EE8A, 0x01EE8A}, {0x01EE9C, 0x01EEA0}, {0x01EEA4, 0x01EEA4},
+    {0x01EEAA, 0x01EEAA}, {0x01EEBC, 0x01EEEF}, {0x01EEF2, 0x01EFFF}, {0x01F02C, 0x01F02F},
+    {0x01F094, 0x01F09F}, {0x01F0AF, 0x01F0B0}, {0x01F0C0, 0x01F0C0}, {0x01F0D0, 0x01F0D0},
+    {0x01F0F6, 0x01F0FF}, {0x01F1AE, 0x01F1E5}, {0x01F203, 0x01F20F}, {0x01F23C, 0x01F23F},
+    {0x01F249, 0x01F24F}, {0x01F252, 0x01F25F}, {0x01F266, 0x01F2FF}, {0x01F6D8, 0x01F6DC},
+    {0x01F6ED, 0x01F6EF}, {0x01F6FD, 0x01F6FF}, {0x01F774, 0x01F77F}, {0x01F7D9, 0x01F7DF},
+    {0x01F7EC, 0x01F7EF}, {0x01F7F1, 0x01F7FF}, {0x01F80C, 0x01F80F}, {0x01F848, 0x01F84F},
+    {0x01F85A, 0x01F85F}, {0x01F888, 0x01F88F}, {0x01F8AE, 0x01F8AF}, {0x01F8B2, 0x01F8FF},
+    {0x01FA54, 0x01FA5F}, {0x01FA6E, 0x01FA6F}, {0x01FA75, 0x01FA77}, {0x01FA7D, 0x01FA7F},
+    {0x01FA87, 0x01FA8F}, {0x01FAAD, 0x01FAAF}, {0x01FABB, 0x01FABF}, {0x01FAC6, 0x01FACF},
+    {0x01FADA, 0x01FADF}, {0x01FAE8, 0x01FAEF}, {0x01FAF7, 0x01FAFF}, {0x01FB93, 0x01FB93},
+    {0x01FBCB, 0x01FBEF}, {0x01FBFA, 0x01FFFF}, {0x02A6E0, 0x02A6FF}, {0x02B739, 0x02B73F},
+    {0x02B81E, 0x02B81F}, {0x02CEA2, 0x02CEAF}, {0x02EBE1, 0x02F7FF}, {0x02FA1E, 0x02FFFF},
+    {0x03134B, 0x0E0000}, {0x0E0002, 0x0E001F}, {0x0E0080, 0x0E00FF}, {0x0E01F0, 0x0EFFFF},
+    {0x0FFFFE, 0x0FFFFF}, {0x10FFFE, 0x10FFFF}
+};
+
+static const Segment<char32_t> segments_Co[] = {
+    {0x00E000, 0x00F8FF}, {0x0F0000, 0x0FFFFD}, {0x100000, 0x10FFFD}
+};
+
+static const Segment<char32_t> segments_Cs[] = {
+    {0x00D800, 0x00DFFF}
+};
+
+static const Segment<char32_t> segments_L[] = {
+    {0x000041, 0x00005A}, {0x000061, 0x00007A}, {0x0000AA, 0x0000AA}, {0x0000B5, 0x0000B5},
+    {0x0000BA, 0x0000BA}, {0x0000C0, 0x0000D6}, {0x0000D8, 0x0000F6}, {0x0000F8, 0x0002C1},
+    {0x0002C6, 0x0002D1}, {0x0002E0, 0x0002E4}, {0x0002EC, 0x0002EC}, {0x0002EE, 0x0002EE},
+    {0x000370, 0x000374}, {0x000376, 0x000377}, {0x00037A, 0x00037D}, {0x00037F, 0x00037F},
+    {0x000386, 0x000386}, {0x000388, 0x00038A}, {0x00038C, 0x00038C}, {0x00038E, 0x0003A1},
+    {0x0003A3, 0x0003F5}, {0x0003F7, 0x000481}, {0x00048A, 0x00052F}, {0x000531, 0x000556},
+    {0x000559, 0x000559}, {0x000560, 0x000588}, {0x0005D0, 0x0005EA}, {0x0005EF, 0x0005F2},
+    {0x000620, 0x00064A}, {0x00066E, 0x00066F}, {0x000671, 0x0006D3}, {0x0006D5, 0x0006D5},
+    {0x0006E5, 0x0006E6}, {0x0006EE, 0x0006EF}, {0x0006FA, 0x0006FC}, {0x0006FF, 0x0006FF},
+    {0x000710, 0x000710}, {0x000712, 0x00072F}, {0x00074D, 0x0007A5}, {0x0007B1, 0x0007B1},
+    {0x0007CA, 0x0007EA}, {0x0007F4, 0x0007F5}, {0x0007FA, 0x0007FA}, {0x000800, 0x000815},
+    {0x00081A, 0x00081A}, {0x000824, 0x000824}, {0x000828, 0x000828}, {0x000840, 0x000858},
+    {0x000860, 0x00086A}, {0x000870, 0x000887}, {0x000889, 0x00088E}, {0x0008A0, 0x0008C9},
+    {0x000904, 0x000939}, {0x00093D, 0x00093D}, {0x000950, 0x000950}, {0x000958, 0x000961},
+    {0x000971, 0x000980}, {0x000985, 0x00098C}, {0x00098F, 0x000990}, {0x000993, 0x0009A8},
+    {0x0009AA, 0x0009B0}, {0x0009B2, 0x0009B2}, {0x0009B6, 0x0009B9}, {0x0009BD, 0x0009BD},
+    {0x0009CE, 0x0009CE}, {0x0009DC, 0x0009DD}, {0x0009DF, 0x0009E1}, {0x0009F0, 0x0009F1},
+    {0x0009FC, 0x0009FC}, {0x000A05, 0x000A0A}, {0x000A0F, 0x000A10}, {0x000A13, 0x000A28},
+    {0x000A2A, 0x000A30}, {0x000A32, 0x000A33}, {0x000A35, 0x000A36}, {0x000A38, 0x000A39},
+    {0x000A59, 0x000A5C}, {0x000A5E, 0x000A5E}, {0x000A72, 0x000A74}, {0x000A85, 0x000A8D},
+    {0x000A8F, 0x000A91}, {0x000A93, 0x000AA8}, {0x000AAA, 0x000AB0}, {0x000AB2, 0x000AB3},
+    {0x000AB5, 0x000AB9}, {0x000ABD, 0x000ABD}, {0x000AD0, 0x000AD0}, {0x000AE0, 0x000AE1},
+    {0x000AF9, 0x000AF9}, {0x000B05, 0x000B0C}, {0x000B0F, 0x000B10}, {0x000B13, 0x000B28},
+    {0x000B2A, 0x000B30}, {0x000B32, 0x000B33}, {0x000B35, 0x000B39}, {0x000B3D, 0x000B3D},
+    {0x000B5C, 0x000B5D}, {0x000B5F, 0x000B61}, {0x000B71, 0x000B71}, {0x000B83, 0x000B83},
+    {0x000B85, 0x000B8A}, {0x000B8E, 0x000B90}, {0x000B92, 0x000B95}, {0x000B99, 0x000B9A},
+    {0x000B9C, 0x000B9C}, {0x000B9E, 0x000B9F}, {0x000BA3, 0x000BA4}, {0x000BA8, 0x000BAA},
+    {0x000BAE, 0x000BB9}, {0x000BD0, 0x000BD0}, {0x000C05, 0x000C0C}, {0x000C0E, 0x000C10},
+    {0x000C12, 0x000C28}, {0x000C2A, 0x000C39}, {0x000C3D, 0x000C3D}, {0x000C58, 0x000C5A},
+    {0x000C5D, 0x000C5D}, {0x000C60, 0x000C61}, {0x000C80, 0x000C80}, {0x000C85, 0x000C8C},
+    {0x000C8E, 0x000C90}, {0x000C92, 0x000CA8}, {0x000CAA, 0x000CB3}, {0x000CB5, 0x000CB9},
+    {0x000CBD, 0x000CBD}, {0x000CDD, 0x000CDE}, {0x000CE0, 0x000CE1}, {0x000CF1, 0x000CF2},
+    {0x000D04, 0x000D0C}, {0x000D0E, 0x000D10}, {0x000D12, 0x000D3A}, {0x000D3D, 0x000D3D},
+    {0x000D4E, 0x000D4E}, {0x000D54, 0x000D56}, {0x000D5F, 0x000D61}, {0x000D7A, 0x000D7F},
+    {0x000D85, 0x000D96}, {0x000D9A, 0x000DB1}, {0x000DB3, 0x000DBB}, {0x000DBD, 0x000DBD},
+    {0x000DC0, 0x000DC6}, {0x000E01, 0x000E30}, {0x000E32, 0x000E33}, {0x000E40, 0x000E46},
+    {0x000E81, 0x000E82}, {0x000E84, 0x000E84}, {0x000E86, 0x000E8A}, {0x000E8C, 0x000EA3},
+    {0x000EA5, 0x000EA5}, {0x000EA7, 0x000EB0}, {0x000EB2, 0x000EB3}, {0x000EBD, 0x000EBD},
+    {0x000EC0, 0x000EC4}, {0x000EC6, 0x000EC6}, {0x000EDC, 0x000EDF}, {0x000F00, 0x000F00},
+    {0x000F40, 0x000F47}, {0x000F49, 0x000F6C}, {0x000F88, 0x000F8C}, {0x001000, 0x00102A},
+    {0x00103F, 0x00103F}, {0x001050, 0x001055}, {0x00105A, 0x00105D}, {0x001061, 0x001061},
+    {0x001065, 0x001066}, {0x00106E, 0x001070}, {0x001075, 0x001081}, {0x00108E, 0x00108E},
+    {0x0010A0, 0x0010C5}, {0x0010C7, 0x0010C7}, {0x0010CD, 0x0010CD}, {0x0010D0, 0x0010FA},
+    {0x0010FC, 0x001248}, {0x00124A, 0x00124D}, {0x001250, 0x001256}, {0x001258, 0x001258},
+    {0x00125A, 0x00125D}, {0x001260, 0x001288}, {0x00128A, 0x00128D}, {0x001290, 0x0012B0},
+    {0x0012B2, 0x0012B5}, {0x0012B8, 0x0012BE}, {0x0012C0, 0x0012C0}, {0x0012C2, 0x0012C5},
+    {0x0012C8, 0x0012D6}, {0x0012D8, 0x001310}, {0x001312, 0x001315}, {0x001318, 0x00135A},
+    {0x001380, 0x00138F}, {0x0013A0, 0x0013F5}, {0x0013F8, 0x0013FD}, {0x001401, 0x00166C},
+    {0x00166F, 0x00167F}, {0x001681, 0x00169A}, {0x0016A0, 0x0016EA}, {0x0016F1, 0x0016F8},
+    {0x001700, 0x001711}, {0x00171F, 0x001731}, {0x001740, 0x001751}, {0x001760, 0x00176C},
+    {0x00176E, 0x001770}, {0x001780, 0x0017B3}, {0x0017D7, 0x0017D7}, {0x0017DC, 0x0017DC},
+    {0x001820, 0x001878}, {0x001880, 0x001884}, {0x001887, 0x0018A8}, {0x0018AA, 0x0018AA},
+    {0x0018B0, 0x0018F5}, {0x001900, 0x00191E}, {0x001950, 0x00196D}, {0x001970, 0x001974},
+    {0x001980, 0x0019AB}, {0x0019B0, 0x0019C9}, {0x001A00, 0x001A16}, {0x001A20, 0x001A54},
+    {0x001AA7, 0x001AA7}, {0x001B05, 0x001B33}, {0x001B45, 0x001B4C}, {0x001B83, 0x001BA0},
+    {0x001BAE, 0x001BAF}, {0x001BBA, 0x001BE5}, {0x001C00, 0x001C23}, {0x001C4D, 0x001C4F},
+    {0x001C5A, 0x001C7D}, {0x001C80, 0x001C88}, {0x001C90, 0x001CBA}, {0x001CBD, 0x001CBF},
+    {0x001CE9, 0x001CEC}, {0x001CEE, 0x001CF3}, {0x001CF5, 0x001CF6}, {0x001CFA, 0x001CFA},
+    {0x001D00, 0x001DBF}, {0x001E00, 0x001F15}, {0x001F18, 0x001F1D}, {0x001F20, 0x001F45},
+    {0x001F48, 0x001F4D}, {0x001F50, 0x001F57}, {0x001F59, 0x001F59}, {0x001F5B, 0x001F5B},
+    {0x001F5D, 0x001F5D}, {0x001F5F, 0x001F7D}, {0x001F80, 0x001FB4}, {0x001FB6, 0x001FBC},
+    {0x001FBE, 0x001FBE}, {0x001FC2, 0x001FC4}, {0x001FC6, 0x001FCC}, {0x001FD0, 0x001FD3},
+    {0x001FD6, 0x001FDB}, {0x001FE0, 0x001FEC}, {0x001FF2, 0x001FF4}, {0x001FF6, 0x001FFC},
+    {0x002071, 0x002071}, {0x00207F, 0x00207F}, {0x002090, 0x00209C}, {0x002102, 0x002102},
+    {0x002107, 0x002107}, {0x00210A, 0x002113}, {0x002115, 0x002115}, {0x002119, 0x00211D},
+    {0x002124, 0x002124}, {0x002126, 0x002126}, {0x002128, 0x002128}, {0x00212A, 0x00212D},
+    {0x00212F, 0x002139}, {0x00213C, 0x00213F}, {0x002145, 0x002149}, {0x00214E, 0x00214E},
+    {0x002183, 0x002184}, {0x002C00, 0x002CE4}, {0x002CEB, 0x002CEE}, {0x002CF2, 0x002CF3},
+    {0x002D00, 0x002D25}, {0x002D27, 0x002D27}, {0x002D2D, 0x002D2D}, {0x002D30, 0x002D67},
+    {0x002D6F, 0x002D6F}, {0x002D80, 0x002D96}, {0x002DA0, 0x002DA6}, {0x002DA8, 0x002DAE},
+    {0x002DB0, 0x002DB6}, {0x002DB8, 0x002DBE}, {0x002DC0, 0x002DC6}, {0x002DC8, 0x002DCE},
+    {0x002DD0, 0x002DD6}, {0x002DD8, 0x002DDE}, {0x002E2F, 0x002E2F}, {0x003005, 0x003006},
+    {0x003031, 0x003035}, {0x00303B, 0x00303C}, {0x003041, 0x003096}, {0x00309D, 0x00309F},
+    {0x0030A1, 0x0030FA}, {0x0030FC, 0x0030FF}, {0x003105, 0x00312F}, {0x003131, 0x00318E},
+    {0x0031A0, 0x0031BF}, {0x0031F0, 0x0031FF}, {0x003400, 0x004DBF}, {0x004E00, 0x00A48C},
+    {0x00A4D0, 0x00A4FD}, {0x00A500, 0x00A60C}, {0x00A610, 0x00A61F}, {0x00A62A, 0x00A62B},
+    {0x00A640, 0x00A66E}, {0x00A67F, 0x00A69D}, {0x00A6A0, 0x00A6E5}, {0x00A717, 0x00A71F},
+    {0x00A722, 0x00A788}, {0x00A78B, 0x00A7CA}, {0x00A7D0, 0x00A7D1}, {0x00A7D3, 0x00A7D3},
+    {0x00A7D5, 0x00A7D9}, {0x00A7F2, 0x00A801}, {0x00A803, 0x00A805}, {0x00A807, 0x00A80A},
+    {0x00A80C, 0x00A822}, {0x00A840, 0x00A873}, {0x00A882, 0x00A8B3}, {0x00A8F2, 0x00A8F7},
+    {0x00A8FB, 0x00A8FB}, {0x00A8FD, 0x00A8FE}, {0x00A90A, 0x00A925}, {0x00A930, 0x00A946},
+    {0x00A960, 0x00A97C}, {0x00A984, 0x00A9B2}, {0x00A9CF, 0x00A9CF}, {0x00A9E0, 0x00A9E4},
+    {0x00A9E6, 0x00A9EF}, {0x00A9FA, 0x00A9FE}, {0x00AA00, 0x00AA28}, {0x00AA40, 0x00AA42},
+    {0x00AA44, 0x00AA4B}, {0x00AA60, 0x00AA76}, {0x00AA7A, 0x00AA7A}, {0x00AA7E, 0x00AAAF},
+    {0x00AAB1, 0x00AAB1}, {0x00AAB5, 0x00AAB6}, {0x00AAB9, 0x00AABD}, {0x00AAC0, 0x00AAC0},
+    {0x00AAC2, 0x00AAC2}, {0x00AADB, 0x00AADD}, {0x00AAE0, 0x00AAEA}, {0x00AAF2, 0x00AAF4},
+    {0x00AB01, 0x00AB06}, {0x00AB09, 0x00AB0E}, {0x00AB11, 0x00AB16}, {0x00AB20, 0x00AB26},
+    {0x00AB28, 0x00AB2E}, {0x00AB30, 0x00AB5A}, {0x00AB5C, 0x00AB69}, {0x00AB70, 0x00ABE2},
+    {0x00AC00, 0x00D7A3}, {0x00D7B0, 0x00D7C6}, {0x00D7CB, 0x00D7FB}, {0x00F900, 0x00FA6D},
+    {0x00FA70, 0x00FAD9}, {0x00FB00, 0x00FB06}, {0x00FB13, 0x00FB17}, {0x00FB1D, 0x00FB1D},
+    {0x00FB1F, 0x00FB28}, {0x00FB2A, 0x00FB36}, {0x00FB38, 0x00FB3C}, {0x00FB3E, 0x00FB3E},
+    {0x00FB40, 0x00FB41}, {0x00FB43, 0x00FB44}, {0x00FB46, 0x00FBB1}, {0x00FBD3, 0x00FD3D},
+    {0x00FD50, 0x00FD8F}, {0x00FD92, 0x00FDC7}, {0x00FDF0, 0x00FDFB}, {0x00FE70, 0x00FE74},
+    {0x00FE76, 0x00FEFC}, {0x00FF21, 0x00FF3A}, {0x00FF41, 0x00FF5A}, {0x00FF66, 0x00FFBE},
+    {0x00FFC2, 0x00FFC7}, {0x00FFCA, 0x00FFCF}, {0x00FFD2, 0x00FFD7}, {0x00FFDA, 0x00FFDC},
+    {0x010000, 0x01000B}, {0x01000D, 0x010026}, {0x010028, 0x01003A}, {0x01003C, 0x01003D},
+    {0x01003F, 0x01004D}, {0x010050, 0x01005D}, {0x010080, 0x0100FA}, {0x010280, 0x01029C},
+    {0x0102A0, 0x0102D0}, {0x010300, 0x01031F}, {0x01032D, 0x010340}, {0x010342, 0x010349},
+    {0x010350, 0x010375}, {0x010380, 0x01039D}, {0x0103A0, 0x0103C3}, {0x0103C8, 0x0103CF},
+    {0x010400, 0x01049D}, {0x0104B0, 0x0104D3}, {0x0104D8, 0x0104FB}, {0x010500, 0x010527},
+    {0x010530, 0x010563}, {0x010570, 0x01057A}, {0x01057C, 0x01058A}, {0x01058C, 0x010592},
+    {0x010594, 0x010595}, {0x010597, 0x0105A1}, {0x0105A3, 0x0105B1}, {0x0105B3, 0x0105B9},
+    {0x0105BB, 0x0105BC}, {0x010600, 0x010736}, {0x010740, 0x010755}, {0x010760, 0x010767},
+    {0x010780, 0x010785}, {0x010787, 0x0107B0}, {0x0107B2, 0x0107BA}, {0x010800, 0x010805},
+    {0x010808, 0x010808}, {0x01080A, 0x010835}, {0x010837, 0x010838}, {0x01083C, 0x01083C},
+    {0x01083F, 0x010855}, {0x010860, 0x010876}, {0x010880, 0x01089E}, {0x0108E0, 0x0108F2},
+    {0x0108F4, 0x0108F5}, {0x010900, 0x010915}, {0x010920, 0x010939}, {0x010980, 0x0109B7},
+    {0x0109BE, 0x0109BF}, {0x010A00, 0x010A00}, {0x010A10, 0x010A13}, {0x010A15, 0x010A17},
+    {0x010A19, 0x010A35}, {0x010A60, 0x010A7C}, {0x010A80, 0x010A9C}, {0x010AC0, 0x010AC7},
+    {0x010AC9, 0x010AE4}, {0x010B00, 0x010B35}, {0x010B40, 0x010B55}, {0x010B60, 0x010B72},
+    {0x010B80, 0x010B91}, {0x010C00, 0x010C48}, {0x010C80, 0x010CB2}, {0x010CC0, 0x010CF2},
+    {0x010D00, 0x010D23}, {0x010E80, 0x010EA9}, {0x010EB0, 0x010EB1}, {0x010F00, 0x010F1C},
+    {0x010F27, 0x010F27}, {0x010F30, 0x010F45}, {0x010F70, 0x010F81}, {0x010FB0, 0x010FC4},
+    {0x010FE0, 0x010FF6}, {0x011003, 0x011037}, {0x011071, 0x011072}, {0x011075, 0x011075},
+    {0x011083, 0x0110AF}, {0x0110D0, 0x0110E8}, {0x011103, 0x011126}, {0x011144, 0x011144},
+    {0x011147, 0x011147}, {0x011150, 0x011172}, {0x011176, 0x011176}, {0x011183, 0x0111B2},
+    {0x0111C1, 0x0111C4}, {0x0111DA, 0x0111DA}, {0x0111DC, 0x0111DC}, {0x011200, 0x011211},
+    {0x011213, 0x01122B}, {0x011280, 0x011286}, {0x011288, 0x011288}, {0x01128A, 0x01128D},
+    {0x01128F, 0x01129D}, {0x01129F, 0x0112A8}, {0x0112B0, 0x0112DE}, {0x011305, 0x01130C},
+    {0x01130F, 0x011310}, {0x011313, 0x011328}, {0x01132A, 0x011330}, {0x011332, 0x011333},
+    {0x011335, 0x011339}, {0x01133D, 0x01133D}, {0x011350, 0x011350}, {0x01135D, 0x011361},
+    {0x011400, 0x011434}, {0x011447, 0x01144A}, {0x01145F, 0x011461}, {0x011480, 0x0114AF},
+    {0x0114C4, 0x0114C5}, {0x0114C7, 0x0114C7}, {0x011580, 0x0115AE}, {0x0115D8, 0x0115DB},
+    {0x011600, 0x01162F}, {0x011644, 0x011644}, {0x011680, 0x0116AA}, {0x0116B8, 0x0116B8},
+    {0x011700, 0x01171A}, {0x011740, 0x011746}, {0x011800, 0x01182B}, {0x0118A0, 0x0118DF},
+    {0x0118FF, 0x011906}, {0x011909, 0x011909}, {0x01190C, 0x011913}, {0x011915, 0x011916},
+    {0x011918, 0x01192F}, {0x01193F, 0x01193F}, {0x011941, 0x011941}, {0x0119A0, 0x0119A7},
+    {0x0119AA, 0x0119D0}, {0x0119E1, 0x0119E1}, {0x0119E3, 0x0119E3}, {0x011A00, 0x011A00},
+    {0x011A0B, 0x011A32}, {0x011A3A, 0x011A3A}, {0x011A50, 0x011A50}, {0x011A5C, 0x011A89},
+    {0x011A9D, 0x011A9D}, {0x011AB0, 0x011AF8}, {0x011C00, 0x011C08}, {0x011C0A, 0x011C2E},
+    {0x011C40, 0x011C40}, {0x011C72, 0x011C8F}, {0x011D00, 0x011D06}, {0x011D08, 0x011D09},
+    {0x011D0B, 0x011D30}, {0x011D46, 0x011D46}, {0x011D60, 0x011D65}, {0x011D67, 0x011D68},
+    {0x011D6A, 0x011D89}, {0x011D98, 0x011D98}, {0x011EE0, 0x011EF2}, {0x011FB0, 0x011FB0},
+    {0x012000, 0x012399}, {0x012480, 0x012543}, {0x012F90, 0x012FF0}, {0x013000, 0x01342E},
+    {0x014400, 0x014646}, {0x016800, 0x016A38}, {0x016A40, 0x016A5E}, {0x016A70, 0x016ABE},
+    {0x016AD0, 0x016AED}, {0x016B00, 0x016B2F}, {0x016B40, 0x016B43}, {0x016B63, 0x016B77},
+    {0x016B7D, 0x016B8F}, {0x016E40, 0x016E7F}, {0x016F00, 0x016F4A}, {0x016F50, 0x016F50},
+    {0x016F93, 0x016F9F}, {0x016FE0, 0x016FE1}, {0x016FE3, 0x016FE3}, {0x017000, 0x0187F7},
+    {0x018800, 0x018CD5}, {0x018D00, 0x018D08}, {0x01AFF0, 0x01AFF3}, {0x01AFF5, 0x01AFFB},
+    {0x01AFFD, 0x01AFFE}, {0x01B000, 0x01B122}, {0x01B150, 0x01B152}, {0x01B164, 0x01B167},
+    {0x01B170, 0x01B2FB}, {0x01BC00, 0x01BC6A}, {0x01BC70, 0x01BC7C}, {0x01BC80, 0x01BC88},
+    {0x01BC90, 0x01BC99}, {0x01D400, 0x01D454}, {0x01D456, 0x01D49C}, {0x01D49E, 0x01D49F},
+    {0x01D4A2, 0x01D4A2}, {0x01D4A5, 0x01D4A6}, {0x01D4A9, 0x01D4AC}, {0x01D4AE, 0x01D4B9},
+    {0x01D4BB, 0x01D4BB}, {0x01D4BD, 0x01D4C3}, {0x01D4C5, 0x01D505}, {0x01D507, 0x01D50A},
+    {0x01D50D, 0x01D514}, {0x01D516, 0x01D51C}, {0x01D51E, 0x01D539}, {0x01D53B, 0x01D53E},
+    {0x01D540, 0x01D544}, {0x01D546, 0x01D546}, {0x01D54A, 0x01D550}, {0x01D552, 0x01D6A5},
+    {0x01D6A8, 0x01D6C0}, {0x01D6C2, 0x01D6DA}, {0x01D6DC, 0x01D6FA}, {0x01D6FC, 0x01D714},
+    {0x01D716, 0x01D734}, {0x01D736, 0x01D74E}, {0x01D750, 0x01D76E}, {0x01D770, 0x01D788},
+    {0x01D78A, 0x01D7A8}, {0x01D7AA, 0x01D7C2}, {0x01D7C4, 0x01D7CB}, {0x01DF00, 0x01DF1E},
+    {0x01E100, 0x01E12C}, {0x01E137, 0x01E13D}, {0x01E14E, 0x01E14E}, {0x01E290, 0x01E2AD},
+    {0x01E2C0, 0x01E2EB}, {0x01E7E0, 0x01E7E6}, {0x01E7E8, 0x01E7EB}, {0x01E7ED, 0x01E7EE},
+    {0x01E7F0, 0x01E7FE}, {0x01E800, 0x01E8C4}, {0x01E900, 0x01E943}, {0x01E94B, 0x01E94B},
+    {0x01EE00, 0x01EE03}, {0x01EE05, 0x01EE1F}, {0x01EE21, 0x01EE22}, {0x01EE24, 0x01EE24},
+    {0x01EE27, 0x01EE27}, {0x01EE29, 0x01EE32}, {0x01EE34, 0x01EE37}, {0x01EE39, 0x01EE39},
+    {0x01EE3B, 0x01EE3B}, {0x01EE42, 0x01EE42}, {0x01EE47, 0x01EE47}, {0x01EE49, 0x01EE49},
+    {0x01EE4B, 0x01EE4B}, {0x01EE4D, 0x01EE4F}, {0x01EE51, 0x01EE52}, {0x01EE54, 0x01EE54},
+    {0x01EE57, 0x01EE57}, {0x01EE59, 0x01EE59}, {0x01EE5B, 0x01EE5B}, {0x01EE5D, 0x01EE5D},
+    {0x01EE5F, 0x01EE5F}, {0x01EE61, 0x01EE62}, {0x01EE64, 0x01EE64}, {0x01EE67, 0x01EE6A},
+    {0x01EE6C, 0x01EE72}, {0x01EE74, 0x01EE77}, {0x01EE79, 0x01EE7C}, {0x01EE7E, 0x01EE7E},
+    {0x01EE80, 0x01EE89}, {0x01EE8B, 0x01EE9B}, {0x01EEA1, 0x01EEA3}, {0x01EEA5, 0x01EEA9},
+    {0x01EEAB, 0x01EEBB}, {0x020000, 0x02A6DF}, {0x02A700, 0x02B738}, {0x02B740, 0x02B81D},
+    {0x02B820, 0x02CEA1}, {0x02CEB0, 0x02EBE0}, {0x02F800, 0x02FA1D}, {0x030000, 0x03134A}
+};
+
+static const Segment<char32_t> segments_Ll[] = {
+    {0x000061, 0x00007A}, {0x0000B5, 0x0000B5}, {0x0000DF, 0x0000F6}, {0x0000F8, 0x0000FF},
+    {0x000101, 0x000101}, {0x000103, 0x000103}, {0x000105, 0x000105}, {0x000107, 0x000107},
+    {0x000109, 0x000109}, {0x00010B, 0x00010B}, {0x00010D, 0x00010D}, {0x00010F, 0x00010F},
+    {0x000111, 0x000111}, {0x000113, 0x000113}, {0x000115, 0x000115}, {0x000117, 0x000117},
+    {0x000119, 0x000119}, {0x00011B, 0x00011B}, {0x00011D, 0x00011D}, {0x00011F, 0x00011F},
+    {0x000121, 0x000121}, {0x000123, 0x000123}, {0x000125, 0x000125}, {0x000127, 0x000127},
+    {0x000129, 0x000129}, {0x00012B, 0x00012B}, {0x00012D, 0x00012D}, {0x00012F, 0x00012F},
+    {0x000131, 0x000131}, {0x000133, 0x000133}, {0x000135, 0x000135}, {0x000137, 0x000138},
+    {0x00013A, 0x00013A}, {0x00013C, 0x00013C}, {0x00013E, 0x00013E}, {0x000140, 0x000140},
+    {0x000142, 0x000142}, {0x000144, 0x000144}, {0x000146, 0x000146}, {0x000148, 0x000149},
+    {0x00014B, 0x00014B}, {0x00014D, 0x00014D}, {0x00014F, 0x00014F}, {0x000151, 0x000151},
+    {0x000153, 0x000153}, {0x000155, 0x000155}, {0x000157, 0x000157}, {0x000159, 0x000159},
+    {0x00015B, 0x00015B}, {0x00015D, 0x00015D}, {0x00015F, 0x00015F}, {0x000161, 0x000161},
+    {0x000163, 0x000163}, {0x000165, 0x000165}, {0x000167, 0x000167}, {0x000169, 0x000169},
+    {0x00016B, 0x00016B}, {0x00016D, 0x00016D}, {0x00016F, 0x00016F}, {0x000171, 0x000171},
+    {0x000173, 0x000173}, {0x000175, 0x000175}, {0x000177, 0x000177}, {0x00017A, 0x00017A},
+    {0x00017C, 0x00017C}, {0x00017E, 0x000180}, {0x000183, 0x000183}, {0x000185, 0x000185},
+    {0x000188, 0x000188}, {0x00018C, 0x00018D}, {0x000192, 0x000192}, {0x000195, 0x000195},
+    {0x000199, 0x00019B}, {0x00019E, 0x00019E}, {0x0001A1, 0x0001A1}, {0x0001A3, 0x0001A3},
+    {0x0001A5, 0x0001A5}, {0x0001A8, 0x0001A8}, {0x0001AA, 0x0001AB}, {0x0001AD, 0x0001AD},
+    {0x0001B0, 0x0001B0}, {0x0001B4, 0x0001B4}, {0x0001B6, 0x0001B6}, {0x0001B9, 0x0001BA},
+    {0x0001BD, 0x0001BF}, {0x0001C6, 0x0001C6}, {0x0001C9, 0x0001C9}, {0x0001CC, 0x0001CC},
+    {0x0001CE, 0x0001CE}, {0x0001D0, 0x0001D0}, {0x0001D2, 0x0001D2}, {0x0001D4, 0x0001D4},
+    {0x0001D6, 0x0001D6}, {0x0001D8, 0x0001D8}, {0x0001DA, 0x0001DA}, {0x0001DC, 0x0001DD},
+    {0x0001DF, 0x0001DF}, {0x0001E1, 0x0001E1}, {0x0001E3, 0x0001E3}, {0x0001E5, 0x0001E5},
+    {0x0001E7, 0x0001E7}, {0x0001E9, 0x0001E9}, {0x0001EB, 0x0001EB}, {0x0001ED, 0x0001ED},
+    {0x0001EF, 0x0001F0}, {0x0001F3, 0x0001F3}, {0x0001F5, 0x0001F5}, {0x0001F9, 0x0001F9},
+    {0x0001FB, 0x0001FB}, {0x0001FD, 0x0001FD}, {0x0001FF, 0x0001FF}, {0x000201, 0x000201},
+    {0x000203, 0x000203}, {0x000205, 0x000205}, {0x000207, 0x000207}, {0x000209, 0x000209},
+    {0x00020B, 0x00020B}, {0x00020D, 0x00020D}, {0x00020F, 0x00020F}, {0x000211, 0x000211},
+    {0x000213, 0x000213}, {0x000215, 0x000215}, {0x000217, 0x000217}, {0x000219, 0x000219},
+    {0x00021B, 0x00021B}, {0x00021D, 0x00021D}, {0x00021F, 0x00021F}, {0x000221, 0x000221},
+    {0x000223, 0x000223}, {0x000225, 0x000225}, {0x000227, 0x000227}, {0x000229, 0x000229},
+    {0x00022B, 0x00022B}, {0x00022D, 0x00022D}, {0x00022F, 0x00022F}, {0x000231, 0x000231},
+    {0x000233, 0x000239}, {0x00023C, 0x00023C}, {0x00023F, 0x000240}, {0x000242, 0x000242},
+    {0x000247, 0x000247}, {0x000249, 0x000249}, {0x00024B, 0x00024B}, {0x00024D, 0x00024D},
+    {0x00024F, 0x000293}, {0x000295, 0x0002AF}, {0x000371, 0x000371}, {0x000373, 0x000373},
+    {0x000377, 0x000377}, {0x00037B, 0x00037D}, {0x000390, 0x000390}, {0x0003AC, 0x0003CE},
+    {0x0003D0, 0x0003D1}, {0x0003D5, 0x0003D7}, {0x0003D9, 0x0003D9}, {0x0003DB, 0x0003DB},
+    {0x0003DD, 0x0003DD}, {0x0003DF, 0x0003DF}, {0x0003E1, 0x0003E1}, {0x0003E3, 0x0003E3},
+    {0x0003E5, 0x0003E5}, {0x0003E7, 0x0003E7}, {0x0003E9, 0x0003E9}, {0x0003EB, 0x0003EB},
+    {0x0003ED, 0x0003ED}, {0x0003EF, 0x0003F3}, {0x0003F5, 0x0003F5}, {0x0003F8, 0x0003F8},
+    {0x0003FB, 0x0003FC}, {0x000430, 0x00045F}, {0x000461, 0x000461}, {0x000463, 0x000463},
+    {0x000465, 0x000465}, {0x000467, 0x000467}, {0x000469, 0x000469}, {0x00046B, 0x00046B},
+    {0x00046D, 0x00046D}, {0x00046F, 0x00046F}, {0x000471, 0x000471}, {0x000473, 0x000473},
+    {0x000475, 0x000475}, {0x000477, 0x000477}, {0x000479, 0x000479}, {0x00047B, 0x00047B},
+    {0x00047D, 0x00047D}, {0x00047F, 0x00047F}, {0x000481, 0x000481}, {0x00048B, 0x00048B},
+    {0x00048D, 0x00048D}, {0x00048F, 0x00048F}, {0x000491, 0x000491}, {0x000493, 0x000493},
+    {0x000495, 0x000495}, {0x000497, 0x000497}, {0x000499, 0x000499}, {0x00049B, 0x00049B},
+    {0x00049D, 0x00049D}, {0x00049F, 0x00049F}, {0x0004A1, 0x0004A1}, {0x0004A3, 0x0004A3},
+    {0x0004A5, 0x0004A5}, {0x0004A7, 0x0004A7}, {0x0004A9, 0x0004A9}, {0x0004AB, 0x0004AB},
+    {0x0004AD, 0x0004AD}, {0x0004AF, 0x0004AF}, {0x0004B1, 0x0004B1}, {0x0004B3, 0x0004B3},
+    {0x0004B5, 0x0004B5}, {0x0004B7, 0x0004B7}, {0x0004B9, 0x0004B9}, {0x0004BB, 0x0004BB},
+    {0x0004BD, 0x0004BD}, {0x0004BF, 0x0004BF}, {0x0004C2, 0x0004C2}, {0x0004C4, 0x0004C4},
+    {0x0004C6, 0x0004C6}, {0x0004C8, 0x0004C8}, {0x0004CA, 0x0004CA}, {0x0004CC, 0x0004CC},
+    {0x0004CE, 0x0004CF}, {0x0004D1, 0x0004D1}, {0x0004D3, 0x0004D3}, {0x0004D5, 0x0004D5},
+    {0x0004D7, 0x0004D7}, {0x0004D9, 0x0004D9}, {0x0004DB, 0x0004DB}, {0x0004DD, 0x0004DD},
+    {0x0004DF, 0x0004DF}, {0x0004E1, 0x0004E1}, {0x0004E3, 0x0004E3}, {0x0004E5, 0x0004E5},
+    {0x0004E7, 0x0004E7}, {0x0004E9, 0x0004E9}, {0x0004EB, 0x0004EB}, {0x0004ED, 0x0004ED},
+    {0x0004EF, 0x0004EF}, {0x0004F1, 0x0004F1}, {0x0004F3, 0x0004F3}, {0x0004F5, 0x0004F5},
+    {0x0004F7, 0x0004F7}, {0x0004F9, 0x0004F9}, {0x0004FB, 0x0004FB}, {0x0004FD, 0x0004FD},
+    {0x0004FF, 0x0004FF}, {0x000501, 0x000501}, {0x000503, 0x000503}, {0x000505, 0x000505},
+    {0x000507, 0x000507}, {0x000509, 0x000509}, {0x00050B, 0x00050B}, {0x00050D, 0x00050D},
+    {0x00050F, 0x00050F}, {0x000511, 0x000511}, {0x000513, 0x000513}, {0x000515, 0x000515},
+    {0x000517, 0x000517}, {0x000519, 0x000519}, {0x00051B, 0x00051B}, {0x00051D, 0x00051D},
+    {0x00051F, 0x00051F}, {0x000521, 0x000521}, {0x000523, 0x000523}, {0x000525, 0x000525},
+    {0x000527, 0x000527}, {0x000529, 0x000529}, {0x00052B, 0x00052B}, {0x00052D, 0x00052D},
+    {0x00052F, 0x00052F}, {0x000560, 0x000588}, {0x0010D0, 0x0010FA}, {0x0010FD, 0x0010FF},
+    {0x0013F8, 0x0013FD}, {0x001C80, 0x001C88}, {0x001D00, 0x001D2B}, {0x001D6B, 0x001D77},
+    {0x001D79, 0x001D9A}, {0x001E01, 0x001E01}, {0x001E03, 0x001E03}, {0x001E05, 0x001E05},
+    {0x001E07, 0x001E07}, {0x001E09, 0x001E09}, {0x001E0B, 0x001E0B}, {0x001E0D, 0x001E0D},
+    {0x001E0F, 0x001E0F}, {0x001E11, 0x001E11}, {0x001E13, 0x001E13}, {0x001E15, 0x001E15},
+    {0x001E17, 0x001E17}, {0x001E19, 0x001E19}, {0x001E1B, 0x001E1B}, {0x001E1D, 0x001E1D},
+    {0x001E1F, 0x001E1F}, {0x001E21, 0x001E21}, {0x001E23, 0x001E23}, {0x001E25, 0x001E25},
+    {0x001E27, 0x001E27}, {0x001E29, 0x001E29}, {0x001E2B, 0x001E2B}, {0x001E2D, 0x001E2D},
+    {0x001E2F, 0x001E2F}, {0x001E31, 0x001E31}, {0x001E33, 0x001E33}, {0x001E35, 0x001E35},
+    {0x001E37, 0x001E37}, {0x001E39, 0x001E39}, {0x001E3B, 0x001E3B}, {0x001E3D, 0x001E3D},
+    {0x001E3F, 0x001E3F}, {0x001E41, 0x001E41}, {0x001E43, 0x001E43}, {0x001E45, 0x001E45},
+    {0x001E47, 0x001E47}, {0x001E49, 0x001E49}, {0x001E4B, 0x001E4B}, {0x001E4D, 0x001E4D},
+    {0x001E4F, 0x001E4F}, {0x001E51, 0x001E51}, {0x001E53, 0x001E53}, {0x001E55, 0x001E55},
+    {0x001E57, 0x001E57}, {0x001E59, 0x001E59}, {0x001E5B, 0x001E5B}, {0x001E5D, 0x001E5D},
+    {0x001E5F, 0x001E5F}, {0x001E61, 0x001E61}, {0x001E63, 0x001E63}, {0x001E65, 0x001E65},
+    {0x001E67, 0x001E67}, {0x001E69, 0x001E69}, {0x001E6B, 0x001E6B}, {0x001E6D, 0x001E6D},
+    {0x001E6F, 0x001E6F}, {0x001E71, 0x001E71}, {0x001E73, 0x001E73}, {0x001E75, 0x001E75},
+    {0x001E77, 0x001E77}, {0x001E79, 0x001E79}, {0x001E7B, 0x001E7B}, {0x001E7D, 0x001E7D},
+    {0x001E7F, 0x001E7F}, {0x001E81, 0x001E81}, {0x001E83, 0x001E83}, {0x001E85, 0x001E85},
+    {0x001E87, 0x001E87}, {0x001E89, 0x001E89}, {0x001E8B, 0x001E8B}, {0x001E8D, 0x001E8D},
+    {0x001E8F, 0x001E8F}, {0x001E91, 0x001E91}, {0x001E93, 0x001E93}, {0x001E95, 0x001E9D},
+    {0x001E9F, 0x001E9F}, {0x001EA1, 0x001EA1}, {0x001EA3, 0x001EA3}, {0x001EA5, 0x001EA5},
+    {0x001EA7, 0x001EA7}, {0x001EA9, 0x001EA9}, {0x001EAB, 0x001EAB}, {0x001EAD, 0x001EAD},
+    {0x001EAF, 0x001EAF}, {0x001EB1, 0x001EB1}, {0x001EB3, 0x001EB3}, {0x001EB5, 0x001EB5},
+    {0x001EB7, 0x001EB7}, {0x001EB9, 0x001EB9}, {0x001EBB, 0x001EBB}, {0x001EBD, 0x001EBD},
+    {0x001EBF, 0x001EBF}, {0x001EC1, 0x001EC1}, {0x001EC3, 0x001EC3}, {0x001EC5, 0x001EC5},
+    {0x001EC7, 0x001EC7}, {0x001EC9, 0x001EC9}, {0x001ECB, 0x001ECB}, {0x001ECD, 0x001ECD},
+    {0x001ECF, 0x001ECF}, {0x001ED1, 0x001ED1}, {0x001ED3, 0x001ED3}, {0x001ED5, 0x001ED5},
+    {0x001ED7, 0x001ED7}, {0x001ED9, 0x001ED9}, {0x001EDB, 0x001EDB}, {0x001EDD, 0x001EDD},
+    {0x001EDF, 0x001EDF}, {0x001EE1, 0x001EE1}, {0x001EE3, 0x001EE3}, {0x001EE5, 0x001EE5},
+    {0x001EE7, 0x001EE7}, {0x001EE9, 0x001EE9}, {0x001EEB, 0x001EEB}, {0x001EED, 0x001EED},
+    {0x001EEF, 0x001EEF}, {0x001EF1, 0x001EF1}, {0x001EF3, 0x001EF3}, {0x001EF5, 0x001EF5},
+    {0x001EF7, 0x001EF7}, {0x001EF9, 0x001EF9}, {0x001EFB, 0x001EFB}, {0x001EFD, 0x001EFD},
+    {0x001EFF, 0x001F07}, {0x001F10, 0x001F15}, {0x001F20, 0x001F27}, {0x001F30, 0x001F37},
+    {0x001F40, 0x001F45}, {0x001F50, 0x001F57}, {0x001F60, 0x001F67}, {0x001F70, 0x001F7D},
+    {0x001F80, 0x001F87}, {0x001F90, 0x001F97}, {0x001FA0, 0x001FA7}, {0x001FB0, 0x001FB4},
+    {0x001FB6, 0x001FB7}, {0x001FBE, 0x001FBE}, {0x001FC2, 0x001FC4}, {0x001FC6, 0x001FC7},
+    {0x001FD0, 0x001FD3}, {0x001FD6, 0x001FD7}, {0x001FE0, 0x001FE7}, {0x001FF2, 0x001FF4},
+    {0x001FF6, 0x001FF7}, {0x00210A, 0x00210A}, {0x00210E, 0x00210F}, {0x002113, 0x002113},
+    {0x00212F, 0x00212F}, {0x002134, 0x002134}, {0x002139, 0x002139}, {0x00213C, 0x00213D},
+    {0x002146, 0x002149}, {0x00214E, 0x00214E}, {0x002184, 0x002184}, {0x002C30, 0x002C5F},
+    {0x002C61, 0x002C61}, {0x002C65, 0x002C66}, {0x002C68, 0x002C68}, {0x002C6A, 0x002C6A},
+    {0x002C6C, 0x002C6C}, {0x002C71, 0x002C71}, {0x002C73, 0x002C74}, {0x002C76, 0x002C7B},
+    {0x002C81, 0x002C81}, {0x002C83, 0x002C83}, {0x002C85, 0x002C85}, {0x002C87, 0x002C87},
+    {0x002C89, 0x002C89}, {0x002C8B, 0x002C8B}, {0x002C8D, 0x002C8D}, {0x002C8F, 0x002C8F},
+    {0x002C91, 0x002C91}, {0x002C93, 0x002C93}, {0x002C95, 0x002C95}, {0x002C97, 0x002C97},
+    {0x002C99, 0x002C99}, {0x002C9B, 0x002C9B}, {0x002C9D, 0x002C9D}, {0x002C9F, 0x002C9F},
+    {0x002CA1, 0x002CA1}, {0x002CA3, 0x002CA3}, {0x002CA5, 0x002CA5}, {0x002CA7, 0x002CA7},
+    {0x002CA9, 0x002CA9}, {0x002CAB, 0x002CAB}, {0x002CAD, 0x002CAD}, {0x002CAF, 0x002CAF},
+    {0x002CB1, 0x002CB1}, {0x002CB3, 0x002CB3}, {0x002CB5, 0x002CB5}, {0x002CB7, 0x002CB7},
+    {0x002CB9, 0x002CB9}, {0x002CBB, 0x002CBB}, {0x002CBD, 0x002CBD}, {0x002CBF, 0x002CBF},
+    {0x002CC1, 0x002CC1}, {0x002CC3, 0x002CC3}, {0x002CC5, 0x002CC5}, {0x002CC7, 0x002CC7},
+    {0x002CC9, 0x002CC9}, {0x002CCB, 0x002CCB}, {0x002CCD, 0x002CCD}, {0x002CCF, 0x002CCF},
+    {0x002CD1, 0x002CD1}, {0x002CD3, 0x002CD3}, {0x002CD5, 0x002CD5}, {0x002CD7, 0x002CD7},
+    {0x002CD9, 0x002CD9}, {0x002CDB, 0x002CDB}, {0x002CDD, 0x002CDD}, {0x002CDF, 0x002CDF},
+    {0x002CE1, 0x002CE1}, {0x002CE3, 0x002CE4}, {0x002CEC, 0x002CEC}, {0x002CEE, 0x002CEE},
+    {0x002CF3, 0x002CF3}, {0x002D00, 0x002D25}, {0x002D27, 0x002D27}, {0x002D2D, 0x002D2D},
+    {0x00A641, 0x00A641}, {0x00A643, 0x00A643}, {0x00A645, 0x00A645}, {0x00A647, 0x00A647},
+    {0x00A649, 0x00A649}, {0x00A64B, 0x00A64B}, {0x00A64D, 0x00A64D}, {0x00A64F, 0x00A64F},
+    {0x00A651, 0x00A651}, {0x00A653, 0x00A653}, {0x00A655, 0x00A655}, {0x00A657, 0x00A657},
+    {0x00A659, 0x00A659}, {0x00A65B, 0x00A65B}, {0x00A65D, 0x00A65D}, {0x00A65F, 0x00A65F},
+    {0x00A661, 0x00A661}, {0x00A663, 0x00A663}, {0x00A665, 0x00A665}, {0x00A667, 0x00A667},
+    {0x00A669, 0x00A669}, {0x00A66B, 0x00A66B}, {0x00A66D, 0x00A66D}, {0x00A681, 0x00A681},
+    {0x00A683, 0x00A683}, {0x00A685, 0x00A685}, {0x00A687, 0x00A687}, {0x00A689, 0x00A689},
+    {0x00A68B, 0x00A68B}, {0x00A68D, 0x00A68D}, {0x00A68F, 0x00A68F}, {0x00A691, 0x00A691},
+    {0x00A693, 0x00A693}, {0x00A695, 0x00A695}, {0x00A697, 0x00A697}, {0x00A699, 0x00A699},
+    {0x00A69B, 0x00A69B}, {0x00A723, 0x00A723}, {0x00A725, 0x00A725}, {0x00A727, 0x00A727},
+    {0x00A729, 0x00A729}, {0x00A72B, 0x00A72B}, {0x00A72D, 0x00A72D}, {0x00A72F, 0x00A731},
+    {0x00A733, 0x00A733}, {0x00A735, 0x00A735}, {0x00A737, 0x00A737}, {0x00A739, 0x00A739},
+    {0x00A73B, 0x00A73B}, {0x00A73D, 0x00A73D}, {0x00A73F, 0x00A73F}, {0x00A741, 0x00A741},
+    {0x00A743, 0x00A743}, {0x00A745, 0x00A745}, {0x00A747, 0x00A747}, {0x00A749, 0x00A749},
+    {0x00A74B, 0x00A74B}, {0x00A74D, 0x00A74D}, {0x00A74F, 0x00A74F}, {0x00A751, 0x00A751},
+    {0x00A753, 0x00A753}, {0x00A755, 0x00A755}, {0x00A757, 0x00A757}, {0x00A759, 0x00A759},
+    {0x00A75B, 0x00A75B}, {0x00A75D, 0x00A75D}, {0x00A75F, 0x00A75F}, {0x00A761, 0x00A761},
+    {0x00A763, 0x00A763}, {0x00A765, 0x00A765}, {0x00A767, 0x00A767}, {0x00A769, 0x00A769},
+    {0x00A76B, 0x00A76B}, {0x00A76D, 0x00A76D}, {0x00A76F, 0x00A76F}, {0x00A771, 0x00A778},
+    {0x00A77A, 0x00A77A}, {0x00A77C, 0x00A77C}, {0x00A77F, 0x00A77F}, {0x00A781, 0x00A781},
+    {0x00A783, 0x00A783}, {0x00A785, 0x00A785}, {0x00A787, 0x00A787}, {0x00A78C, 0x00A78C},
+    {0x00A78E, 0x00A78E}, {0x00A791, 0x00A791}, {0x00A793, 0x00A795}, {0x00A797, 0x00A797},
+    {0x00A799, 0x00A799}, {0x00A79B, 0x00A79B}, {0x00A79D, 0x00A79D}, {0x00A79F, 0x00A79F},
+    {0x00A7A1, 0x00A7A1}, {0x00A7A3, 0x00A7A3}, {0x00A7A5, 0x00A7A5}, {0x00A7A7, 0x00A7A7},
+    {0x00A7A9, 0x00A7A9}, {0x00A7AF, 0x00A7AF}, {0x00A7B5, 0x00A7B5}, {0x00A7B7, 0x00A7B7},
+    {0x00A7B9, 0x00A7B9}, {0x00A7BB, 0x00A7BB}, {0x00A7BD, 0x00A7BD}, {0x00A7BF, 0x00A7BF},
+    {0x00A7C1, 0x00A7C1}, {0x00A7C3, 0x00A7C3}, {0x00A7C8, 0x00A7C8}, {0x00A7CA, 0x00A7CA},
+    {0x00A7D1, 0x00A7D1}, {0x00A7D3, 0x00A7D3}, {0x00A7D5, 0x00A7D5}, {0x00A7D7, 0x00A7D7},
+    {0x00A7D9, 0x00A7D9}, {0x00A7F6, 0x00A7F6}, {0x00A7FA, 0x00A7FA}, {0x00AB30, 0x00AB5A},
+    {0x00AB60, 0x00AB68}, {0x00AB70, 0x00ABBF}, {0x00FB00, 0x00FB06}, {0x00FB13, 0x00FB17},
+    {0x00FF41, 0x00FF5A}, {0x010428, 0x01044F}, {0x0104D8, 0x0104FB}, {0x010597, 0x0105A1},
+    {0x0105A3, 0x0105B1}, {0x0105B3, 0x0105B9}, {0x0105BB, 0x0105BC}, {0x010CC0, 0x010CF2},
+    {0x0118C0, 0x0118DF}, {0x016E60, 0x016E7F}, {0x01D41A, 0x01D433}, {0x01D44E, 0x01D454},
+    {0x01D456, 0x01D467}, {0x01D482, 0x01D49B}, {0x01D4B6, 0x01D4B9}, {0x01D4BB, 0x01D4BB},
+    {0x01D4BD, 0x01D4C3}, {0x01D4C5, 0x01D4CF}, {0x01D4EA, 0x01D503}, {0x01D51E, 0x01D537},
+    {0x01D552, 0x01D56B}, {0x01D586, 0x01D59F}, {0x01D5BA, 0x01D5D3}, {0x01D5EE, 0x01D607},
+    {0x01D622, 0x01D63B}, {0x01D656, 0x01D66F}, {0x01D68A, 0x01D6A5}, {0x01D6C2, 0x01D6DA},
+    {0x01D6DC, 0x01D6E1}, {0x01D6FC, 0x01D714}, {0x01D716, 0x01D71B}, {0x01D736, 0x01D74E},
+    {0x01D750, 0x01D755}, {0x01D770, 0x01D788}, {0x01D78A, 0x01D78F}, {0x01D7AA, 0x01D7C2},
+    {0x01D7C4, 0x01D7C9}, {0x01D7CB, 0x01D7CB}, {0x01DF00, 0x01DF09}, {0x01DF0B, 0x01DF1E},
+    {0x01E922, 0x01E943}
+};
+
+static const Segment<char32_t> segments_Lm[] = {
+    {0x0002B0, 0x0002C1}, {0x0002C6, 0x0002D1}, {0x0002E0, 0x0002E4}, {0x0002EC, 0x0002EC},
+    {0x0002EE, 0x0002EE}, {0x000374, 0x000374}, {0x00037A, 0x00037A}, {0x000559, 0x000559},
+    {0x000640, 0x000640}, {0x0006E5, 0x0006E6}, {0x0007F4, 0x0007F5}, {0x0007FA, 0x0007FA},
+    {0x00081A, 0x00081A}, {0x000824, 0x000824}, {0x000828, 0x000828}, {0x0008C9, 0x0008C9},
+    {0x000971, 0x000971}, {0x000E46, 0x000E46}, {0x000EC6, 0x000EC6}, {0x0010FC, 0x0010FC},
+    {0x0017D7, 0x0017D7}, {0x001843, 0x001843}, {0x001AA7, 0x001AA7}, {0x001C78, 0x001C7D},
+    {0x001D2C, 0x001D6A}, {0x001D78, 0x001D78}, {0x001D9B, 0x001DBF}, {0x002071, 0x002071},
+    {0x00207F, 0x00207F}, {0x002090, 0x00209C}, {0x002C7C, 0x002C7D}, {0x002D6F, 0x002D6F},
+    {0x002E2F, 0x002E2F}, {0x003005, 0x003005}, {0x003031, 0x003035}, {0x00303B, 0x00303B},
+    {0x00309D, 0x00309E}, {0x0030FC, 0x0030FE}, {0x00A015, 0x00A015}, {0x00A4F8, 0x00A4FD},
+    {0x00A60C, 0x00A60C}, {0x00A67F, 0x00A67F}, {0x00A69C, 0x00A69D}, {0x00A717, 0x00A71F},
+    {0x00A770, 0x00A770}, {0x00A788, 0x00A788}, {0x00A7F2, 0x00A7F4}, {0x00A7F8, 0x00A7F9},
+    {0x00A9CF, 0x00A9CF}, {0x00A9E6, 0x00A9E6}, {0x00AA70, 0x00AA70}, {0x00AADD, 0x00AADD},
+    {0x00AAF3, 0x00AAF4}, {0x00AB5C, 0x00AB5F}, {0x00AB69, 0x00AB69}, {0x00FF70, 0x00FF70},
+    {0x00FF9E, 0x00FF9F}, {0x010780, 0x010785}, {0x010787, 0x0107B0}, {0x0107B2, 0x0107BA},
+    {0x016B40, 0x016B43}, {0x016F93, 0x016F9F}, {0x016FE0, 0x016FE1}, {0x016FE3, 0x016FE3},
+    {0x01AFF0, 0x01AFF3}, {0x01AFF5, 0x01AFFB}, {0x01AFFD, 0x01AFFE}, {0x01E137, 0x01E13D},
+    {0x01E94B, 0x01E94B}
+};
+
+static const Segment<char32_t> segments_Lo[] = {
+    {0x0000AA, 0x0000AA}, {0x0000BA, 0x0000BA}, {0x0001BB, 0x0001BB}, {0x0001C0, 0x0001C3},
+    {0x000294, 0x000294}, {0x0005D0, 0x0005EA}, {0x0005EF, 0x0005F2}, {0x000620, 0x00063F},
+    {0x000641, 0x00064A}, {0x00066E, 0x00066F}, {0x000671, 0x0006D3}, {0x0006D5, 0x0006D5},
+    {0x0006EE, 0x0006EF}, {0x0006FA, 0x0006FC}, {0x0006FF, 0x0006FF}, {0x000710, 0x000710},
+    {0x000712, 0x00072F}, {0x00074D, 0x0007A5}, {0x0007B1, 0x0007B1}, {0x0007CA, 0x0007EA},
+    {0x000800, 0x000815}, {0x000840, 0x000858}, {0x000860, 0x00086A}, {0x000870, 0x000887},
+    {0x000889, 0x00088E}, {0x0008A0, 0x0008C8}, {0x000904, 0x000939}, {0x00093D, 0x00093D},
+    {0x000950, 0x000950}, {0x000958, 0x000961}, {0x000972, 0x000980}, {0x000985, 0x00098C},
+    {0x00098F, 0x000990}, {0x000993, 0x0009A8}, {0x0009AA, 0x0009B0}, {0x0009B2, 0x0009B2},
+    {0x0009B6, 0x0009B9}, {0x0009BD, 0x0009BD}, {0x0009CE, 0x0009CE}, {0x0009DC, 0x0009DD},
+    {0x0009DF, 0x0009E1}, {0x0009F0, 0x0009F1}, {0x0009FC, 0x0009FC}, {0x000A05, 0x000A0A},
+    {0x000A0F, 0x000A10}, {0x000A13, 0x000A28}, {0x000A2A, 0x000A30}, {0x000A32, 0x000A33},
+    {0x000A35, 0x000A36}, {0x000A38, 0x000A39}, {0x000A59, 0x000A5C}, {0x000A5E, 0x000A5E},
+    {0x000A72, 0x000A74}, {0x000A85, 0x000A8D}, {0x000A8F, 0x000A91}, {0x000A93, 0x000AA8},
+    {0x000AAA, 0x000AB0}, {0x000AB2, 0x000AB3}, {0x000AB5, 0x000AB9}, {0x000ABD, 0x000ABD},
+    {0x000AD0, 0x000AD0}, {0x000AE0, 0x000AE1}, {0x000AF9, 0x000AF9}, {0x000B05, 0x000B0C},
+    {0x000B0F, 0x000B10}, {0x000B13, 0x000B28}, {0x000B2A, 0x000B30}, {0x000B32, 0x000B33},
+    {0x000B35, 0x000B39}, {0x000B3D, 0x000B3D}, {0x000B5C, 0x000B5D}, {0x000B5F, 0x000B61},
+    {0x000B71, 0x000B71}, {0x000B83, 0x000B83}, {0x000B85, 0x000B8A}, {0x000B8E, 0x000B90},
+    {0x000B92, 0x000B95}, {0x000B99, 0x000B9A}, {0x000B9C, 0x000B9C}, {0x000B9E, 0x000B9F},
+    {0x000BA3, 0x000BA4}, {0x000BA8, 0x000BAA}, {0x000BAE, 0x000BB9}, {0x000BD0, 0x000BD0},
+    {0x000C05, 0x000C0C}, {0x000C0E, 0x000C10}, {0x000C12, 0x000C28}, {0x000C2A, 0x000C39},
+    {0x000C3D, 0x000C3D}, {0x000C58, 0x000C5A}, {0x000C5D, 0x000C5D}, {0x000C60, 0x000C61},
+    {0x000C80, 0x000C80}, {0x000C85, 0x000C8C}, {0x000C8E, 0x000C90}, {0x000C92, 0x000CA8},
+    {0x000CAA, 0x000CB3}, {0x000CB5, 0x000CB9}, {0x000CBD, 0x000CBD}, {0x000CDD, 0x000CDE},
+    {0x000CE0, 0x000CE1}, {0x000CF1, 0x000CF2}, {0x000D04, 0x000D0C}, {0x000D0E, 0x000D10},
+    {0x000D12, 0x000D3A}, {0x000D3D, 0x000D3D}, {0x000D4E, 0x000D4E}, {0x000D54, 0x000D56},
+    {0x000D5F, 0x000D61}, {0x000D7A, 0x000D7F}, {0x000D85, 0x000D96}, {0x000D9A, 0x000DB1},
+    {0x000DB3, 0x000DBB}, {0x000DBD, 0x000DBD}, {0x000DC0, 0x000DC6}, {0x000E01, 0x000E30},
+    {0x000E32, 0x000E33}, {0x000E40, 0x000E45}, {0x000E81, 0x000E82}, {0x000E84, 0x000E84},
+    {0x000E86, 0x000E8A}, {0x000E8C, 0x000EA3}, {0x000EA5, 0x000EA5}, {0x000EA7, 0x000EB0},
+    {0x000EB2, 0x000EB3}, {0x000EBD, 0x000EBD}, {0x000EC0, 0x000EC4}, {0x000EDC, 0x000EDF},
+    {0x000F00, 0x000F00}, {0x000F40, 0x000F47}, {0x000F49, 0x000F6C}, {0x000F88, 0x000F8C},
+    {0x001000, 0x00102A}, {0x00103F, 0x00103F}, {0x001050, 0x001055}, {0x00105A, 0x00105D},
+    {0x001061, 0x001061}, {0x001065, 0x001066}, {0x00106E, 0x001070}, {0x001075, 0x001081},
+    {0x00108E, 0x00108E}, {0x001100, 0x001248}, {0x00124A, 0x00124D}, {0x001250, 0x001256},
+    {0x001258, 0x001258}, {0x00125A, 0x00125D}, {0x001260, 0x001288}, {0x00128A, 0x00128D},
+    {0x001290, 0x0012B0}, {0x0012B2, 0x0012B5}, {0x0012B8, 0x0012BE}, {0x0012C0, 0x0012C0},
+    {0x0012C2, 0x0012C5}, {0x0012C8, 0x0012D6}, {0x0012D8, 0x001310}, {0x001312, 0x001315},
+    {0x001318, 0x00135A}, {0x001380, 0x00138F}, {0x001401, 0x00166C}, {0x00166F, 0x00167F},
+    {0x001681, 0x00169A}, {0x0016A0, 0x0016EA}, {0x0016F1, 0x0016F8}, {0x001700, 0x001711},
+    {0x00171F, 0x001731}, {0x001740, 0x001751}, {0x001760, 0x00176C}, {0x00176E, 0x001770},
+    {0x001780, 0x0017B3}, {0x0017DC, 0x0017DC}, {0x001820, 0x001842}, {0x001844, 0x001878},
+    {0x001880, 0x001884}, {0x001887, 0x0018A8}, {0x0018AA, 0x0018AA}, {0x0018B0, 0x0018F5},
+    {0x001900, 0x00191E}, {0x001950, 0x00196D}, {0x001970, 0x001974}, {0x001980, 0x0019AB},
+    {0x0019B0, 0x0019C9}, {0x001A00, 0x001A16}, {0x001A20, 0x001A54}, {0x001B05, 0x001B33},
+    {0x001B45, 0x001B4C}, {0x001B83, 0x001BA0}, {0x001BAE, 0x001BAF}, {0x001BBA, 0x001BE5},
+    {0x001C00, 0x001C23}, {0x001C4D, 0x001C4F}, {0x001C5A, 0x001C77}, {0x001CE9, 0x001CEC},
+    {0x001CEE, 0x001CF3}, {0x001CF5, 0x001CF6}, {0x001CFA, 0x001CFA}, {0x002135, 0x002138},
+    {0x002D30, 0x002D67}, {0x002D80, 0x002D96}, {0x002DA0, 0x002DA6}, {0x002DA8, 0x002DAE},
+    {0x002DB0, 0x002DB6}, {0x002DB8, 0x002DBE}, {0x002DC0, 0x002DC6}, {0x002DC8, 0x002DCE},
+    {0x002DD0, 0x002DD6}, {0x002DD8, 0x002DDE}, {0x003006, 0x003006}, {0x00303C, 0x00303C},
+    {0x003041, 0x003096}, {0x00309F, 0x00309F}, {0x0030A1, 0x0030FA}, {0x0030FF, 0x0030FF},
+    {0x003105, 0x00312F}, {0x003131, 0x00318E}, {0x0031A0, 0x0031BF}, {0x0031F0, 0x0031FF},
+    {0x003400, 0x004DBF}, {0x004E00, 0x00A014}, {0x00A016, 0x00A48C}, {0x00A4D0, 0x00A4F7},
+    {0x00A500, 0x00A60B}, {0x00A610, 0x00A61F}, {0x00A62A, 0x00A62B}, {0x00A66E, 0x00A66E},
+    {0x00A6A0, 0x00A6E5}, {0x00A78F, 0x00A78F}, {0x00A7F7, 0x00A7F7}, {0x00A7FB, 0x00A801},
+    {0x00A803, 0x00A805}, {0x00A807, 0x00A80A}, {0x00A80C, 0x00A822}, {0x00A840, 0x00A873},
+    {0x00A882, 0x00A8B3}, {0x00A8F2, 0x00A8F7}, {0x00A8FB, 0x00A8FB}, {0x00A8FD, 0x00A8FE},
+    {0x00A90A, 0x00A925}, {0x00A930, 0x00A946}, {0x00A960, 0x00A97C}, {0x00A984, 0x00A9B2},
+    {0x00A9E0, 0x00A9E4}, {0x00A9E7, 0x00A9EF}, {0x00A9FA, 0x00A9FE}, {0x00AA00, 0x00AA28},
+    {0x00AA40, 0x00AA42}, {0x00AA44, 0x00AA4B}, {0x00AA60, 0x00AA6F}, {0x00AA71, 0x00AA76},
+    {0x00AA7A, 0x00AA7A}, {0x00AA7E, 0x00AAAF}, {0x00AAB1, 0x00AAB1}, {0x00AAB5, 0x00AAB6},
+    {0x00AAB9, 0x00AABD}, {0x00AAC0, 0x00AAC0}, {0x00AAC2, 0x00AAC2}, {0x00AADB, 0x00AADC},
+    {0x00AAE0, 0x00AAEA}, {0x00AAF2, 0x00AAF2}, {0x00AB01, 0x00AB06}, {0x00AB09, 0x00AB0E},
+    {0x00AB11, 0x00AB16}, {0x00AB20, 0x00AB26}, {0x00AB28, 0x00AB2E}, {0x00ABC0, 0x00ABE2},
+    {0x00AC00, 0x00D7A3}, {0x00D7B0, 0x00D7C6}, {0x00D7CB, 0x00D7FB}, {0x00F900, 0x00FA6D},
+    {0x00FA70, 0x00FAD9}, {0x00FB1D, 0x00FB1D}, {0x00FB1F, 0x00FB28}, {0x00FB2A, 0x00FB36},
+    {0x00FB38, 0x00FB3C}, {0x00FB3E, 0x00FB3E}, {0x00FB40, 0x00FB41}, {0x00FB43, 0x00FB44},
+    {0x00FB46, 0x00FBB1}, {0x00FBD3, 0x00FD3D}, {0x00FD50, 0x00FD8F}, {0x00FD92, 0x00FDC7},
+    {0x00FDF0, 0x00FDFB}, {0x00FE70, 0x00FE74}, {0x00FE76, 0x00FEFC}, {0x00FF66, 0x00FF6F},
+    {0x00FF71, 0x00FF9D}, {0x00FFA0, 0x00FFBE}, {0x00FFC2, 0x00FFC7}, {0x00FFCA, 0x00FFCF},
+    {0x00FFD2, 0x00FFD7}, {0x00FFDA, 0x00FFDC}, {0x010000, 0x01000B}, {0x01000D, 0x010026},
+    {0x010028, 0x01003A}, {0x01003C, 0x01003D}, {0x01003F, 0x01004D}, {0x010050, 0x01005D},
+    {0x010080, 0x0100FA}, {0x010280, 0x01029C}, {0x0102A0, 0x0102D0}, {0x010300, 0x01031F},
+    {0x01032D, 0x010340}, {0x010342, 0x010349}, {0x010350, 0x010375}, {0x010380, 0x01039D},
+    {0x0103A0, 0x0103C3}, {0x0103C8, 0x0103CF}, {0x010450, 0x01049D}, {0x010500, 0x010527},
+    {0x010530, 0x010563}, {0x010600, 0x010736}, {0x010740, 0x010755}, {0x010760, 0x010767},
+    {0x010800, 0x010805}, {0x010808, 0x010808}, {0x01080A, 0x010835}, {0x010837, 0x010838},
+    {0x01083C, 0x01083C}, {0x01083F, 0x010855}, {0x010860, 0x010876}, {0x010880, 0x01089E},
+    {0x0108E0, 0x0108F2}, {0x0108F4, 0x0108F5}, {0x010900, 0x010915}, {0x010920, 0x010939},
+    {0x010980, 0x0109B7}, {0x0109BE, 0x0109BF}, {0x010A00, 0x010A00}, {0x010A10, 0x010A13},
+    {0x010A15, 0x010A17}, {0x010A19, 0x010A35}, {0x010A60, 0x010A7C}, {0x010A80, 0x010A9C},
+    {0x010AC0, 0x010AC7}, {0x010AC9, 0x010AE4}, {0x010B00, 0x010B35}, {0x010B40, 0x010B55},
+    {0x010B60, 0x010B72}, {0x010B80, 0x010B91}, {0x010C00, 0x010C48}, {0x010D00, 0x010D23},
+    {0x010E80, 0x010EA9}, {0x010EB0, 0x010EB1}, {0x010F00, 0x010F1C}, {0x010F27, 0x010F27},
+    {0x010F30, 0x010F45}, {0x010F70, 0x010F81}, {0x010FB0, 0x010FC4}, {0x010FE0, 0x010FF6},
+    {0x011003, 0x011037}, {0x011071, 0x011072}, {0x011075, 0x011075}, {0x011083, 0x0110AF},
+    {0x0110D0, 0x0110E8}, {0x011103, 0x011126}, {0x011144, 0x011144}, {0x011147, 0x011147},
+    {0x011150, 0x011172}, {0x011176, 0x011176}, {0x011183, 0x0111B2}, {0x0111C1, 0x0111C4},
+    {0x0111DA, 0x0111DA}, {0x0111DC, 0x0111DC}, {0x011200, 0x011211}, {0x011213, 0x01122B},
+    {0x011280, 0x011286}, {0x011288, 0x011288}, {0x01128A, 0x01128D}, {0x01128F, 0x01129D},
+    {0x01129F, 0x0112A8}, {0x0112B0, 0x0112DE}, {0x011305, 0x01130C}, {0x01130F, 0x011310},
+    {0x011313, 0x011328}, {0x01132A, 0x011330}, {0x011332, 0x011333}, {0x011335, 0x011339},
+    {0x01133D, 0x01133D}, {0x011350, 0x011350}, {0x01135D, 0x011361}, {0x011400, 0x011434},
+    {0x011447, 0x01144A}, {0x01145F, 0x011461}, {0x011480, 0x0114AF}, {0x0114C4, 0x0114C5},
+    {0x0114C7, 0x0114C7}, {0x011580, 0x0115AE}, {0x0115D8, 0x0115DB}, {0x011600, 0x01162F},
+    {0x011644, 0x011644}, {0x011680, 0x0116AA}, {0x0116B8, 0x0116B8}, {0x011700, 0x01171A},
+    {0x011740, 0x011746}, {0x011800, 0x01182B}, {0x0118FF, 0x011906}, {0x011909, 0x011909},
+    {0x01190C, 0x011913}, {0x011915, 0x011916}, {0x011918, 0x01192F}, {0x01193F, 0x01193F},
+    {0x011941, 0x011941}, {0x0119A0, 0x0119A7}, {0x0119AA, 0x0119D0}, {0x0119E1, 0x0119E1},
+    {0x0119E3, 0x0119E3}, {0x011A00, 0x011A00}, {0x011A0B, 0x011A32}, {0x011A3A, 0x011A3A},
+    {0x011A50, 0x011A50}, {0x011A5C, 0x011A89}, {0x011A9D, 0x011A9D}, {0x011AB0, 0x011AF8},
+    {0x011C00, 0x011C08}, {0x011C0A, 0x011C2E}, {0x011C40, 0x011C40}, {0x011C72, 0x011C8F},
+    {0x011D00, 0x011D06}, {0x011D08, 0x011D09}, {0x011D0B, 0x011D30}, {0x011D46, 0x011D46},
+    {0x011D60, 0x011D65}, {0x011D67, 0x011D68}, {0x011D6A, 0x011D89}, {0x011D98, 0x011D98},
+    {0x011EE0, 0x011EF2}, {0x011FB0, 0x011FB0}, {0x012000, 0x012399}, {0x012480, 0x012543},
+    {0x012F90, 0x012FF0}, {0x013000, 0x01342E}, {0x014400, 0x014646}, {0x016800, 0x016A38},
+    {0x016A40, 0x016A5E}, {0x016A70, 0x016ABE}, {0x016AD0, 0x016AED}, {0x016B00, 0x016B2F},
+    {0x016B63, 0x016B77}, {0x016B7D, 0x016B8F}, {0x016F00, 0x016F4A}, {0x016F50, 0x016F50},
+    {0x017000, 0x0187F7}, {0x018800, 0x018CD5}, {0x018D00, 0x018D08}, {0x01B000, 0x01B122},
+    {0x01B150, 0x01B152}, {0x01B164, 0x01B167}, {0x01B170, 0x01B2FB}, {0x01BC00, 0x01BC6A},
+    {0x01BC70, 0x01BC7C}, {0x01BC80, 0x01BC88}, {0x01BC90, 0x01BC99}, {0x01DF0A, 0x01DF0A},
+    {0x01E100, 0x01E12C}, {0x01E14E, 0x01E14E}, {0x01E290, 0x01E2AD}, {0x01E2C0, 0x01E2EB},
+    {0x01E7E0, 0x01E7E6}, {0x01E7E8, 0x01E7EB}, {0x01E7ED, 0x01E7EE}, {0x01E7F0, 0x01E7FE},
+    {0x01E800, 0x01E8C4}, {0x01EE00, 0x01EE03}, {0x01EE05, 0x01EE1F}, {0x01EE21, 0x01EE22},
+    {0x01EE24, 0x01EE24}, {0x01EE27, 0x01EE27}, {0x01EE29, 0x01EE32}, {0x01EE34, 0x01EE37},
+    {0x01EE39, 0x01EE39}, {0x01EE3B, 0x01EE3B}, {0x01EE42, 0x01EE42}, {0x01EE47, 0x01EE47},
+    {0x01EE49, 0x01EE49}, {0x01EE4B, 0x01EE4B}, {0x01EE4D, 0x01EE4F}, {0x01EE51, 0x01EE52},
+    {0x01EE54, 0x01EE54}, {0x01EE57, 0x01EE57}, {0x01EE59, 0x01EE59}, {0x01EE5B, 0x01EE5B},
+    {0x01EE5D, 0x01EE5D}, {0x01EE5F, 0x01EE5F}, {0x01EE61, 0x01EE62}, {0x01EE64, 0x01EE64},
+    {0x01EE67, 0x01EE6A}, {0x01EE6C, 0x01EE72}, {0x01EE74, 0x01EE77}, {0x01EE79, 0x01EE7C},
+    {0x01EE7E, 0x01EE7E}, {0x01EE80, 0x01EE89}, {0x01EE8B, 0x01EE9B}, {0x01EEA1, 0x01EEA3},
+    {0x01EEA5, 0x01EEA9}, {0x01EEAB, 0x01EEBB}, {0x020000, 0x02A6DF}, {0x02A700, 0x02B738},
+    {0x02B740, 0x02B81D}, {0x02B820, 0x02CEA1}, {0x02CEB0, 0x02EBE0}, {0x02F800, 0x02FA1D},
+    {0x030000, 0x03134A}
+};
+
+static const Segment<char32_t> segments_Lt[] = {
+    {0x0001C5, 0x0001C5}, {0x0001C8, 0x0001C8}, {0x0001CB, 0x0001CB}, {0x0001F2, 0x0001F2},
+    {0x001F88, 0x001F8F}, {0x001F98, 0x001F9F}, {0x001FA8, 0x001FAF}, {0x001FBC, 0x001FBC},
+    {0x001FCC, 0x001FCC}, {0x001FFC, 0x001FFC}
+};
+
+static const Segment<char32_t> segments_Lu[] = {
+    {0x000041, 0x00005A}, {0x0000C0, 0x0000D6}, {0x0000D8, 0x0000DE}, {0x000100, 0x000100},
+    {0x000102, 0x000102}, {0x000104, 0x000104}, {0x000106, 0x000106}, {0x000108, 0x000108},
+    {0x00010A, 0x00010A}, {0x00010C, 0x00010C}, {0x00010E, 0x00010E}, {0x000110, 0x000110},
+    {0x000112, 0x000112}, {0x000114, 0x000114}, {0x000116, 0x000116}, {0x000118, 0x000118},
+    {0x00011A, 0x00011A}, {0x00011C, 0x00011C}, {0x00011E, 0x00011E}, {0x000120, 0x000120},
+    {0x000122, 0x000122}, {0x000124, 0x000124}, {0x000126, 0x000126}, {0x000128, 0x000128},
+    {0x00012A, 0x00012A}, {0x00012C, 0x00012C}, {0x00012E, 0x00012E}, {0x000130, 0x000130},
+    {0x000132, 0x000132}, {0x000134, 0x000134}, {0x000136, 0x000136}, {0x000139, 0x000139},
+    {0x00013B, 0x00013B}, {0x00013D, 0x00013D}, {0x00013F, 0x00013F}, {0x000141, 0x000141},
+    {0x000143, 0x000143}, {0x000145, 0x000145}, {0x000147, 0x000147}, {0x00014A, 0x00014A},
+    {0x00014C, 0x00014C}, {0x00014E, 0x00014E}, {0x000150, 0x000150}, {0x000152, 0x000152},
+    {0x000154, 0x000154}, {0x000156, 0x000156}, {0x000158, 0x000158}, {0x00015A, 0x00015A},
+    {0x00015C, 0x00015C}, {0x00015E, 0x00015E}, {0x000160, 0x000160}, {0x000162, 0x000162},
+    {0x000164, 0x000164}, {0x000166, 0x000166}, {0x000168, 0x000168}, {0x00016A, 0x00016A},
+    {0x00016C, 0x00016C}, {0x00016E, 0x00016E}, {0x000170, 0x000170}, {0x000172, 0x000172},
+    {0x000174, 0x000174}, {0x000176, 0x000176}, {0x000178, 0x000179}, {0x00017B, 0x00017B},
+    {0x00017D, 0x00017D}, {0x000181, 0x000182}, {0x000184, 0x000184}, {0x000186, 0x000187},
+    {0x000189, 0x00018B}, {0x00018E, 0x000191}, {0x000193, 0x000194}, {0x000196, 0x000198},
+    {0x00019C, 0x00019D}, {0x00019F, 0x0001A0}, {0x0001A2, 0x0001A2}, {0x0001A4, 0x0001A4},
+    {0x0001A6, 0x0001A7}, {0x0001A9, 0x0001A9}, {0x0001AC, 0x0001AC}, {0x0001AE, 0x0001AF},
+    {0x0001B1, 0x0001B3}, {0x0001B5, 0x0001B5}, {0x0001B7, 0x0001B8}, {0x0001BC, 0x0001BC},
+    {0x0001C4, 0x0001C4}, {0x0001C7, 0x0001C7}, {0x0001CA, 0x0001CA}, {0x0001CD, 0x0001CD},
+    {0x0001CF, 0x0001CF}, {0x0001D1, 0x0001D1}, {0x0001D3, 0x0001D3}, {0x0001D5, 0x0001D5},
+    {0x0001D7, 0x0001D7}, {0x0001D9, 0x0001D9}, {0x0001DB, 0x0001DB}, {0x0001DE, 0x0001DE},
+    {0x0001E0, 0x0001E0}, {0x0001E2, 0x0001E2}, {0x0001E4, 0x0001E4}, {0x0001E6, 0x0001E6},
+    {0x0001E8, 0x0001E8}, {0x0001EA, 0x0001EA}, {0x0001EC, 0x0001EC}, {0x0001EE, 0x0001EE},
+    {0x0001F1, 0x0001F1}, {0x0001F4, 0x0001F4}, {0x0001F6, 0x0001F8}, {0x0001FA, 0x0001FA},
+    {0x0001FC, 0x0001FC}, {0x0001FE, 0x0001FE}, {0x000200, 0x000200}, {0x000202, 0x000202},
+    {0x000204, 0x000204}, {0x000206, 0x000206}, {0x000208, 0x000208}, {0x00020A, 0x00020A},
+    {0x00020C, 0x00020C}, {0x00020E, 0x00020E}, {0x000210, 0x000210}, {0x000212, 0x000212},
+    {0x000214, 0x000214}, {0x000216, 0x000216}, {0x000218, 0x000218}, {0x00021A, 0x00021A},
+    {0x00021C, 0x00021C}, {0x00021E, 0x00021E}, {0x000220, 0x000220}, {0x000222, 0x000222},
+    {0x000224, 0x000224}, {0x000226, 0x000226}, {0x000228, 0x000228}, {0x00022A, 0x00022A},
+    {0x00022C, 0x00022C}, {0x00022E, 0x00022E}, {0x000230, 0x000230}, {0x000232, 0x000232},
+    {0x00023A, 0x00023B}, {0x00023D, 0x00023E}, {0x000241, 0x000241}, {0x000243, 0x000246},
+    {0x000248, 0x000248}, {0x00024A, 0x00024A}, {0x00024C, 0x00024C}, {0x00024E, 0x00024E},
+    {0x000370, 0x000370}, {0x000372, 0x000372}, {0x000376, 0x000376}, {0x00037F, 0x00037F},
+    {0x000386, 0x000386}, {0x000388, 0x00038A}, {0x00038C, 0x00038C}, {0x00038E, 0x00038F},
+    {0x000391, 0x0003A1}, {0x0003A3, 0x0003AB}, {0x0003CF, 0x0003CF}, {0x0003D2, 0x0003D4},
+    {0x0003D8, 0x0003D8}, {0x0003DA, 0x0003DA}, {0x0003DC, 0x0003DC}, {0x0003DE, 0x0003DE},
+    {0x0003E0, 0x0003E0}, {0x0003E2, 0x0003E2}, {0x0003E4, 0x0003E4}, {0x0003E6, 0x0003E6},
+    {0x0003E8, 0x0003E8}, {0x0003EA, 0x0003EA}, {0x0003EC, 0x0003EC}, {0x0003EE, 0x0003EE},
+    {0x0003F4, 0x0003F4}, {0x0003F7, 0x0003F7}, {0x0003F9, 0x0003FA}, {0x0003FD, 0x00042F},
+    {0x000460, 0x000460}, {0x000462, 0x000462}, {0x000464, 0x000464}, {0x000466, 0x000466},
+    {0x000468, 0x000468}, {0x00046A, 0x00046A}, {0x00046C, 0x00046C}, {0x00046E, 0x00046E},
+    {0x000470, 0x000470}, {0x000472, 0x000472}, {0x000474, 0x000474}, {0x000476, 0x000476},
+    {0x000478, 0x000478}, {0x00047A, 0x00047A}, {0x00047C, 0x00047C}, {0x00047E, 0x00047E},
+    {0x000480, 0x000480}, {0x00048A, 0x00048A}, {0x00048C, 0x00048C}, {0x00048E, 0x00048E},
+    {0x000490, 0x000490}, {0x000492, 0x000492}, {0x000494, 0x000494}, {0x000496, 0x000496},
+    {0x000498, 0x000498}, {0x00049A, 0x00049A}, {0x00049C, 0x00049C}, {0x00049E, 0x00049E},
+    {0x0004A0, 0x0004A0}, {0x0004A2, 0x0004A2}, {0x0004A4, 0x0004A4}, {0x0004A6, 0x0004A6},
+    {0x0004A8, 0x0004A8}, {0x0004AA, 0x0004AA}, {0x0004AC, 0x0004AC}, {0x0004AE, 0x0004AE},
+    {0x0004B0, 0x0004B0}, {0x0004B2, 0x0004B2}, {0x0004B4, 0x0004B4}, {0x0004B6, 0x0004B6},
+    {0x0004B8, 0x0004B8}, {0x0004BA, 0x0004BA}, {0x0004BC, 0x0004BC}, {0x0004BE, 0x0004BE},
+    {0x0004C0, 0x0004C1}, {0x0004C3, 0x0004C3}, {0x0004C5, 0x0004C5}, {0x0004C7, 0x0004C7},
+    {0x0004C9, 0x0004C9}, {0x0004CB, 0x0004CB}, {0x0004CD, 0x0004CD}, {0x0004D0, 0x0004D0},
+    {0x0004D2, 0x0004D2}, {0x0004D4, 0x0004D4}, {0x0004D6, 0x0004D6}, {0x0004D8, 0x0004D8},
+    {0x0004DA, 0x0004DA}, {0x0004DC, 0x0004DC}, {0x0004DE, 0x0004DE}, {0x0004E0, 0x0004E0},
+    {0x0004E2, 0x0004E2}, {0x0004E4, 0x0004E4}, {0x0004E6, 0x0004E6}, {0x0004E8, 0x0004E8},
+    {0x0004EA, 0x0004EA}, {0x0004EC, 0x0004EC}, {0x0004EE, 0x0004EE}, {0x0004F0, 0x0004F0},
+    {0x0004F2, 0x0004F2}, {0x0004F4, 0x0004F4}, {0x0004F6, 0x0004F6}, {0x0004F8, 0x0004F8},
+    {0x0004FA, 0x0004FA}, {0x0004FC, 0x0004FC}, {0x0004FE, 0x0004FE}, {0x000500, 0x000500},
+    {0x000502, 0x000502}, {0x000504, 0x000504}, {0x000506, 0x000506}, {0x000508, 0x000508},
+    {0x00050A, 0x00050A}, {0x00050C, 0x00050C}, {0x00050E, 0x00050E}, {0x000510, 0x000510},
+    {0x000512, 0x000512}, {0x000514, 0x000514}, {0x000516, 0x000516}, {0x000518, 0x000518},
+    {0x00051A, 0x00051A}, {0x00051C, 0x00051C}, {0x00051E, 0x00051E}, {0x000520, 0x000520},
+    {0x000522, 0x000522}, {0x000524, 0x000524}, {0x000526, 0x000526}, {0x000528, 0x000528},
+    {0x00052A, 0x00052A}, {0x00052C, 0x00052C}, {0x00052E, 0x00052E}, {0x000531, 0x000556},
+    {0x0010A0, 0x0010C5}, {0x0010C7, 0x0010C7}, {0x0010CD, 0x0010CD}, {0x0013A0, 0x0013F5},
+    {0x001C90, 0x001CBA}, {0x001CBD, 0x001CBF}, {0x001E00, 0x001E00}, {0x001E02, 0x001E02},
+    {0x001E04, 0x001E04}, {0x001E06, 0x001E06}, {0x001E08, 0x001E08}, {0x001E0A, 0x001E0A},
+    {0x001E0C, 0x001E0C}, {0x001E0E, 0x001E0E}, {0x001E10, 0x001E10}, {0x001E12, 0x001E12},
+    {0x001E14, 0x001E14}, {0x001E16, 0x001E16}, {0x001E18, 0x001E18}, {0x001E1A, 0x001E1A},
+    {0x001E1C, 0x001E1C}, {0x001E1E, 0x001E1E}, {0x001E20, 0x001E20}, {0x001E22, 0x001E22},
+    {0x001E24, 0x001E24}, {0x001E26, 0x001E26}, {0x001E28, 0x001E28}, {0x001E2A, 0x001E2A},
+    {0x001E2C, 0x001E2C}, {0x001E2E, 0x001E2E}, {0x001E30, 0x001E30}, {0x001E32, 0x001E32},
+    {0x001E34, 0x001E34}, {0x001E36, 0x001E36}, {0x001E38, 0x001E38}, {0x001E3A, 0x001E3A},
+    {0x001E3C, 0x001E3C}, {0x001E3E, 0x001E3E}, {0x001E40, 0x001E40}, {0x001E42, 0x001E42},
+    {0x001E44, 0x001E44}, {0x001E46, 0x001E46}, {0x001E48, 0x001E48}, {0x001E4A, 0x001E4A},
+    {0x001E4C, 0x001E4C}, {0x001E4E, 0x001E4E}, {0x001E50, 0x001E50}, {0x001E52, 0x001E52},
+    {0x001E54, 0x001E54}, {0x001E56, 0x001E56}, {0x001E58, 0x001E58}, {0x001E5A, 0x001E5A},
+    {0x001E5C, 0x001E5C}, {0x001E5E, 0x001E5E}, {0x001E60, 0x001E60}, {0x001E62, 0x001E62},
+    {0x001E64, 0x001E64}, {0x001E66, 0x001E66}, {0x001E68, 0x001E68}, {0x001E6A, 0x001E6A},
+    {0x001E6C, 0x001E6C}, {0x001E6E, 0x001E6E}, {0x001E70, 0x001E70}, {0x001E72, 0x001E72},
+    {0x001E74, 0x001E74}, {0x001E76, 0x001E76}, {0x001E78, 0x001E78}, {0x001E7A, 0x001E7A},
+    {0x001E7C, 0x001E7C}, {0x001E7E, 0x001E7E}, {0x001E80, 0x001E80}, {0x001E82, 0x001E82},
+    {0x001E84, 0x001E84}, {0x001E86, 0x001E86}, {0x001E88, 0x001E88}, {0x001E8A, 0x001E8A},
+    {0x001E8C, 0x001E8C}, {0x001E8E, 0x001E8E}, {0x001E90, 0x001E90}, {0x001E92, 0x001E92},
+    {0x001E94, 0x001E94}, {0x001E9E, 0x001E9E}, {0x001EA0, 0x001EA0}, {0x001EA2, 0x001EA2},
+    {0x001EA4, 0x001EA4}, {0x001EA6, 0x001EA6}, {0x001EA8, 0x001EA8}, {0x001EAA, 0x001EAA},
+    {0x001EAC, 0x001EAC}, {0x001EAE, 0x001EAE}, {0x001EB0, 0x001EB0}, {0x001EB2, 0x001EB2},
+    {0x001EB4, 0x001EB4}, {0x001EB6, 0x001EB6}, {0x001EB8, 0x001EB8}, {0x001EBA, 0x001EBA},
+    {0x001EBC, 0x001EBC}, {0x001EBE, 0x001EBE}, {0x001EC0, 0x001EC0}, {0x001EC2, 0x001EC2},
+    {0x001EC4, 0x001EC4}, {0x001EC6, 0x001EC6}, {0x001EC8, 0x001EC8}, {0x001ECA, 0x001ECA},
+    {0x001ECC, 0x001ECC}, {0x001ECE, 0x001ECE}, {0x001ED0, 0x001ED0}, {0x001ED2, 0x001ED2},
+    {0x001ED4, 0x001ED4}, {0x001ED6, 0x001ED6}, {0x001ED8, 0x001ED8}, {0x001EDA, 0x001EDA},
+    {0x001EDC, 0x001EDC}, {0x001EDE, 0x001EDE}, {0x001EE0, 0x001EE0}, {0x001EE2, 0x001EE2},
+    {0x001EE4, 0x001EE4}, {0x001EE6, 0x001EE6}, {0x001EE8, 0x001EE8}, {0x001EEA, 0x001EEA},
+    {0x001EEC, 0x001EEC}, {0x001EEE, 0x001EEE}, {0x001EF0, 0x001EF0}, {0x001EF2, 0x001EF2},
+    {0x001EF4, 0x001EF4}, {0x001EF6, 0x001EF6}, {0x001EF8, 0x001EF8}, {0x001EFA, 0x001EFA},
+    {0x001EFC, 0x001EFC}, {0x001EFE, 0x001EFE}, {0x001F08, 0x001F0F}, {0x001F18, 0x001F1D},
+    {0x001F28, 0x001F2F}, {0x001F38, 0x001F3F}, {0x001F48, 0x001F4D}, {0x001F59, 0x001F59},
+    {0x001F5B, 0x001F5B}, {0x001F5D, 0x001F5D}, {0x001F5F, 0x001F5F}, {0x001F68, 0x001F6F},
+    {0x001FB8, 0x001FBB}, {0x001FC8, 0x001FCB}, {0x001FD8, 0x001FDB}, {0x001FE8, 0x001FEC},
+    {0x001FF8, 0x001FFB}, {0x002102, 0x002102}, {0x002107, 0x002107}, {0x00210B, 0x00210D},
+    {0x002110, 0x002112}, {0x002115, 0x002115}, {0x002119, 0x00211D}, {0x002124, 0x002124},
+    {0x002126, 0x002126}, {0x002128, 0x002128}, {0x00212A, 0x00212D}, {0x002130, 0x002133},
+    {0x00213E, 0x00213F}, {0x002145, 0x002145}, {0x002183, 0x002183}, {0x002C00, 0x002C2F},
+    {0x002C60, 0x002C60}, {0x002C62, 0x002C64}, {0x002C67, 0x002C67}, {0x002C69, 0x002C69},
+    {0x002C6B, 0x002C6B}, {0x002C6D, 0x002C70}, {0x002C72, 0x002C72}, {0x002C75, 0x002C75},
+    {0x002C7E, 0x002C80}, {0x002C82, 0x002C82}, {0x002C84, 0x002C84}, {0x002C86, 0x002C86},
+    {0x002C88, 0x002C88}, {0x002C8A, 0x002C8A}, {0x002C8C, 0x002C8C}, {0x002C8E, 0x002C8E},
+    {0x002C90, 0x002C90}, {0x002C92, 0x002C92}, {0x002C94, 0x002C94}, {0x002C96, 0x002C96},
+    {0x002C98, 0x002C98}, {0x002C9A, 0x002C9A}, {0x002C9C, 0x002C9C}, {0x002C9E, 0x002C9E},
+    {0x002CA0, 0x002CA0}, {0x002CA2, 0x002CA2}, {0x002CA4, 0x002CA4}, {0x002CA6, 0x002CA6},
+    {0x002CA8, 0x002CA8}, {0x002CAA, 0x002CAA}, {0x002CAC, 0x002CAC}, {0x002CAE, 0x002CAE},
+    {0x002CB0, 0x002CB0}, {0x002CB2, 0x002CB2}, {0x002CB4, 0x002CB4}, {0x002CB6, 0x002CB6},
+    {0x002CB8, 0x002CB8}, {0x002CBA, 0x002CBA}, {0x002CBC, 0x002CBC}, {0x002CBE, 0x002CBE},
+    {0x002CC0, 0x002CC0}, {0x002CC2, 0x002CC2}, {0x002CC4, 0x002CC4}, {0x002CC6, 0x002CC6},
+    {0x002CC8, 0x002CC8}, {0x002CCA, 0x002CCA}, {0x002CCC, 0x002CCC}, {0x002CCE, 0x002CCE},
+    {0x002CD0, 0x002CD0}, {0x002CD2, 0x002CD2}, {0x002CD4, 0x002CD4}, {0x002CD6, 0x002CD6},
+    {0x002CD8, 0x002CD8}, {0x002CDA, 0x002CDA}, {0x002CDC, 0x002CDC}, {0x002CDE, 0x002CDE},
+    {0x002CE0, 0x002CE0}, {0x002CE2, 0x002CE2}, {0x002CEB, 0x002CEB}, {0x002CED, 0x002CED},
+    {0x002CF2, 0x002CF2}, {0x00A640, 0x00A640}, {0x00A642, 0x00A642}, {0x00A644, 0x00A644},
+    {0x00A646, 0x00A646}, {0x00A648, 0x00A648}, {0x00A64A, 0x00A64A}, {0x00A64C, 0x00A64C},
+    {0x00A64E, 0x00A64E}, {0x00A650, 0x00A650}, {0x00A652, 0x00A652}, {0x00A654, 0x00A654},
+    {0x00A656, 0x00A656}, {0x00A658, 0x00A658}, {0x00A65A, 0x00A65A}, {0x00A65C, 0x00A65C},
+    {0x00A65E, 0x00A65E}, {0x00A660, 0x00A660}, {0x00A662, 0x00A662}, {0x00A664, 0x00A664},
+    {0x00A666, 0x00A666}, {0x00A668, 0x00A668}, {0x00A66A, 0x00A66A}, {0x00A66C, 0x00A66C},
+    {0x00A680, 0x00A680}, {0x00A682, 0x00A682}, {0x00A684, 0x00A684}, {0x00A686, 0x00A686},
+    {0x00A688, 0x00A688}, {0x00A68A, 0x00A68A}, {0x00A68C, 0x00A68C}, {0x00A68E, 0x00A68E},
+    {0x00A690, 0x00A690}, {0x00A692, 0x00A692}, {0x00A694, 0x00A694}, {0x00A696, 0x00A696},
+    {0x00A698, 0x00A698}, {0x00A69A, 0x00A69A}, {0x00A722, 0x00A722}, {0x00A724, 0x00A724},
+    {0x00A726, 0x00A726}, {0x00A728, 0x00A728}, {0x00A72A, 0x00A72A}, {0x00A72C, 0x00A72C},
+    {0x00A72E, 0x00A72E}, {0x00A732, 0x00A732}, {0x00A734, 0x00A734}, {0x00A736, 0x00A736},
+    {0x00A738, 0x00A738}, {0x00A73A, 0x00A73A}, {0x00A73C, 0x00A73C}, {0x00A73E, 0x00A73E},
+    {0x00A740, 0x00A740}, {0x00A742, 0x00A742}, {0x00A744, 0x00A744}, {0x00A746, 0x00A746},
+    {0x00A748, 0x00A748}, {0x00A74A, 0x00A74A}, {0x00A74C, 0x00A74C}, {0x00A74E, 0x00A74E},
+    {0x00A750, 0x00A750}, {0x00A752, 0x00A752}, {0x00A754, 0x00A754}, {0x00A756, 0x00A756},
+    {0x00A758, 0x00A758}, {0x00A75A, 0x00A75A}, {0x00A75C, 0x00A75C}, {0x00A75E, 0x00A75E},
+    {0x00A760, 0x00A760}, {0x00A762, 0x00A762}, {0x00A764, 0x00A764}, {0x00A766, 0x00A766},
+    {0x00A768, 0x00A768}, {0x00A76A, 0x00A76A}, {0x00A76C, 0x00A76C}, {0x00A76E, 0x00A76E},
+    {0x00A779, 0x00A779}, {0x00A77B, 0x00A77B}, {0x00A77D, 0x00A77E}, {0x00A780, 0x00A780},
+    {0x00A782, 0x00A782}, {0x00A784, 0x00A784}, {0x00A786, 0x00A786}, {0x00A78B, 0x00A78B},
+    {0x00A78D, 0x00A78D}, {0x00A790, 0x00A790}, {0x00A792, 0x00A792}, {0x00A796, 0x00A796},
+    {0x00A798, 0x00A798}, {0x00A79A, 0x00A79A}, {0x00A79C, 0x00A79C}, {0x00A79E, 0x00A79E},
+    {0x00A7A0, 0x00A7A0}, {0x00A7A2, 0x00A7A2}, {0x00A7A4, 0x00A7A4}, {0x00A7A6, 0x00A7A6},
+    {0x00A7A8, 0x00A7A8}, {0x00A7AA, 0x00A7AE}, {0x00A7B0, 0x00A7B4}, {0x00A7B6, 0x00A7B6},
+    {0x00A7B8, 0x00A7B8}, {0x00A7BA, 0x00A7BA}, {0x00A7BC, 0x00A7BC}, {0x00A7BE, 0x00A7BE},
+    {0x00A7C0, 0x00A7C0}, {0x00A7C2, 0x00A7C2}, {0x00A7C4, 0x00A7C7}, {0x00A7C9, 0x00A7C9},
+    {0x00A7D0, 0x00A7D0}, {0x00A7D6, 0x00A7D6}, {0x00A7D8, 0x00A7D8}, {0x00A7F5, 0x00A7F5},
+    {0x00FF21, 0x00FF3A}, {0x010400, 0x010427}, {0x0104B0, 0x0104D3}, {0x010570, 0x01057A},
+    {0x01057C, 0x01058A}, {0x01058C, 0x010592}, {0x010594, 0x010595}, {0x010C80, 0x010CB2},
+    {0x0118A0, 0x0118BF}, {0x016E40, 0x016E5F}, {0x01D400, 0x01D419}, {0x01D434, 0x01D44D},
+    {0x01D468, 0x01D481}, {0x01D49C, 0x01D49C}, {0x01D49E, 0x01D49F}, {0x01D4A2, 0x01D4A2},
+    {0x01D4A5, 0x01D4A6}, {0x01D4A9, 0x01D4AC}, {0x01D4AE, 0x01D4B5}, {0x01D4D0, 0x01D4E9},
+    {0x01D504, 0x01D505}, {0x01D507, 0x01D50A}, {0x01D50D, 0x01D514}, {0x01D516, 0x01D51C},
+    {0x01D538, 0x01D539}, {0x01D53B, 0x01D53E}, {0x01D540, 0x01D544}, {0x01D546, 0x01D546},
+    {0x01D54A, 0x01D550}, {0x01D56C, 0x01D585}, {0x01D5A0, 0x01D5B9}, {0x01D5D4, 0x01D5ED},
+    {0x01D608, 0x01D621}, {0x01D63C, 0x01D655}, {0x01D670, 0x01D689}, {0x01D6A8, 0x01D6C0},
+    {0x01D6E2, 0x01D6FA}, {0x01D71C, 0x01D734}, {0x01D756, 0x01D76E}, {0x01D790, 0x01D7A8},
+    {0x01D7CA, 0x01D7CA}, {0x01E900, 0x01E921}
+};
+
+static const Segment<char32_t> segments_M[] = {
+    {0x000300, 0x00036F}, {0x000483, 0x000489}, {0x000591, 0x0005BD}, {0x0005BF, 0x0005BF},
+    {0x0005C1, 0x0005C2}, {0x0005C4, 0x0005C5}, {0x0005C7, 0x0005C7}, {0x000610, 0x00061A},
+    {0x00064B, 0x00065F}, {0x000670, 0x000670}, {0x0006D6, 0x0006DC}, {0x0006DF, 0x0006E4},
+    {0x0006E7, 0x0006E8}, {0x0006EA, 0x0006ED}, {0x000711, 0x000711}, {0x000730, 0x00074A},
+    {0x0007A6, 0x0007B0}, {0x0007EB, 0x0007F3}, {0x0007FD, 0x0007FD}, {0x000816, 0x000819},
+    {0x00081B, 0x000823}, {0x000825, 0x000827}, {0x000829, 0x00082D}, {0x000859, 0x00085B},
+    {0x000898, 0x00089F}, {0x0008CA, 0x0008E1}, {0x0008E3, 0x000903}, {0x00093A, 0x00093C},
+    {0x00093E, 0x00094F}, {0x000951, 0x000957}, {0x000962, 0x000963}, {0x000981, 0x000983},
+    {0x0009BC, 0x0009BC}, {0x0009BE, 0x0009C4}, {0x0009C7, 0x0009C8}, {0x0009CB, 0x0009CD},
+    {0x0009D7, 0x0009D7}, {0x0009E2, 0x0009E3}, {0x0009FE, 0x0009FE}, {0x000A01, 0x000A03},
+    {0x000A3C, 0x000A3C}, {0x000A3E, 0x000A42}, {0x000A47, 0x000A48}, {0x000A4B, 0x000A4D},
+    {0x000A51, 0x000A51}, {0x000A70, 0x000A71}, {0x000A75, 0x000A75}, {0x000A81, 0x000A83},
+    {0x000ABC, 0x000ABC}, {0x000ABE, 0x000AC5}, {0x000AC7, 0x000AC9}, {0x000ACB, 0x000ACD},
+    {0x000AE2, 0x000AE3}, {0x000AFA, 0x000AFF}, {0x000B01, 0x000B03}, {0x000B3C, 0x000B3C},
+    {0x000B3E, 0x000B44}, {0x000B47, 0x000B48}, {0x000B4B, 0x000B4D}, {0x000B55, 0x000B57},
+    {0x000B62, 0x000B63}, {0x000B82, 0x000B82}, {0x000BBE, 0x000BC2}, {0x000BC6, 0x000BC8},
+    {0x000BCA, 0x000BCD}, {0x000BD7, 0x000BD7}, {0x000C00, 0x000C04}, {0x000C3C, 0x000C3C},
+    {0x000C3E, 0x000C44}, {0x000C46, 0x000C48}, {0x000C4A, 0x000C4D}, {0x000C55, 0x000C56},
+    {0x000C62, 0x000C63}, {0x000C81, 0x000C83}, {0x000CBC, 0x000CBC}, {0x000CBE, 0x000CC4},
+    {0x000CC6, 0x000CC8}, {0x000CCA, 0x000CCD}, {0x000CD5, 0x000CD6}, {0x000CE2, 0x000CE3},
+    {0x000D00, 0x000D03}, {0x000D3B, 0x000D3C}, {0x000D3E, 0x000D44}, {0x000D46, 0x000D48},
+    {0x000D4A, 0x000D4D}, {0x000D57, 0x000D57}, {0x000D62, 0x000D63}, {0x000D81, 0x000D83},
+    {0x000DCA, 0x000DCA}, {0x000DCF, 0x000DD4}, {0x000DD6, 0x000DD6}, {0x000DD8, 0x000DDF},
+    {0x000DF2, 0x000DF3}, {0x000E31, 0x000E31}, {0x000E34, 0x000E3A}, {0x000E47, 0x000E4E},
+    {0x000EB1, 0x000EB1}, {0x000EB4, 0x000EBC}, {0x000EC8, 0x000ECD}, {0x000F18, 0x000F19},
+    {0x000F35, 0x000F35}, {0x000F37, 0x000F37}, {0x000F39, 0x000F39}, {0x000F3E, 0x000F3F},
+    {0x000F71, 0x000F84}, {0x000F86, 0x000F87}, {0x000F8D, 0x000F97}, {0x000F99, 0x000FBC},
+    {0x000FC6, 0x000FC6}, {0x00102B, 0x00103E}, {0x001056, 0x001059}, {0x00105E, 0x001060},
+    {0x001062, 0x001064}, {0x001067, 0x00106D}, {0x001071, 0x001074}, {0x001082, 0x00108D},
+    {0x00108F, 0x00108F}, {0x00109A, 0x00109D}, {0x00135D, 0x00135F}, {0x001712, 0x001715},
+    {0x001732, 0x001734}, {0x001752, 0x001753}, {0x001772, 0x001773}, {0x0017B4, 0x0017D3},
+    {0x0017DD, 0x0017DD}, {0x00180B, 0x00180D}, {0x00180F, 0x00180F}, {0x001885, 0x001886},
+    {0x0018A9, 0x0018A9}, {0x001920, 0x00192B}, {0x001930, 0x00193B}, {0x001A17, 0x001A1B},
+    {0x001A55, 0x001A5E}, {0x001A60, 0x001A7C}, {0x001A7F, 0x001A7F}, {0x001AB0, 0x001ACE},
+    {0x001B00, 0x001B04}, {0x001B34, 0x001B44}, {0x001B6B, 0x001B73}, {0x001B80, 0x001B82},
+    {0x001BA1, 0x001BAD}, {0x001BE6, 0x001BF3}, {0x001C24, 0x001C37}, {0x001CD0, 0x001CD2},
+    {0x001CD4, 0x001CE8}, {0x001CED, 0x001CED}, {0x001CF4, 0x001CF4}, {0x001CF7, 0x001CF9},
+    {0x001DC0, 0x001DFF}, {0x0020D0, 0x0020F0}, {0x002CEF, 0x002CF1}, {0x002D7F, 0x002D7F},
+    {0x002DE0, 0x002DFF}, {0x00302A, 0x00302F}, {0x003099, 0x00309A}, {0x00A66F, 0x00A672},
+    {0x00A674, 0x00A67D}, {0x00A69E, 0x00A69F}, {0x00A6F0, 0x00A6F1}, {0x00A802, 0x00A802},
+    {0x00A806, 0x00A806}, {0x00A80B, 0x00A80B}, {0x00A823, 0x00A827}, {0x00A82C, 0x00A82C},
+    {0x00A880, 0x00A881}, {0x00A8B4, 0x00A8C5}, {0x00A8E0, 0x00A8F1}, {0x00A8FF, 0x00A8FF},
+    {0x00A926, 0x00A92D}, {0x00A947, 0x00A953}, {0x00A980, 0x00A983}, {0x00A9B3, 0x00A9C0},
+    {0x00A9E5, 0x00A9E5}, {0x00AA29, 0x00AA36}, {0x00AA43, 0x00AA43}, {0x00AA4C, 0x00AA4D},
+    {0x00AA7B, 0x00AA7D}, {0x00AAB0, 0x00AAB0}, {0x00AAB2, 0x00AAB4}, {0x00AAB7, 0x00AAB8},
+    {0x00AABE, 0x00AABF}, {0x00AAC1, 0x00AAC1}, {0x00AAEB, 0x00AAEF}, {0x00AAF5, 0x00AAF6},
+    {0x00ABE3, 0x00ABEA}, {0x00ABEC, 0x00ABED}, {0x00FB1E, 0x00FB1E}, {0x00FE00, 0x00FE0F},
+    {0x00FE20, 0x00FE2F}, {0x0101FD, 0x0101FD}, {0x0102E0, 0x0102E0}, {0x010376, 0x01037A},
+    {0x010A01, 0x010A03}, {0x010A05, 0x010A06}, {0x010A0C, 0x010A0F}, {0x010A38, 0x010A3A},
+    {0x010A3F, 0x010A3F}, {0x010AE5, 0x010AE6}, {0x010D24, 0x010D27}, {0x010EAB, 0x010EAC},
+    {0x010F46, 0x010F50}, {0x010F82, 0x010F85}, {0x011000, 0x011002}, {0x011038, 0x011046},
+    {0x011070, 0x011070}, {0x011073, 0x011074}, {0x01107F, 0x011082}, {0x0110B0, 0x0110BA},
+    {0x0110C2, 0x0110C2}, {0x011100, 0x011102}, {0x011127, 0x011134}, {0x011145, 0x011146},
+    {0x011173, 0x011173}, {0x011180, 0x011182}, {0x0111B3, 0x0111C0}, {0x0111C9, 0x0111CC},
+    {0x0111CE, 0x0111CF}, {0x01122C, 0x011237}, {0x01123E, 0x01123E}, {0x0112DF, 0x0112EA},
+    {0x011300, 0x011303}, {0x01133B, 0x01133C}, {0x01133E, 0x011344}, {0x011347, 0x011348},
+    {0x01134B, 0x01134D}, {0x011357, 0x011357}, {0x011362, 0x011363}, {0x011366, 0x01136C},
+    {0x011370, 0x011374}, {0x011435, 0x011446}, {0x01145E, 0x01145E}, {0x0114B0, 0x0114C3},
+    {0x0115AF, 0x0115B5}, {0x0115B8, 0x0115C0}, {0x0115DC, 0x0115DD}, {0x011630, 0x011640},
+    {0x0116AB, 0x0116B7}, {0x01171D, 0x01172B}, {0x01182C, 0x01183A}, {0x011930, 0x011935},
+    {0x011937, 0x011938}, {0x01193B, 0x01193E}, {0x011940, 0x011940}, {0x011942, 0x011943},
+    {0x0119D1, 0x0119D7}, {0x0119DA, 0x0119E0}, {0x0119E4, 0x0119E4}, {0x011A01, 0x011A0A},
+    {0x011A33, 0x011A39}, {0x011A3B, 0x011A3E}, {0x011A47, 0x011A47}, {0x011A51, 0x011A5B},
+    {0x011A8A, 0x011A99}, {0x011C2F, 0x011C36}, {0x011C38, 0x011C3F}, {0x011C92, 0x011CA7},
+    {0x011CA9, 0x011CB6}, {0x011D31, 0x011D36}, {0x011D3A, 0x011D3A}, {0x011D3C, 0x011D3D},
+    {0x011D3F, 0x011D45}, {0x011D47, 0x011D47}, {0x011D8A, 0x011D8E}, {0x011D90, 0x011D91},
+    {0x011D93, 0x011D97}, {0x011EF3, 0x011EF6}, {0x016AF0, 0x016AF4}, {0x016B30, 0x016B36},
+    {0x016F4F, 0x016F4F}, {0x016F51, 0x016F87}, {0x016F8F, 0x016F92}, {0x016FE4, 0x016FE4},
+    {0x016FF0, 0x016FF1}, {0x01BC9D, 0x01BC9E}, {0x01CF00, 0x01CF2D}, {0x01CF30, 0x01CF46},
+    {0x01D165, 0x01D169}, {0x01D16D, 0x01D172}, {0x01D17B, 0x01D182}, {0x01D185, 0x01D18B},
+    {0x01D1AA, 0x01D1AD}, {0x01D242, 0x01D244}, {0x01DA00, 0x01DA36}, {0x01DA3B, 0x01DA6C},
+    {0x01DA75, 0x01DA75}, {0x01DA84, 0x01DA84}, {0x01DA9B, 0x01DA9F}, {0x01DAA1, 0x01DAAF},
+    {0x01E000, 0x01E006}, {0x01E008, 0x01E018}, {0x01E01B, 0x01E021}, {0x01E023, 0x01E024},
+    {0x01E026, 0x01E02A}, {0x01E130, 0x01E136}, {0x01E2AE, 0x01E2AE}, {0x01E2EC, 0x01E2EF},
+    {0x01E8D0, 0x01E8D6}, {0x01E944, 0x01E94A}, {0x0E0100, 0x0E01EF}
+};
+
+static const Segment<char32_t> segments_Mc[] = {
+    {0x000903, 0x000903}, {0x00093B, 0x00093B}, {0x00093E, 0x000940}, {0x000949, 0x00094C},
+    {0x00094E, 0x00094F}, {0x000982, 0x000983}, {0x0009BE, 0x0009C0}, {0x0009C7, 0x0009C8},
+    {0x0009CB, 0x0009CC}, {0x0009D7, 0x0009D7}, {0x000A03, 0x000A03}, {0x000A3E, 0x000A40},
+    {0x000A83, 0x000A83}, {0x000ABE, 0x000AC0}, {0x000AC9, 0x000AC9}, {0x000ACB, 0x000ACC},
+    {0x000B02, 0x000B03}, {0x000B3E, 0x000B3E}, {0x000B40, 0x000B40}, {0x000B47, 0x000B48},
+    {0x000B4B, 0x000B4C}, {0x000B57, 0x000B57}, {0x000BBE, 0x000BBF}, {0x000BC1, 0x000BC2},
+    {0x000BC6, 0x000BC8}, {0x000BCA, 0x000BCC}, {0x000BD7, 0x000BD7}, {0x000C01, 0x000C03},
+    {0x000C41, 0x000C44}, {0x000C82, 0x000C83}, {0x000CBE, 0x000CBE}, {0x000CC0, 0x000CC4},
+    {0x000CC7, 0x000CC8}, {0x000CCA, 0x000CCB}, {0x000CD5, 0x000CD6}, {0x000D02, 0x000D03},
+    {0x000D3E, 0x000D40}, {0x000D46, 0x000D48}, {0x000D4A, 0x000D4C}, {0x000D57, 0x000D57},
+    {0x000D82, 0x000D83}, {0x000DCF, 0x000DD1}, {0x000DD8, 0x000DDF}, {0x000DF2, 0x000DF3},
+    {0x000F3E, 0x000F3F}, {0x000F7F, 0x000F7F}, {0x00102B, 0x00102C}, {0x001031, 0x001031},
+    {0x001038, 0x001038}, {0x00103B, 0x00103C}, {0x001056, 0x001057}, {0x001062, 0x001064},
+    {0x001067, 0x00106D}, {0x001083, 0x001084}, {0x001087, 0x00108C}, {0x00108F, 0x00108F},
+    {0x00109A, 0x00109C}, {0x001715, 0x001715}, {0x001734, 0x001734}, {0x0017B6, 0x0017B6},
+    {0x0017BE, 0x0017C5}, {0x0017C7, 0x0017C8}, {0x001923, 0x001926}, {0x001929, 0x00192B},
+    {0x001930, 0x001931}, {0x001933, 0x001938}, {0x001A19, 0x001A1A}, {0x001A55, 0x001A55},
+    {0x001A57, 0x001A57}, {0x001A61, 0x001A61}, {0x001A63, 0x001A64}, {0x001A6D, 0x001A72},
+    {0x001B04, 0x001B04}, {0x001B35, 0x001B35}, {0x001B3B, 0x001B3B}, {0x001B3D, 0x001B41},
+    {0x001B43, 0x001B44}, {0x001B82, 0x001B82}, {0x001BA1, 0x001BA1}, {0x001BA6, 0x001BA7},
+    {0x001BAA, 0x001BAA}, {0x001BE7, 0x001BE7}, {0x001BEA, 0x001BEC}, {0x001BEE, 0x001BEE},
+    {0x001BF2, 0x001BF3}, {0x001C24, 0x001C2B}, {0x001C34, 0x001C35}, {0x001CE1, 0x001CE1},
+    {0x001CF7, 0x001CF7}, {0x00302E, 0x00302F}, {0x00A823, 0x00A824}, {0x00A827, 0x00A827},
+    {0x00A880, 0x00A881}, {0x00A8B4, 0x00A8C3}, {0x00A952, 0x00A953}, {0x00A983, 0x00A983},
+    {0x00A9B4, 0x00A9B5}, {0x00A9BA, 0x00A9BB}, {0x00A9BE, 0x00A9C0}, {0x00AA2F, 0x00AA30},
+    {0x00AA33, 0x00AA34}, {0x00AA4D, 0x00AA4D}, {0x00AA7B, 0x00AA7B}, {0x00AA7D, 0x00AA7D},
+    {0x00AAEB, 0x00AAEB}, {0x00AAEE, 0x00AAEF}, {0x00AAF5, 0x00AAF5}, {0x00ABE3, 0x00ABE4},
+    {0x00ABE6, 0x00ABE7}, {0x00ABE9, 0x00ABEA}, {0x00ABEC, 0x00ABEC}, {0x011000, 0x011000},
+    {0x011002, 0x011002}, {0x011082, 0x011082}, {0x0110B0, 0x0110B2}, {0x0110B7, 0x0110B8},
+    {0x01112C, 0x01112C}, {0x011145, 0x011146}, {0x011182, 0x011182}, {0x0111B3, 0x0111B5},
+    {0x0111BF, 0x0111C0}, {0x0111CE, 0x0111CE}, {0x01122C, 0x01122E}, {0x011232, 0x011233},
+    {0x011235, 0x011235}, {0x0112E0, 0x0112E2}, {0x011302, 0x011303}, {0x01133E, 0x01133F},
+    {0x011341, 0x011344}, {0x011347, 0x011348}, {0x01134B, 0x01134D}, {0x011357, 0x011357},
+    {0x011362, 0x011363}, {0x011435, 0x011437}, {0x011440, 0x011441}, {0x011445, 0x011445},
+    {0x0114B0, 0x0114B2}, {0x0114B9, 0x0114B9}, {0x0114BB, 0x0114BE}, {0x0114C1, 0x0114C1},
+    {0x0115AF, 0x0115B1}, {0x0115B8, 0x0115BB}, {0x0115BE, 0x0115BE}, {0x011630, 0x011632},
+    {0x01163B, 0x01163C}, {0x01163E, 0x01163E}, {0x0116AC, 0x0116AC}, {0x0116AE, 0x0116AF},
+    {0x0116B6, 0x0116B6}, {0x011720, 0x011721}, {0x011726, 0x011726}, {0x01182C, 0x01182E},
+    {0x011838, 0x011838}, {0x011930, 0x011935}, {0x011937, 0x011938}, {0x01193D, 0x01193D},
+    {0x011940, 0x011940}, {0x011942, 0x011942}, {0x0119D1, 0x0119D3}, {0x0119DC, 0x0119DF},
+    {0x0119E4, 0x0119E4}, {0x011A39, 0x011A39}, {0x011A57, 0x011A58}, {0x011A97, 0x011A97},
+    {0x011C2F, 0x011C2F}, {0x011C3E, 0x011C3E}, {0x011CA9, 0x011CA9}, {0x011CB1, 0x011CB1},
+    {0x011CB4, 0x011CB4}, {0x011D8A, 0x011D8E}, {0x011D93, 0x011D94}, {0x011D96, 0x011D96},
+    {0x011EF5, 0x011EF6}, {0x016F51, 0x016F87}, {0x016FF0, 0x016FF1}, {0x01D165, 0x01D166},
+    {0x01D16D, 0x01D172}
+};
+
+static const Segment<char32_t> segments_Me[] = {
+    {0x000488, 0x000489}, {0x001ABE, 0x001ABE}, {0x0020DD, 0x0020E0}, {0x0020E2, 0x0020E4},
+    {0x00A670, 0x00A672}
+};
+
+static const Segment<char32_t> segments_Mn[] = {
+    {0x000300, 0x00036F}, {0x000483, 0x000487}, {0x000591, 0x0005BD}, {0x0005BF, 0x0005BF},
+    {0x0005C1, 0x0005C2}, {0x0005C4, 0x0005C5}, {0x0005C7, 0x0005C7}, {0x000610, 0x00061A},
+    {0x00064B, 0x00065F}, {0x000670, 0x000670}, {0x0006D6, 0x0006DC}, {0x0006DF, 0x0006E4},
+    {0x0006E7, 0x0006E8}, {0x0006EA, 0x0006ED}, {0x000711, 0x000711}, {0x000730, 0x00074A},
+    {0x0007A6, 0x0007B0}, {0x0007EB, 0x0007F3}, {0x0007FD, 0x0007FD}, {0x000816, 0x000819},
+    {0x00081B, 0x000823}, {0x000825, 0x000827}, {0x000829, 0x00082D}, {0x000859, 0x00085B},
+    {0x000898, 0x00089F}, {0x0008CA, 0x0008E1}, {0x0008E3, 0x000902}, {0x00093A, 0x00093A},
+    {0x00093C, 0x00093C}, {0x000941, 0x000948}, {0x00094D, 0x00094D}, {0x000951, 0x000957},
+    {0x000962, 0x000963}, {0x000981, 0x000981}, {0x0009BC, 0x0009BC}, {0x0009C1, 0x0009C4},
+    {0x0009CD, 0x0009CD}, {0x0009E2, 0x0009E3}, {0x0009FE, 0x0009FE}, {0x000A01, 0x000A02},
+    {0x000A3C, 0x000A3C}, {0x000A41, 0x000A42}, {0x000A47, 0x000A48}, {0x000A4B, 0x000A4D},
+    {0x000A51, 0x000A51}, {0x000A70, 0x000A71}, {0x000A75, 0x000A75}, {0x000A81, 0x000A82},
+    {0x000ABC, 0x000ABC}, {0x000AC1, 0x000AC5}, {0x000AC7, 0x000AC8}, {0x000ACD, 0x000ACD},
+    {0x000AE2, 0x000AE3}, {0x000AFA, 0x000AFF}, {0x000B01, 0x000B01}, {0x000B3C, 0x000B3C},
+    {0x000B3F, 0x000B3F}, {0x000B41, 0x000B44}, {0x000B4D, 0x000B4D}, {0x000B55, 0x000B56},
+    {0x000B62, 0x000B63}, {0x000B82, 0x000B82}, {0x000BC0, 0x000BC0}, {0x000BCD, 0x000BCD},
+    {0x000C00, 0x000C00}, {0x000C04, 0x000C04}, {0x000C3C, 0x000C3C}, {0x000C3E, 0x000C40},
+    {0x000C46, 0x000C48}, {0x000C4A, 0x000C4D}, {0x000C55, 0x000C56}, {0x000C62, 0x000C63},
+    {0x000C81, 0x000C81}, {0x000CBC, 0x000CBC}, {0x000CBF, 0x000CBF}, {0x000CC6, 0x000CC6},
+    {0x000CCC, 0x000CCD}, {0x000CE2, 0x000CE3}, {0x000D00, 0x000D01}, {0x000D3B, 0x000D3C},
+    {0x000D41, 0x000D44}, {0x000D4D, 0x000D4D}, {0x000D62, 0x000D63}, {0x000D81, 0x000D81},
+    {0x000DCA, 0x000DCA}, {0x000DD2, 0x000DD4}, {0x000DD6, 0x000DD6}, {0x000E31, 0x000E31},
+    {0x000E34, 0x000E3A}, {0x000E47, 0x000E4E}, {0x000EB1, 0x000EB1}, {0x000EB4, 0x000EBC},
+    {0x000EC8, 0x000ECD}, {0x000F18, 0x000F19}, {0x000F35, 0x000F35}, {0x000F37, 0x000F37},
+    {0x000F39, 0x000F39}, {0x000F71, 0x000F7E}, {0x000F80, 0x000F84}, {0x000F86, 0x000F87},
+    {0x000F8D, 0x000F97}, {0x000F99, 0x000FBC}, {0x000FC6, 0x000FC6}, {0x00102D, 0x001030},
+    {0x001032, 0x001037}, {0x001039, 0x00103A}, {0x00103D, 0x00103E}, {0x001058, 0x001059},
+    {0x00105E, 0x001060}, {0x001071, 0x001074}, {0x001082, 0x001082}, {0x001085, 0x001086},
+    {0x00108D, 0x00108D}, {0x00109D, 0x00109D}, {0x00135D, 0x00135F}, {0x001712, 0x001714},
+    {0x001732, 0x001733}, {0x001752, 0x001753}, {0x001772, 0x001773}, {0x0017B4, 0x0017B5},
+    {0x0017B7, 0x0017BD}, {0x0017C6, 0x0017C6}, {0x0017C9, 0x0017D3}, {0x0017DD, 0x0017DD},
+    {0x00180B, 0x00180D}, {0x00180F, 0x00180F}, {0x001885, 0x001886}, {0x0018A9, 0x0018A9},
+    {0x001920, 0x001922}, {0x001927, 0x001928}, {0x001932, 0x001932}, {0x001939, 0x00193B},
+    {0x001A17, 0x001A18}, {0x001A1B, 0x001A1B}, {0x001A56, 0x001A56}, {0x001A58, 0x001A5E},
+    {0x001A60, 0x001A60}, {0x001A62, 0x001A62}, {0x001A65, 0x001A6C}, {0x001A73, 0x001A7C},
+    {0x001A7F, 0x001A7F}, {0x001AB0, 0x001ABD}, {0x001ABF, 0x001ACE}, {0x001B00, 0x001B03},
+    {0x001B34, 0x001B34}, {0x001B36, 0x001B3A}, {0x001B3C, 0x001B3C}, {0x001B42, 0x001B42},
+    {0x001B6B, 0x001B73}, {0x001B80, 0x001B81}, {0x001BA2, 0x001BA5}, {0x001BA8, 0x001BA9},
+    {0x001BAB, 0x001BAD}, {0x001BE6, 0x001BE6}, {0x001BE8, 0x001BE9}, {0x001BED, 0x001BED},
+    {0x001BEF, 0x001BF1}, {0x001C2C, 0x001C33}, {0x001C36, 0x001C37}, {0x001CD0, 0x001CD2},
+    {0x001CD4, 0x001CE0}, {0x001CE2, 0x001CE8}, {0x001CED, 0x001CED}, {0x001CF4, 0x001CF4},
+    {0x001CF8, 0x001CF9}, {0x001DC0, 0x001DFF}, {0x0020D0, 0x0020DC}, {0x0020E1, 0x0020E1},
+    {0x0020E5, 0x0020F0}, {0x002CEF, 0x002CF1}, {0x002D7F, 0x002D7F}, {0x002DE0, 0x002DFF},
+    {0x00302A, 0x00302D}, {0x003099, 0x00309A}, {0x00A66F, 0x00A66F}, {0x00A674, 0x00A67D},
+    {0x00A69E, 0x00A69F}, {0x00A6F0, 0x00A6F1}, {0x00A802, 0x00A802}, {0x00A806, 0x00A806},
+    {0x00A80B, 0x00A80B}, {0x00A825, 0x00A826}, {0x00A82C, 0x00A82C}, {0x00A8C4, 0x00A8C5},
+    {0x00A8E0, 0x00A8F1}, {0x00A8FF, 0x00A8FF}, {0x00A926, 0x00A92D}, {0x00A947, 0x00A951},
+    {0x00A980, 0x00A982}, {0x00A9B3, 0x00A9B3}, {0x00A9B6, 0x00A9B9}, {0x00A9BC, 0x00A9BD},
+    {0x00A9E5, 0x00A9E5}, {0x00AA29, 0x00AA2E}, {0x00AA31, 0x00AA32}, {0x00AA35, 0x00AA36},
+    {0x00AA43, 0x00AA43}, {0x00AA4C, 0x00AA4C}, {0x00AA7C, 0x00AA7C}, {0x00AAB0, 0x00AAB0},
+    {0x00AAB2, 0x00AAB4}, {0x00AAB7, 0x00AAB8}, {0x00AABE, 0x00AABF}, {0x00AAC1, 0x00AAC1},
+    {0x00AAEC, 0x00AAED}, {0x00AAF6, 0x00AAF6}, {0x00ABE5, 0x00ABE5}, {0x00ABE8, 0x00ABE8},
+    {0x00ABED, 0x00ABED}, {0x00FB1E, 0x00FB1E}, {0x00FE00, 0x00FE0F}, {0x00FE20, 0x00FE2F},
+    {0x0101FD, 0x0101FD}, {0x0102E0, 0x0102E0}, {0x010376, 0x01037A}, {0x010A01, 0x010A03},
+    {0x010A05, 0x010A06}, {0x010A0C, 0x010A0F}, {0x010A38, 0x010A3A}, {0x010A3F, 0x010A3F},
+    {0x010AE5, 0x010AE6}, {0x010D24, 0x010D27}, {0x010EAB, 0x010EAC}, {0x010F46, 0x010F50},
+    {0x010F82, 0x010F85}, {0x011001, 0x011001}, {0x011038, 0x011046}, {0x011070, 0x011070},
+    {0x011073, 0x011074}, {0x01107F, 0x011081}, {0x0110B3, 0x0110B6}, {0x0110B9, 0x0110BA},
+    {0x0110C2, 0x0110C2}, {0x011100, 0x011102}, {0x011127, 0x01112B}, {0x01112D, 0x011134},
+    {0x011173, 0x011173}, {0x011180, 0x011181}, {0x0111B6, 0x0111BE}, {0x0111C9, 0x0111CC},
+    {0x0111CF, 0x0111CF}, {0x01122F, 0x011231}, {0x011234, 0x011234}, {0x011236, 0x011237},
+    {0x01123E, 0x01123E}, {0x0112DF, 0x0112DF}, {0x0112E3, 0x0112EA}, {0x011300, 0x011301},
+    {0x01133B, 0x01133C}, {0x011340, 0x011340}, {0x011366, 0x01136C}, {0x011370, 0x011374},
+    {0x011438, 0x01143F}, {0x011442, 0x011444}, {0x011446, 0x011446}, {0x01145E, 0x01145E},
+    {0x0114B3, 0x0114B8}, {0x0114BA, 0x0114BA}, {0x0114BF, 0x0114C0}, {0x0114C2, 0x0114C3},
+    {0x0115B2, 0x0115B5}, {0x0115BC, 0x0115BD}, {0x0115BF, 0x0115C0}, {0x0115DC, 0x0115DD},
+    {0x011633, 0x01163A}, {0x01163D, 0x01163D}, {0x01163F, 0x011640}, {0x0116AB, 0x0116AB},
+    {0x0116AD, 0x0116AD}, {0x0116B0, 0x0116B5}, {0x0116B7, 0x0116B7}, {0x01171D, 0x01171F},
+    {0x011722, 0x011725}, {0x011727, 0x01172B}, {0x01182F, 0x011837}, {0x011839, 0x01183A},
+    {0x01193B, 0x01193C}, {0x01193E, 0x01193E}, {0x011943, 0x011943}, {0x0119D4, 0x0119D7},
+    {0x0119DA, 0x0119DB}, {0x0119E0, 0x0119E0}, {0x011A01, 0x011A0A}, {0x011A33, 0x011A38},
+    {0x011A3B, 0x011A3E}, {0x011A47, 0x011A47}, {0x011A51, 0x011A56}, {0x011A59, 0x011A5B},
+    {0x011A8A, 0x011A96}, {0x011A98, 0x011A99}, {0x011C30, 0x011C36}, {0x011C38, 0x011C3D},
+    {0x011C3F, 0x011C3F}, {0x011C92, 0x011CA7}, {0x011CAA, 0x011CB0}, {0x011CB2, 0x011CB3},
+    {0x011CB5, 0x011CB6}, {0x011D31, 0x011D36}, {0x011D3A, 0x011D3A}, {0x011D3C, 0x011D3D},
+    {0x011D3F, 0x011D45}, {0x011D47, 0x011D47}, {0x011D90, 0x011D91}, {0x011D95, 0x011D95},
+    {0x011D97, 0x011D97}, {0x011EF3, 0x011EF4}, {0x016AF0, 0x016AF4}, {0x016B30, 0x016B36},
+    {0x016F4F, 0x016F4F}, {0x016F8F, 0x016F92}, {0x016FE4, 0x016FE4}, {0x01BC9D, 0x01BC9E},
+    {0x01CF00, 0x01CF2D}, {0x01CF30, 0x01CF46}, {0x01D167, 0x01D169}, {0x01D17B, 0x01D182},
+    {0x01D185, 0x01D18B}, {0x01D1AA, 0x01D1AD}, {0x01D242, 0x01D244}, {0x01DA00, 0x01DA36},
+    {0x01DA3B, 0x01DA6C}, {0x01DA75, 0x01DA75}, {0x01DA84, 0x01DA84}, {0x01DA9B, 0x01DA9F},
+    {0x01DAA1, 0x01DAAF}, {0x01E000, 0x01E006}, {0x01E008, 0x01E018}, {0x01E01B, 0x01E021},
+    {0x01E023, 0x01E024}, {0x01E026, 0x01E02A}, {0x01E130, 0x01E136}, {0x01E2AE, 0x01E2AE},
+    {0x01E2EC, 0x01E2EF}, {0x01E8D0, 0x01E8D6}, {0x01E944, 0x01E94A}, {0x0E0100, 0x0E01EF}
+};
+
+static const Segment<char32_t> segments_N[] = {
+    {0x000030, 0x000039}, {0x0000B2, 0x0000B3}, {0x0000B9, 0x0000B9}, {0x0000BC, 0x0000BE},
+    {0x000660, 0x000669}, {0x0006F0, 0x0006F9}, {0x0007C0, 0x0007C9}, {0x000966, 0x00096F},
+    {0x0009E6, 0x0009EF}, {0x0009F4, 0x0009F9}, {0x000A66, 0x000A6F}, {0x000AE6, 0x000AEF},
+    {0x000B66, 0x000B6F}, {0x000B72, 0x000B77}, {0x000BE6, 0x000BF2}, {0x000C66, 0x000C6F},
+    {0x000C78, 0x000C7E}, {0x000CE6, 0x000CEF}, {0x000D58, 0x000D5E}, {0x000D66, 0x000D78},
+    {0x000DE6, 0x000DEF}, {0x000E50, 0x000E59}, {0x000ED0, 0x000ED9}, {0x000F20, 0x000F33},
+    {0x001040, 0x001049}, {0x001090, 0x001099}, {0x001369, 0x00137C}, {0x0016EE, 0x0016F0},
+    {0x0017E0, 0x0017E9}, {0x0017F0, 0x0017F9}, {0x001810, 0x001819}, {0x001946, 0x00194F},
+    {0x0019D0, 0x0019DA}, {0x001A80, 0x001A89}, {0x001A90, 0x001A99}, {0x001B50, 0x001B59},
+    {0x001BB0, 0x001BB9}, {0x001C40, 0x001C49}, {0x001C50, 0x001C59}, {0x002070, 0x002070},
+    {0x002074, 0x002079}, {0x002080, 0x002089}, {0x002150, 0x002182}, {0x002185, 0x002189},
+    {0x002460, 0x00249B}, {0x0024EA, 0x0024FF}, {0x002776, 0x002793}, {0x002CFD, 0x002CFD},
+    {0x003007, 0x003007}, {0x003021, 0x003029}, {0x003038, 0x00303A}, {0x003192, 0x003195},
+    {0x003220, 0x003229}, {0x003248, 0x00324F}, {0x003251, 0x00325F}, {0x003280, 0x003289},
+    {0x0032B1, 0x0032BF}, {0x00A620, 0x00A629}, {0x00A6E6, 0x00A6EF}, {0x00A830, 0x00A835},
+    {0x00A8D0, 0x00A8D9}, {0x00A900, 0x00A909}, {0x00A9D0, 0x00A9D9}, {0x00A9F0, 0x00A9F9},
+    {0x00AA50, 0x00AA59}, {0x00ABF0, 0x00ABF9}, {0x00FF10, 0x00FF19}, {0x010107, 0x010133},
+    {0x010140, 0x010178}, {0x01018A, 0x01018B}, {0x0102E1, 0x0102FB}, {0x010320, 0x010323},
+    {0x010341, 0x010341}, {0x01034A, 0x01034A}, {0x0103D1, 0x0103D5}, {0x0104A0, 0x0104A9},
+    {0x010858, 0x01085F}, {0x010879, 0x01087F}, {0x0108A7, 0x0108AF}, {0x0108FB, 0x0108FF},
+    {0x010916, 0x01091B}, {0x0109BC, 0x0109BD}, {0x0109C0, 0x0109CF}, {0x0109D2, 0x0109FF},
+    {0x010A40, 0x010A48}, {0x010A7D, 0x010A7E}, {0x010A9D, 0x010A9F}, {0x010AEB, 0x010AEF},
+    {0x010B58, 0x010B5F}, {0x010B78, 0x010B7F}, {0x010BA9, 0x010BAF}, {0x010CFA, 0x010CFF},
+    {0x010D30, 0x010D39}, {0x010E60, 0x010E7E}, {0x010F1D, 0x010F26}, {0x010F51, 0x010F54},
+    {0x010FC5, 0x010FCB}, {0x011052, 0x01106F}, {0x0110F0, 0x0110F9}, {0x011136, 0x01113F},
+    {0x0111D0, 0x0111D9}, {0x0111E1, 0x0111F4}, {0x0112F0, 0x0112F9}, {0x011450, 0x011459},
+    {0x0114D0, 0x0114D9}, {0x011650, 0x011659}, {0x0116C0, 0x0116C9}, {0x011730, 0x01173B},
+    {0x0118E0, 0x0118F2}, {0x011950, 0x011959}, {0x011C50, 0x011C6C}, {0x011D50, 0x011D59},
+    {0x011DA0, 0x011DA9}, {0x011FC0, 0x011FD4}, {0x012400, 0x01246E}, {0x016A60, 0x016A69},
+    {0x016AC0, 0x016AC9}, {0x016B50, 0x016B59}, {0x016B5B, 0x016B61}, {0x016E80, 0x016E96},
+    {0x01D2E0, 0x01D2F3}, {0x01D360, 0x01D378}, {0x01D7CE, 0x01D7FF}, {0x01E140, 0x01E149},
+    {0x01E2F0, 0x01E2F9}, {0x01E8C7, 0x01E8CF}, {0x01E950, 0x01E959}, {0x01EC71, 0x01ECAB},
+    {0x01ECAD, 0x01ECAF}, {0x01ECB1, 0x01ECB4}, {0x01ED01, 0x01ED2D}, {0x01ED2F, 0x01ED3D},
+    {0x01F100, 0x01F10C}, {0x01FBF0, 0x01FBF9}
+};
+
+static const Segment<char32_t> segments_Nd[] = {
+    {0x000030, 0x000039}, {0x000660, 0x000669}, {0x0006F0, 0x0006F9}, {0x0007C0, 0x0007C9},
+    {0x000966, 0x00096F}, {0x0009E6, 0x0009EF}, {0x000A66, 0x000A6F}, {0x000AE6, 0x000AEF},
+    {0x000B66, 0x000B6F}, {0x000BE6, 0x000BEF}, {0x000C66, 0x000C6F}, {0x000CE6, 0x000CEF},
+    {0x000D66, 0x000D6F}, {0x000DE6, 0x000DEF}, {0x000E50, 0x000E59}, {0x000ED0, 0x000ED9},
+    {0x000F20, 0x000F29}, {0x001040, 0x001049}, {0x001090, 0x001099}, {0x0017E0, 0x0017E9},
+    {0x001810, 0x001819}, {0x001946, 0x00194F}, {0x0019D0, 0x0019D9}, {0x001A80, 0x001A89},
+    {0x001A90, 0x001A99}, {0x001B50, 0x001B59}, {0x001BB0, 0x001BB9}, {0x001C40, 0x001C49},
+    {0x001C50, 0x001C59}, {0x00A620, 0x00A629}, {0x00A8D0, 0x00A8D9}, {0x00A900, 0x00A909},
+    {0x00A9D0, 0x00A9D9}, {0x00A9F0, 0x00A9F9}, {0x00AA50, 0x00AA59}, {0x00ABF0, 0x00ABF9},
+    {0x00FF10, 0x00FF19}, {0x0104A0, 0x0104A9}, {0x010D30, 0x010D39}, {0x011066, 0x01106F},
+    {0x0110F0, 0x0110F9}, {0x011136, 0x01113F}, {0x0111D0, 0x0111D9}, {0x0112F0, 0x0112F9},
+    {0x011450, 0x011459}, {0x0114D0, 0x0114D9}, {0x011650, 0x011659}, {0x0116C0, 0x0116C9},
+    {0x011730, 0x011739}, {0x0118E0, 0x0118E9}, {0x011950, 0x011959}, {0x011C50, 0x011C59},
+    {0x011D50, 0x011D59}, {0x011DA0, 0x011DA9}, {0x016A60, 0x016A69}, {0x016AC0, 0x016AC9},
+    {0x016B50, 0x016B59}, {0x01D7CE, 0x01D7FF}, {0x01E140, 0x01E149}, {0x01E2F0, 0x01E2F9},
+    {0x01E950, 0x01E959}, {0x01FBF0, 0x01FBF9}
+};
+
+static const Segment<char32_t> segments_Nl[] = {
+    {0x0016EE, 0x0016F0}, {0x002160, 0x002182}, {0x002185, 0x002188}, {0x003007, 0x003007},
+    {0x003021, 0x003029}, {0x003038, 0x00303A}, {0x00A6E6, 0x00A6EF}, {0x010140, 0x010174},
+    {0x010341, 0x010341}, {0x01034A, 0x01034A}, {0x0103D1, 0x0103D5}, {0x012400, 0x01246E}
+};
+
+static const Segment<char32_t> segments_No[] = {
+    {0x0000B2, 0x0000B3}, {0x0000B9, 0x0000B9}, {0x0000BC, 0x0000BE}, {0x0009F4, 0x0009F9},
+    {0x000B72, 0x000B77}, {0x000BF0, 0x000BF2}, {0x000C78, 0x000C7E}, {0x000D58, 0x000D5E},
+    {0x000D70, 0x000D78}, {0x000F2A, 0x000F33}, {0x001369, 0x00137C}, {0x0017F0, 0x0017F9},
+    {0x0019DA, 0x0019DA}, {0x002070, 0x002070}, {0x002074, 0x002079}, {0x002080, 0x002089},
+    {0x002150, 0x00215F}, {0x002189, 0x002189}, {0x002460, 0x00249B}, {0x0024EA, 0x0024FF},
+    {0x002776, 0x002793}, {0x002CFD, 0x002CFD}, {0x003192, 0x003195}, {0x003220, 0x003229},
+    {0x003248, 0x00324F}, {0x003251, 0x00325F}, {0x003280, 0x003289}, {0x0032B1, 0x0032BF},
+    {0x00A830, 0x00A835}, {0x010107, 0x010133}, {0x010175, 0x010178}, {0x01018A, 0x01018B},
+    {0x0102E1, 0x0102FB}, {0x010320, 0x010323}, {0x010858, 0x01085F}, {0x010879, 0x01087F},
+    {0x0108A7, 0x0108AF}, {0x0108FB, 0x0108FF}, {0x010916, 0x01091B}, {0x0109BC, 0x0109BD},
+    {0x0109C0, 0x0109CF}, {0x0109D2, 0x0109FF}, {0x010A40, 0x010A48}, {0x010A7D, 0x010A7E},
+    {0x010A9D, 0x010A9F}, {0x010AEB, 0x010AEF}, {0x010B58, 0x010B5F}, {0x010B78, 0x010B7F},
+    {0x010BA9, 0x010BAF}, {0x010CFA, 0x010CFF}, {0x010E60, 0x010E7E}, {0x010F1D, 0x010F26},
+    {0x010F51, 0x010F54}, {0x010FC5, 0x010FCB}, {0x011052, 0x011065}, {0x0111E1, 0x0111F4},
+    {0x01173A, 0x01173B}, {0x0118EA, 0x0118F2}, {0x011C5A, 0x011C6C}, {0x011FC0, 0x011FD4},
+    {0x016B5B, 0x016B61}, {0x016E80, 0x016E96}, {0x01D2E0, 0x01D2F3}, {0x01D360, 0x01D378},
+    {0x01E8C7, 0x01E8CF}, {0x01EC71, 0x01ECAB}, {0x01ECAD, 0x01ECAF}, {0x01ECB1, 0x01ECB4},
+    {0x01ED01, 0x01ED2D}, {0x01ED2F, 0x01ED3D}, {0x01F100, 0x01F10C}
+};
+
+static const Segment<char32_t> segments_P[] = {
+    {0x000021, 0x000023}, {0x000025, 0x00002A}, {0x00002C, 0x00002F}, {0x00003A, 0x00003B},
+    {0x00003F, 0x000040}, {0x00005B, 0x00005D}, {0x00005F, 0x00005F}, {0x00007B, 0x00007B},
+    {0x00007D, 0x00007D}, {0x0000A1, 0x0000A1}, {0x0000A7, 0x0000A7}, {0x0000AB, 0x0000AB},
+    {0x0000B6, 0x0000B7}, {0x0000BB, 0x0000BB}, {0x0000BF, 0x0000BF}, {0x00037E, 0x00037E},
+    {0x000387, 0x000387}, {0x00055A, 0x00055F}, {0x000589, 0x00058A}, {0x0005BE, 0x0005BE},
+    {0x0005C0, 0x0005C0}, {0x0005C3, 0x0005C3}, {0x0005C6, 0x0005C6}, {0x0005F3, 0x0005F4},
+    {0x000609, 0x00060A}, {0x00060C, 0x00060D}, {0x00061B, 0x00061B}, {0x00061D, 0x00061F},
+    {0x00066A, 0x00066D}, {0x0006D4, 0x0006D4}, {0x000700, 0x00070D}, {0x0007F7, 0x0007F9},
+    {0x000830, 0x00083E}, {0x00085E, 0x00085E}, {0x000964, 0x000965}, {0x000970, 0x000970},
+    {0x0009FD, 0x0009FD}, {0x000A76, 0x000A76}, {0x000AF0, 0x000AF0}, {0x000C77, 0x000C77},
+    {0x000C84, 0x000C84}, {0x000DF4, 0x000DF4}, {0x000E4F, 0x000E4F}, {0x000E5A, 0x000E5B},
+    {0x000F04, 0x000F12}, {0x000F14, 0x000F14}, {0x000F3A, 0x000F3D}, {0x000F85, 0x000F85},
+    {0x000FD0, 0x000FD4}, {0x000FD9, 0x000FDA}, {0x00104A, 0x00104F}, {0x0010FB, 0x0010FB},
+    {0x001360, 0x001368}, {0x001400, 0x001400}, {0x00166E, 0x00166E}, {0x00169B, 0x00169C},
+    {0x0016EB, 0x0016ED}, {0x001735, 0x001736}, {0x0017D4, 0x0017D6}, {0x0017D8, 0x0017DA},
+    {0x001800, 0x00180A}, {0x001944, 0x001945}, {0x001A1E, 0x001A1F}, {0x001AA0, 0x001AA6},
+    {0x001AA8, 0x001AAD}, {0x001B5A, 0x001B60}, {0x001B7D, 0x001B7E}, {0x001BFC, 0x001BFF},
+    {0x001C3B, 0x001C3F}, {0x001C7E, 0x001C7F}, {0x001CC0, 0x001CC7}, {0x001CD3, 0x001CD3},
+    {0x002010, 0x002027}, {0x002030, 0x002043}, {0x002045, 0x002051}, {0x002053, 0x00205E},
+    {0x00207D, 0x00207E}, {0x00208D, 0x00208E}, {0x002308, 0x00230B}, {0x002329, 0x00232A},
+    {0x002768, 0x002775}, {0x0027C5, 0x0027C6}, {0x0027E6, 0x0027EF}, {0x002983, 0x002998},
+    {0x0029D8, 0x0029DB}, {0x0029FC, 0x0029FD}, {0x002CF9, 0x002CFC}, {0x002CFE, 0x002CFF},
+    {0x002D70, 0x002D70}, {0x002E00, 0x002E2E}, {0x002E30, 0x002E4F}, {0x002E52, 0x002E5D},
+    {0x003001, 0x003003}, {0x003008, 0x003011}, {0x003014, 0x00301F}, {0x003030, 0x003030},
+    {0x00303D, 0x00303D}, {0x0030A0, 0x0030A0}, {0x0030FB, 0x0030FB}, {0x00A4FE, 0x00A4FF},
+    {0x00A60D, 0x00A60F}, {0x00A673, 0x00A673}, {0x00A67E, 0x00A67E}, {0x00A6F2, 0x00A6F7},
+    {0x00A874, 0x00A877}, {0x00A8CE, 0x00A8CF}, {0x00A8F8, 0x00A8FA}, {0x00A8FC, 0x00A8FC},
+    {0x00A92E, 0x00A92F}, {0x00A95F, 0x00A95F}, {0x00A9C1, 0x00A9CD}, {0x00A9DE, 0x00A9DF},
+    {0x00AA5C, 0x00AA5F}, {0x00AADE, 0x00AADF}, {0x00AAF0, 0x00AAF1}, {0x00ABEB, 0x00ABEB},
+    {0x00FD3E, 0x00FD3F}, {0x00FE10, 0x00FE19}, {0x00FE30, 0x00FE52}, {0x00FE54, 0x00FE61},
+    {0x00FE63, 0x00FE63}, {0x00FE68, 0x00FE68}, {0x00FE6A, 0x00FE6B}, {0x00FF01, 0x00FF03},
+    {0x00FF05, 0x00FF0A}, {0x00FF0C, 0x00FF0F}, {0x00FF1A, 0x00FF1B}, {0x00FF1F, 0x00FF20},
+    {0x00FF3B, 0x00FF3D}, {0x00FF3F, 0x00FF3F}, {0x00FF5B, 0x00FF5B}, {0x00FF5D, 0x00FF5D},
+    {0x00FF5F, 0x00FF65}, {0x010100, 0x010102}, {0x01039F, 0x01039F}, {0x0103D0, 0x0103D0},
+    {0x01056F, 0x01056F}, {0x010857, 0x010857}, {0x01091F, 0x01091F}, {0x01093F, 0x01093F},
+    {0x010A50, 0x010A58}, {0x010A7F, 0x010A7F}, {0x010AF0, 0x010AF6}, {0x010B39, 0x010B3F},
+    {0x010B99, 0x010B9C}, {0x010EAD, 0x010EAD}, {0x010F55, 0x010F59}, {0x010F86, 0x010F89},
+    {0x011047, 0x01104D}, {0x0110BB, 0x0110BC}, {0x0110BE, 0x0110C1}, {0x011140, 0x011143},
+    {0x011174, 0x011175}, {0x0111C5, 0x0111C8}, {0x0111CD, 0x0111CD}, {0x0111DB, 0x0111DB},
+    {0x0111DD, 0x0111DF}, {0x011238, 0x01123D}, {0x0112A9, 0x0112A9}, {0x01144B, 0x01144F},
+    {0x01145A, 0x01145B}, {0x01145D, 0x01145D}, {0x0114C6, 0x0114C6}, {0x0115C1, 0x0115D7},
+    {0x011641, 0x011643}, {0x011660, 0x01166C}, {0x0116B9, 0x0116B9}, {0x01173C, 0x01173E},
+    {0x01183B, 0x01183B}, {0x011944, 0x011946}, {0x0119E2, 0x0119E2}, {0x011A3F, 0x011A46},
+    {0x011A9A, 0x011A9C}, {0x011A9E, 0x011AA2}, {0x011C41, 0x011C45}, {0x011C70, 0x011C71},
+    {0x011EF7, 0x011EF8}, {0x011FFF, 0x011FFF}, {0x012470, 0x012474}, {0x012FF1, 0x012FF2},
+    {0x016A6E, 0x016A6F}, {0x016AF5, 0x016AF5}, {0x016B37, 0x016B3B}, {0x016B44, 0x016B44},
+    {0x016E97, 0x016E9A}, {0x016FE2, 0x016FE2}, {0x01BC9F, 0x01BC9F}, {0x01DA87, 0x01DA8B},
+    {0x01E95E, 0x01E95F}
+};
+
+static const Segment<char32_t> segments_Pc[] = {
+    {0x00005F, 0x00005F}, {0x00203F, 0x002040}, {0x002054, 0x002054}, {0x00FE33, 0x00FE34},
+    {0x00FE4D, 0x00FE4F}, {0x00FF3F, 0x00FF3F}
+};
+
+static const Segment<char32_t> segments_Pd[] = {
+    {0x00002D, 0x00002D}, {0x00058A, 0x00058A}, {0x0005BE, 0x0005BE}, {0x001400, 0x001400},
+    {0x001806, 0x001806}, {0x002010, 0x002015}, {0x002E17, 0x002E17}, {0x002E1A, 0x002E1A},
+    {0x002E3A, 0x002E3B}, {0x002E40, 0x002E40}, {0x002E5D, 0x002E5D}, {0x00301C, 0x00301C},
+    {0x003030, 0x003030}, {0x0030A0, 0x0030A0}, {0x00FE31, 0x00FE32}, {0x00FE58, 0x00FE58},
+    {0x00FE63, 0x00FE63}, {0x00FF0D, 0x00FF0D}, {0x010EAD, 0x010EAD}
+};
+
+static const Segment<char32_t> segments_Pe[] = {
+    {0x000029, 0x000029}, {0x00005D, 0x00005D}, {0x00007D, 0x00007D}, {0x000F3B, 0x000F3B},
+    {0x000F3D, 0x000F3D}, {0x00169C, 0x00169C}, {0x002046, 0x002046}, {0x00207E, 0x00207E},
+    {0x00208E, 0x00208E}, {0x002309, 0x002309}, {0x00230B, 0x00230B}, {0x00232A, 0x00232A},
+    {0x002769, 0x002769}, {0x00276B, 0x00276B}, {0x00276D, 0x00276D}, {0x00276F, 0x00276F},
+    {0x002771, 0x002771}, {0x002773, 0x002773}, {0x002775, 0x002775}, {0x0027C6, 0x0027C6},
+    {0x0027E7, 0x0027E7}, {0x0027E9, 0x0027E9}, {0x0027EB, 0x0027EB}, {0x0027ED, 0x0027ED},
+    {0x0027EF, 0x0027EF}, {0x002984, 0x002984}, {0x002986, 0x002986}, {0x002988, 0x002988},
+    {0x00298A, 0x00298A}, {0x00298C, 0x00298C}, {0x00298E, 0x00298E}, {0x002990, 0x002990},
+    {0x002992, 0x002992}, {0x002994, 0x002994}, {0x002996, 0x002996}, {0x002998, 0x002998},
+    {0x0029D9, 0x0029D9}, {0x0029DB, 0x0029DB}, {0x0029FD, 0x0029FD}, {0x002E23, 0x002E23},
+    {0x002E25, 0x002E25}, {0x002E27, 0x002E27}, {0x002E29, 0x002E29}, {0x002E56, 0x002E56},
+    {0x002E58, 0x002E58}, {0x002E5A, 0x002E5A}, {0x002E5C, 0x002E5C}, {0x003009, 0x003009},
+    {0x00300B, 0x00300B}, {0x00300D, 0x00300D}, {0x00300F, 0x00300F}, {0x003011, 0x003011},
+    {0x003015, 0x003015}, {0x003017, 0x003017}, {0x003019, 0x003019}, {0x00301B, 0x00301B},
+    {0x00301E, 0x00301F}, {0x00FD3E, 0x00FD3E}, {0x00FE18, 0x00FE18}, {0x00FE36, 0x00FE36},
+    {0x00FE38, 0x00FE38}, {0x00FE3A, 0x00FE3A}, {0x00FE3C, 0x00FE3C}, {0x00FE3E, 0x00FE3E},
+    {0x00FE40, 0x00FE40}, {0x00FE42, 0x00FE42}, {0x00FE44, 0x00FE44}, {0x00FE48, 0x00FE48},
+    {0x00FE5A, 0x00FE5A}, {0x00FE5C, 0x00FE5C}, {0x00FE5E, 0x00FE5E}, {0x00FF09, 0x00FF09},
+    {0x00FF3D, 0x00FF3D}, {0x00FF5D, 0x00FF5D}, {0x00FF60, 0x00FF60}, {0x00FF63, 0x00FF63}
+};
+
+static const Segment<char32_t> segments_Pf[] = {
+    {0x0000BB, 0x0000BB}, {0x002019, 0x002019}, {0x00201D, 0x00201D}, {0x00203A, 0x00203A},
+    {0x002E03, 0x002E03}, {0x002E05, 0x002E05}, {0x002E0A, 0x002E0A}, {0x002E0D, 0x002E0D},
+    {0x002E1D, 0x002E1D}, {0x002E21, 0x002E21}
+};
+
+static const Segment<char32_t> segments_Pi[] = {
+    {0x0000AB, 0x0000AB}, {0x002018, 0x002018}, {0x00201B, 0x00201C}, {0x00201F, 0x00201F},
+    {0x002039, 0x002039}, {0x002E02, 0x002E02}, {0x002E04, 0x002E04}, {0x002E09, 0x002E09},
+    {0x002E0C, 0x002E0C}, {0x002E1C, 0x002E1C}, {0x002E20, 0x002E20}
+};
+
+static const Segment<char32_t> segments_Po[] = {
+    {0x000021, 0x000023}, {0x000025, 0x000027}, {0x00002A, 0x00002A}, {0x00002C, 0x00002C},
+    {0x00002E, 0x00002F}, {0x00003A, 0x00003B}, {0x00003F, 0x000040}, {0x00005C, 0x00005C},
+    {0x0000A1, 0x0000A1}, {0x0000A7, 0x0000A7}, {0x0000B6, 0x0000B7}, {0x0000BF, 0x0000BF},
+    {0x00037E, 0x00037E}, {0x000387, 0x000387}, {0x00055A, 0x00055F}, {0x000589, 0x000589},
+    {0x0005C0, 0x0005C0}, {0x0005C3, 0x0005C3}, {0x0005C6, 0x0005C6}, {0x0005F3, 0x0005F4},
+    {0x000609, 0x00060A}, {0x00060C, 0x00060D}, {0x00061B, 0x00061B}, {0x00061D, 0x00061F},
+    {0x00066A, 0x00066D}, {0x0006D4, 0x0006D4}, {0x000700, 0x00070D}, {0x0007F7, 0x0007F9},
+    {0x000830, 0x00083E}, {0x00085E, 0x00085E}, {0x000964, 0x000965}, {0x000970, 0x000970},
+    {0x0009FD, 0x0009FD}, {0x000A76, 0x000A76}, {0x000AF0, 0x000AF0}, {0x000C77, 0x000C77},
+    {0x000C84, 0x000C84}, {0x000DF4, 0x000DF4}, {0x000E4F, 0x000E4F}, {0x000E5A, 0x000E5B},
+    {0x000F04, 0x000F12}, {0x000F14, 0x000F14}, {0x000F85, 0x000F85}, {0x000FD0, 0x000FD4},
+    {0x000FD9, 0x000FDA}, {0x00104A, 0x00104F}, {0x0010FB, 0x0010FB}, {0x001360, 0x001368},
+    {0x00166E, 0x00166E}, {0x0016EB, 0x0016ED}, {0x001735, 0x001736}, {0x0017D4, 0x0017D6},
+    {0x0017D8, 0x0017DA}, {0x001800, 0x001805}, {0x001807, 0x00180A}, {0x001944, 0x001945},
+    {0x001A1E, 0x001A1F}, {0x001AA0, 0x001AA6}, {0x001AA8, 0x001AAD}, {0x001B5A, 0x001B60},
+    {0x001B7D, 0x001B7E}, {0x001BFC, 0x001BFF}, {0x001C3B, 0x001C3F}, {0x001C7E, 0x001C7F},
+    {0x001CC0, 0x001CC7}, {0x001CD3, 0x001CD3}, {0x002016, 0x002017}, {0x002020, 0x002027},
+    {0x002030, 0x002038}, {0x00203B, 0x00203E}, {0x002041, 0x002043}, {0x002047, 0x002051},
+    {0x002053, 0x002053}, {0x002055, 0x00205E}, {0x002CF9, 0x002CFC}, {0x002CFE, 0x002CFF},
+    {0x002D70, 0x002D70}, {0x002E00, 0x002E01}, {0x002E06, 0x002E08}, {0x002E0B, 0x002E0B},
+    {0x002E0E, 0x002E16}, {0x002E18, 0x002E19}, {0x002E1B, 0x002E1B}, {0x002E1E, 0x002E1F},
+    {0x002E2A, 0x002E2E}, {0x002E30, 0x002E39}, {0x002E3C, 0x002E3F}, {0x002E41, 0x002E41},
+    {0x002E43, 0x002E4F}, {0x002E52, 0x002E54}, {0x003001, 0x003003}, {0x00303D, 0x00303D},
+    {0x0030FB, 0x0030FB}, {0x00A4FE, 0x00A4FF}, {0x00A60D, 0x00A60F}, {0x00A673, 0x00A673},
+    {0x00A67E, 0x00A67E}, {0x00A6F2, 0x00A6F7}, {0x00A874, 0x00A877}, {0x00A8CE, 0x00A8CF},
+    {0x00A8F8, 0x00A8FA}, {0x00A8FC, 0x00A8FC}, {0x00A92E, 0x00A92F}, {0x00A95F, 0x00A95F},
+    {0x00A9C1, 0x00A9CD}, {0x00A9DE, 0x00A9DF}, {0x00AA5C, 0x00AA5F}, {0x00AADE, 0x00AADF},
+    {0x00AAF0, 0x00AAF1}, {0x00ABEB, 0x00ABEB}, {0x00FE10, 0x00FE16}, {0x00FE19, 0x00FE19},
+    {0x00FE30, 0x00FE30}, {0x00FE45, 0x00FE46}, {0x00FE49, 0x00FE4C}, {0x00FE50, 0x00FE52},
+    {0x00FE54, 0x00FE57}, {0x00FE5F, 0x00FE61}, {0x00FE68, 0x00FE68}, {0x00FE6A, 0x00FE6B},
+    {0x00FF01, 0x00FF03}, {0x00FF05, 0x00FF07}, {0x00FF0A, 0x00FF0A}, {0x00FF0C, 0x00FF0C},
+    {0x00FF0E, 0x00FF0F}, {0x00FF1A, 0x00FF1B}, {0x00FF1F, 0x00FF20}, {0x00FF3C, 0x00FF3C},
+    {0x00FF61, 0x00FF61}, {0x00FF64, 0x00FF65}, {0x010100, 0x010102}, {0x01039F, 0x01039F},
+    {0x0103D0, 0x0103D0}, {0x01056F, 0x01056F}, {0x010857, 0x010857}, {0x01091F, 0x01091F},
+    {0x01093F, 0x01093F}, {0x010A50, 0x010A58}, {0x010A7F, 0x010A7F}, {0x010AF0, 0x010AF6},
+    {0x010B39, 0x010B3F}, {0x010B99, 0x010B9C}, {0x010F55, 0x010F59}, {0x010F86, 0x010F89},
+    {0x011047, 0x01104D}, {0x0110BB, 0x0110BC}, {0x0110BE, 0x0110C1}, {0x011140, 0x011143},
+    {0x011174, 0x011175}, {0x0111C5, 0x0111C8}, {0x0111CD, 0x0111CD}, {0x0111DB, 0x0111DB},
+    {0x0111DD, 0x0111DF}, {0x011238, 0x01123D}, {0x0112A9, 0x0112A9}, {0x01144B, 0x01144F},
+    {0x01145A, 0x01145B}, {0x01145D, 0x01145D}, {0x0114C6, 0x0114C6}, {0x0115C1, 0x0115D7},
+    {0x011641, 0x011643}, {0x011660, 0x01166C}, {0x0116B9, 0x0116B9}, {0x01173C, 0x01173E},
+    {0x01183B, 0x01183B}, {0x011944, 0x011946}, {0x0119E2, 0x0119E2}, {0x011A3F, 0x011A46},
+    {0x011A9A, 0x011A9C}, {0x011A9E, 0x011AA2}, {0x011C41, 0x011C45}, {0x011C70, 0x011C71},
+    {0x011EF7, 0x011EF8}, {0x011FFF, 0x011FFF}, {0x012470, 0x012474}, {0x012FF1, 0x012FF2},
+    {0x016A6E, 0x016A6F}, {0x016AF5, 0x016AF5}, {0x016B37, 0x016B3B}, {0x016B44, 0x016B44},
+    {0x016E97, 0x016E9A}, {0x016FE2, 0x016FE2}, {0x01BC9F, 0x01BC9F}, {0x01DA87, 0x01DA8B},
+    {0x01E95E, 0x01E95F}
+};
+
+static const Segment<char32_t> segments_Ps[] = {
+    {0x000028, 0x000028}, {0x00005B, 0x00005B}, {0x00007B, 0x00007B}, {0x000F3A, 0x000F3A},
+    {0x000F3C, 0x000F3C}, {0x00169B, 0x00169B}, {0x00201A, 0x00201A}, {0x00201E, 0x00201E},
+    {0x002045, 0x002045}, {0x00207D, 0x00207D}, {0x00208D, 0x00208D}, {0x002308, 0x002308},
+    {0x00230A, 0x00230A}, {0x002329, 0x002329}, {0x002768, 0x002768}, {0x00276A, 0x00276A},
+    {0x00276C, 0x00276C}, {0x00276E, 0x00276E}, {0x002770, 0x002770}, {0x002772, 0x002772},
+    {0x002774, 0x002774}, {0x0027C5, 0x0027C5}, {0x0027E6, 0x0027E6}, {0x0027E8, 0x0027E8},
+    {0x0027EA, 0x0027EA}, {0x0027EC, 0x0027EC}, {0x0027EE, 0x0027EE}, {0x002983, 0x002983},
+    {0x002985, 0x002985}, {0x002987, 0x002987}, {0x002989, 0x002989}, {0x00298B, 0x00298B},
+    {0x00298D, 0x00298D}, {0x00298F, 0x00298F}, {0x002991, 0x002991}, {0x002993, 0x002993},
+    {0x002995, 0x002995}, {0x002997, 0x002997}, {0x0029D8, 0x0029D8}, {0x0029DA, 0x0029DA},
+    {0x0029FC, 0x0029FC}, {0x002E22, 0x002E22}, {0x002E24, 0x002E24}, {0x002E26, 0x002E26},
+    {0x002E28, 0x002E28}, {0x002E42, 0x002E42}, {0x002E55, 0x002E55}, {0x002E57, 0x002E57},
+    {0x002E59, 0x002E59}, {0x002E5B, 0x002E5B}, {0x003008, 0x003008}, {0x00300A, 0x00300A},
+    {0x00300C, 0x00300C}, {0x00300E, 0x00300E}, {0x003010, 0x003010}, {0x003014, 0x003014},
+    {0x003016, 0x003016}, {0x003018, 0x003018}, {0x00301A, 0x00301A}, {0x00301D, 0x00301D},
+    {0x00FD3F, 0x00FD3F}, {0x00FE17, 0x00FE17}, {0x00FE35, 0x00FE35}, {0x00FE37, 0x00FE37},
+    {0x00FE39, 0x00FE39}, {0x00FE3B, 0x00FE3B}, {0x00FE3D, 0x00FE3D}, {0x00FE3F, 0x00FE3F},
+    {0x00FE41, 0x00FE41}, {0x00FE43, 0x00FE43}, {0x00FE47, 0x00FE47}, {0x00FE59, 0x00FE59},
+    {0x00FE5B, 0x00FE5B}, {0x00FE5D, 0x00FE5D}, {0x00FF08, 0x00FF08}, {0x00FF3B, 0x00FF3B},
+    {0x00FF5B, 0x00FF5B}, {0x00FF5F, 0x00FF5F}, {0x00FF62, 0x00FF62}
+};
+
+static const Segment<char32_t> segments_S[] = {
+    {0x000024, 0x000024}, {0x00002B, 0x00002B}, {0x00003C, 0x00003E}, {0x00005E, 0x00005E},
+    {0x000060, 0x000060}, {0x00007C, 0x00007C}, {0x00007E, 0x00007E}, {0x0000A2, 0x0000A6},
+    {0x0000A8, 0x0000A9}, {0x0000AC, 0x0000AC}, {0x0000AE, 0x0000B1}, {0x0000B4, 0x0000B4},
+    {0x0000B8, 0x0000B8}, {0x0000D7, 0x0000D7}, {0x0000F7, 0x0000F7}, {0x0002C2, 0x0002C5},
+    {0x0002D2, 0x0002DF}, {0x0002E5, 0x0002EB}, {0x0002ED, 0x0002ED}, {0x0002EF, 0x0002FF},
+    {0x000375, 0x000375}, {0x000384, 0x000385}, {0x0003F6, 0x0003F6}, {0x000482, 0x000482},
+    {0x00058D, 0x00058F}, {0x000606, 0x000608}, {0x00060B, 0x00060B}, {0x00060E, 0x00060F},
+    {0x0006DE, 0x0006DE}, {0x0006E9, 0x0006E9}, {0x0006FD, 0x0006FE}, {0x0007F6, 0x0007F6},
+    {0x0007FE, 0x0007FF}, {0x000888, 0x000888}, {0x0009F2, 0x0009F3}, {0x0009FA, 0x0009FB},
+    {0x000AF1, 0x000AF1}, {0x000B70, 0x000B70}, {0x000BF3, 0x000BFA}, {0x000C7F, 0x000C7F},
+    {0x000D4F, 0x000D4F}, {0x000D79, 0x000D79}, {0x000E3F, 0x000E3F}, {0x000F01, 0x000F03},
+    {0x000F13, 0x000F13}, {0x000F15, 0x000F17}, {0x000F1A, 0x000F1F}, {0x000F34, 0x000F34},
+    {0x000F36, 0x000F36}, {0x000F38, 0x000F38}, {0x000FBE, 0x000FC5}, {0x000FC7, 0x000FCC},
+    {0x000FCE, 0x000FCF}, {0x000FD5, 0x000FD8}, {0x00109E, 0x00109F}, {0x001390, 0x001399},
+    {0x00166D, 0x00166D}, {0x0017DB, 0x0017DB}, {0x001940, 0x001940}, {0x0019DE, 0x0019FF},
+    {0x001B61, 0x001B6A}, {0x001B74, 0x001B7C}, {0x001FBD, 0x001FBD}, {0x001FBF, 0x001FC1},
+    {0x001FCD, 0x001FCF}, {0x001FDD, 0x001FDF}, {0x001FED, 0x001FEF}, {0x001FFD, 0x001FFE},
+    {0x002044, 0x002044}, {0x002052, 0x002052}, {0x00207A, 0x00207C}, {0x00208A, 0x00208C},
+    {0x0020A0, 0x0020C0}, {0x002100, 0x002101}, {0x002103, 0x002106}, {0x002108, 0x002109},
+    {0x002114, 0x002114}, {0x002116, 0x002118}, {0x00211E, 0x002123}, {0x002125, 0x002125},
+    {0x002127, 0x002127}, {0x002129, 0x002129}, {0x00212E, 0x00212E}, {0x00213A, 0x00213B},
+    {0x002140, 0x002144}, {0x00214A, 0x00214D}, {0x00214F, 0x00214F}, {0x00218A, 0x00218B},
+    {0x002190, 0x002307}, {0x00230C, 0x002328}, {0x00232B, 0x002426}, {0x002440, 0x00244A},
+    {0x00249C, 0x0024E9}, {0x002500, 0x002767}, {0x002794, 0x0027C4}, {0x0027C7, 0x0027E5},
+    {0x0027F0, 0x002982}, {0x002999, 0x0029D7}, {0x0029DC, 0x0029FB}, {0x0029FE, 0x002B73},
+    {0x002B76, 0x002B95}, {0x002B97, 0x002BFF}, {0x002CE5, 0x002CEA}, {0x002E50, 0x002E51},
+    {0x002E80, 0x002E99}, {0x002E9B, 0x002EF3}, {0x002F00, 0x002FD5}, {0x002FF0, 0x002FFB},
+    {0x003004, 0x003004}, {0x003012, 0x003013}, {0x003020, 0x003020}, {0x003036, 0x003037},
+    {0x00303E, 0x00303F}, {0x00309B, 0x00309C}, {0x003190, 0x003191}, {0x003196, 0x00319F},
+    {0x0031C0, 0x0031E3}, {0x003200, 0x00321E}, {0x00322A, 0x003247}, {0x003250, 0x003250},
+    {0x003260, 0x00327F}, {0x00328A, 0x0032B0}, {0x0032C0, 0x0033FF}, {0x004DC0, 0x004DFF},
+    {0x00A490, 0x00A4C6}, {0x00A700, 0x00A716}, {0x00A720, 0x00A721}, {0x00A789, 0x00A78A},
+    {0x00A828, 0x00A82B}, {0x00A836, 0x00A839}, {0x00AA77, 0x00AA79}, {0x00AB5B, 0x00AB5B},
+    {0x00AB6A, 0x00AB6B}, {0x00FB29, 0x00FB29}, {0x00FBB2, 0x00FBC2}, {0x00FD40, 0x00FD4F},
+    {0x00FDCF, 0x00FDCF}, {0x00FDFC, 0x00FDFF}, {0x00FE62, 0x00FE62}, {0x00FE64, 0x00FE66},
+    {0x00FE69, 0x00FE69}, {0x00FF04, 0x00FF04}, {0x00FF0B, 0x00FF0B}, {0x00FF1C, 0x00FF1E},
+    {0x00FF3E, 0x00FF3E}, {0x00FF40, 0x00FF40}, {0x00FF5C, 0x00FF5C}, {0x00FF5E, 0x00FF5E},
+    {0x00FFE0, 0x00FFE6}, {0x00FFE8, 0x00FFEE}, {0x00FFFC, 0x00FFFD}, {0x010137, 0x01013F},
+    {0x010179, 0x010189}, {0x01018C, 0x01018E}, {0x010190, 0x01019C}, {0x0101A0, 0x0101A0},
+    {0x0101D0, 0x0101FC}, {0x010877, 0x010878}, {0x010AC8, 0x010AC8}, {0x01173F, 0x01173F},
+    {0x011FD5, 0x011FF1}, {0x016B3C, 0x016B3F}, {0x016B45, 0x016B45}, {0x01BC9C, 0x01BC9C},
+    {0x01CF50, 0x01CFC3}, {0x01D000, 0x01D0F5}, {0x01D100, 0x01D126}, {0x01D129, 0x01D164},
+    {0x01D16A, 0x01D16C}, {0x01D183, 0x01D184}, {0x01D18C, 0x01D1A9}, {0x01D1AE, 0x01D1EA},
+    {0x01D200, 0x01D241}, {0x01D245, 0x01D245}, {0x01D300, 0x01D356}, {0x01D6C1, 0x01D6C1},
+    {0x01D6DB, 0x01D6DB}, {0x01D6FB, 0x01D6FB}, {0x01D715, 0x01D715}, {0x01D735, 0x01D735},
+    {0x01D74F, 0x01D74F}, {0x01D76F, 0x01D76F}, {0x01D789, 0x01D789}, {0x01D7A9, 0x01D7A9},
+    {0x01D7C3, 0x01D7C3}, {0x01D800, 0x01D9FF}, {0x01DA37, 0x01DA3A}, {0x01DA6D, 0x01DA74},
+    {0x01DA76, 0x01DA83}, {0x01DA85, 0x01DA86}, {0x01E14F, 0x01E14F}, {0x01E2FF, 0x01E2FF},
+    {0x01ECAC, 0x01ECAC}, {0x01ECB0, 0x01ECB0}, {0x01ED2E, 0x01ED2E}, {0x01EEF0, 0x01EEF1},
+    {0x01F000, 0x01F02B}, {0x01F030, 0x01F093}, {0x01F0A0, 0x01F0AE}, {0x01F0B1, 0x01F0BF},
+    {0x01F0C1, 0x01F0CF}, {0x01F0D1, 0x01F0F5}, {0x01F10D, 0x01F1AD}, {0x01F1E6, 0x01F202},
+    {0x01F210, 0x01F23B}, {0x01F240, 0x01F248}, {0x01F250, 0x01F251}, {0x01F260, 0x01F265},
+    {0x01F300, 0x01F6D7}, {0x01F6DD, 0x01F6EC}, {0x01F6F0, 0x01F6FC}, {0x01F700, 0x01F773},
+    {0x01F780, 0x01F7D8}, {0x01F7E0, 0x01F7EB}, {0x01F7F0, 0x01F7F0}, {0x01F800, 0x01F80B},
+    {0x01F810, 0x01F847}, {0x01F850, 0x01F859}, {0x01F860, 0x01F887}, {0x01F890, 0x01F8AD},
+    {0x01F8B0, 0x01F8B1}, {0x01F900, 0x01FA53}, {0x01FA60, 0x01FA6D}, {0x01FA70, 0x01FA74},
+    {0x01FA78, 0x01FA7C}, {0x01FA80, 0x01FA86}, {0x01FA90, 0x01FAAC}, {0x01FAB0, 0x01FABA},
+    {0x01FAC0, 0x01FAC5}, {0x01FAD0, 0x01FAD9}, {0x01FAE0, 0x01FAE7}, {0x01FAF0, 0x01FAF6},
+    {0x01FB00, 0x01FB92}, {0x01FB94, 0x01FBCA}
+};
+
+static const Segment<char32_t> segments_Sc[] = {
+    {0x000024, 0x000024}, {0x0000A2, 0x0000A5}, {0x00058F, 0x00058F}, {0x00060B, 0x00060B},
+    {0x0007FE, 0x0007FF}, {0x0009F2, 0x0009F3}, {0x0009FB, 0x0009FB}, {0x000AF1, 0x000AF1},
+    {0x000BF9, 0x000BF9}, {0x000E3F, 0x000E3F}, {0x0017DB, 0x0017DB}, {0x0020A0, 0x0020C0},
+    {0x00A838, 0x00A838}, {0x00FDFC, 0x00FDFC}, {0x00FE69, 0x00FE69}, {0x00FF04, 0x00FF04},
+    {0x00FFE0, 0x00FFE1}, {0x00FFE5, 0x00FFE6}, {0x011FDD, 0x011FE0}, {0x01E2FF, 0x01E2FF},
+    {0x01ECB0, 0x01ECB0}
+};
+
+static const Segment<char32_t> segments_Sk[] = {
+    {0x00005E, 0x00005E}, {0x000060, 0x000060}, {0x0000A8, 0x0000A8}, {0x0000AF, 0x0000AF},
+    {0x0000B4, 0x0000B4}, {0x0000B8, 0x0000B8}, {0x0002C2, 0x0002C5}, {0x0002D2, 0x0002DF},
+    {0x0002E5, 0x0002EB}, {0x0002ED, 0x0002ED}, {0x0002EF, 0x0002FF}, {0x000375, 0x000375},
+    {0x000384, 0x000385}, {0x000888, 0x000888}, {0x001FBD, 0x001FBD}, {0x001FBF, 0x001FC1},
+    {0x001FCD, 0x001FCF}, {0x001FDD, 0x001FDF}, {0x001FED, 0x001FEF}, {0x001FFD, 0x001FFE},
+    {0x00309B, 0x00309C}, {0x00A700, 0x00A716}, {0x00A720, 0x00A721}, {0x00A789, 0x00A78A},
+    {0x00AB5B, 0x00AB5B}, {0x00AB6A, 0x00AB6B}, {0x00FBB2, 0x00FBC2}, {0x00FF3E, 0x00FF3E},
+    {0x00FF40, 0x00FF40}, {0x00FFE3, 0x00FFE3}, {0x01F3FB, 0x01F3FF}
+};
+
+static const Segment<char32_t> segments_Sm[] = {
+    {0x00002B, 0x00002B}, {0x00003C, 0x00003E}, {0x00007C, 0x00007C}, {0x00007E, 0x00007E},
+    {0x0000AC, 0x0000AC}, {0x0000B1, 0x0000B1}, {0x0000D7, 0x0000D7}, {0x0000F7, 0x0000F7},
+    {0x0003F6, 0x0003F6}, {0x000606, 0x000608}, {0x002044, 0x002044}, {0x002052, 0x002052},
+    {0x00207A, 0x00207C}, {0x00208A, 0x00208C}, {0x002118, 0x002118}, {0x002140, 0x002144},
+    {0x00214B, 0x00214B}, {0x002190, 0x002194}, {0x00219A, 0x00219B}, {0x0021A0, 0x0021A0},
+    {0x0021A3, 0x0021A3}, {0x0021A6, 0x0021A6}, {0x0021AE, 0x0021AE}, {0x0021CE, 0x0021CF},
+    {0x0021D2, 0x0021D2}, {0x0021D4, 0x0021D4}, {0x0021F4, 0x0022FF}, {0x002320, 0x002321},
+    {0x00237C, 0x00237C}, {0x00239B, 0x0023B3}, {0x0023DC, 0x0023E1}, {0x0025B7, 0x0025B7},
+    {0x0025C1, 0x0025C1}, {0x0025F8, 0x0025FF}, {0x00266F, 0x00266F}, {0x0027C0, 0x0027C4},
+    {0x0027C7, 0x0027E5}, {0x0027F0, 0x0027FF}, {0x002900, 0x002982}, {0x002999, 0x0029D7},
+    {0x0029DC, 0x0029FB}, {0x0029FE, 0x002AFF}, {0x002B30, 0x002B44}, {0x002B47, 0x002B4C},
+    {0x00FB29, 0x00FB29}, {0x00FE62, 0x00FE62}, {0x00FE64, 0x00FE66}, {0x00FF0B, 0x00FF0B},
+    {0x00FF1C, 0x00FF1E}, {0x00FF5C, 0x00FF5C}, {0x00FF5E, 0x00FF5E}, {0x00FFE2, 0x00FFE2},
+    {0x00FFE9, 0x00FFEC}, {0x01D6C1, 0x01D6C1}, {0x01D6DB, 0x01D6DB}, {0x01D6FB, 0x01D6FB},
+    {0x01D715, 0x01D715}, {0x01D735, 0x01D735}, {0x01D74F, 0x01D74F}, {0x01D76F, 0x01D76F},
+    {0x01D789, 0x01D789}, {0x01D7A9, 0x01D7A9}, {0x01D7C3, 0x01D7C3}, {0x01EEF0, 0x01EEF1}
+};
+
+static const Segment<char32_t> segments_So[] = {
+    {0x0000A6, 0x0000A6}, {0x0000A9, 0x0000A9}, {0x0000AE, 0x0000AE}, {0x0000B0, 0x0000B0},
+    {0x000482, 0x000482}, {0x00058D, 0x00058E}, {0x00060E, 0x00060F}, {0x0006DE, 0x0006DE},
+    {0x0006E9, 0x0006E9}, {0x0006FD, 0x0006FE}, {0x0007F6, 0x0007F6}, {0x0009FA, 0x0009FA},
+    {0x000B70, 0x000B70}, {0x000BF3, 0x000BF8}, {0x000BFA, 0x000BFA}, {0x000C7F, 0x000C7F},
+    {0x000D4F, 0x000D4F}, {0x000D79, 0x000D79}, {0x000F01, 0x000F03}, {0x000F13, 0x000F13},
+    {0x000F15, 0x000F17}, {0x000F1A, 0x000F1F}, {0x000F34, 0x000F34}, {0x000F36, 0x000F36},
+    {0x000F38, 0x000F38}, {0x000FBE, 0x000FC5}, {0x000FC7, 0x000FCC}, {0x000FCE, 0x000FCF},
+    {0x000FD5, 0x000FD8}, {0x00109E, 0x00109F}, {0x001390, 0x001399}, {0x00166D, 0x00166D},
+    {0x001940, 0x001940}, {0x0019DE, 0x0019FF}, {0x001B61, 0x001B6A}, {0x001B74, 0x001B7C},
+    {0x002100, 0x002101}, {0x002103, 0x002106}, {0x002108, 0x002109}, {0x002114, 0x002114},
+    {0x002116, 0x002117}, {0x00211E, 0x002123}, {0x002125, 0x002125}, {0x002127, 0x002127},
+    {0x002129, 0x002129}, {0x00212E, 0x00212E}, {0x00213A, 0x00213B}, {0x00214A, 0x00214A},
+    {0x00214C, 0x00214D}, {0x00214F, 0x00214F}, {0x00218A, 0x00218B}, {0x002195, 0x002199},
+    {0x00219C, 0x00219F}, {0x0021A1, 0x0021A2}, {0x0021A4, 0x0021A5}, {0x0021A7, 0x0021AD},
+    {0x0021AF, 0x0021CD}, {0x0021D0, 0x0021D1}, {0x0021D3, 0x0021D3}, {0x0021D5, 0x0021F3},
+    {0x002300, 0x002307}, {0x00230C, 0x00231F}, {0x002322, 0x002328}, {0x00232B, 0x00237B},
+    {0x00237D, 0x00239A}, {0x0023B4, 0x0023DB}, {0x0023E2, 0x002426}, {0x002440, 0x00244A},
+    {0x00249C, 0x0024E9}, {0x002500, 0x0025B6}, {0x0025B8, 0x0025C0}, {0x0025C2, 0x0025F7},
+    {0x002600, 0x00266E}, {0x002670, 0x002767}, {0x002794, 0x0027BF}, {0x002800, 0x0028FF},
+    {0x002B00, 0x002B2F}, {0x002B45, 0x002B46}, {0x002B4D, 0x002B73}, {0x002B76, 0x002B95},
+    {0x002B97, 0x002BFF}, {0x002CE5, 0x002CEA}, {0x002E50, 0x002E51}, {0x002E80, 0x002E99},
+    {0x002E9B, 0x002EF3}, {0x002F00, 0x002FD5}, {0x002FF0, 0x002FFB}, {0x003004, 0x003004},
+    {0x003012, 0x003013}, {0x003020, 0x003020}, {0x003036, 0x003037}, {0x00303E, 0x00303F},
+    {0x003190, 0x003191}, {0x003196, 0x00319F}, {0x0031C0, 0x0031E3}, {0x003200, 0x00321E},
+    {0x00322A, 0x003247}, {0x003250, 0x003250}, {0x003260, 0x00327F}, {0x00328A, 0x0032B0},
+    {0x0032C0, 0x0033FF}, {0x004DC0, 0x004DFF}, {0x00A490, 0x00A4C6}, {0x00A828, 0x00A82B},
+    {0x00A836, 0x00A837}, {0x00A839, 0x00A839}, {0x00AA77, 0x00AA79}, {0x00FD40, 0x00FD4F},
+    {0x00FDCF, 0x00FDCF}, {0x00FDFD, 0x00FDFF}, {0x00FFE4, 0x00FFE4}, {0x00FFE8, 0x00FFE8},
+    {0x00FFED, 0x00FFEE}, {0x00FFFC, 0x00FFFD}, {0x010137, 0x01013F}, {0x010179, 0x010189},
+    {0x01018C, 0x01018E}, {0x010190, 0x01019C}, {0x0101A0, 0x0101A0}, {0x0101D0, 0x0101FC},
+    {0x010877, 0x010878}, {0x010AC8, 0x010AC8}, {0x01173F, 0x01173F}, {0x011FD5, 0x011FDC},
+    {0x011FE1, 0x011FF1}, {0x016B3C, 0x016B3F}, {0x016B45, 0x016B45}, {0x01BC9C, 0x01BC9C},
+    {0x01CF50, 0x01CFC3}, {0x01D000, 0x01D0F5}, {0x01D100, 0x01D126}, {0x01D129, 0x01D164},
+    {0x01D16A, 0x01D16C}, {0x01D183, 0x01D184}, {0x01D18C, 0x01D1A9}, {0x01D1AE, 0x01D1EA},
+    {0x01D200, 0x01D241}, {0x01D245, 0x01D245}, {0x01D300, 0x01D356}, {0x01D800, 0x01D9FF},
+    {0x01DA37, 0x01DA3A}, {0x01DA6D, 0x01DA74}, {0x01DA76, 0x01DA83}, {0x01DA85, 0x01DA86},
+    {0x01E14F, 0x01E14F}, {0x01ECAC, 0x01ECAC}, {0x01ED2E, 0x01ED2E}, {0x01F000, 0x01F02B},
+    {0x01F030, 0x01F093}, {0x01F0A0, 0x01F0AE}, {0x01F0B1, 0x01F0BF}, {0x01F0C1, 0x01F0CF},
+    {0x01F0D1, 0x01F0F5}, {0x01F10D, 0x01F1AD}, {0x01F1E6, 0x01F202}, {0x01F210, 0x01F23B},
+    {0x01F240, 0x01F248}, {0x01F250, 0x01F251}, {0x01F260, 0x01F265}, {0x01F300, 0x01F3FA},
+    {0x01F400, 0x01F6D7}, {0x01F6DD, 0x01F6EC}, {0x01F6F0, 0x01F6FC}, {0x01F700, 0x01F773},
+    {0x01F780, 0x01F7D8}, {0x01F7E0, 0x01F7EB}, {0x01F7F0, 0x01F7F0}, {0x01F800, 0x01F80B},
+    {0x01F810, 0x01F847}, {0x01F850, 0x01F859}, {0x01F860, 0x01F887}, {0x01F890, 0x01F8AD},
+    {0x01F8B0, 0x01F8B1}, {0x01F900, 0x01FA53}, {0x01FA60, 0x01FA6D}, {0x01FA70, 0x01FA74},
+    {0x01FA78, 0x01FA7C}, {0x01FA80, 0x01FA86}, {0x01FA90, 0x01FAAC}, {0x01FAB0, 0x01FABA},
+    {0x01FAC0, 0x01FAC5}, {0x01FAD0, 0x01FAD9}, {0x01FAE0, 0x01FAE7}, {0x01FAF0, 0x01FAF6},
+    {0x01FB00, 0x01FB92}, {0x01FB94, 0x01FBCA}
+};
+
+static const Segment<char32_t> segments_Z[] = {
+    {0x000020, 0x000020}, {0x0000A0, 0x0000A0}, {0x001680, 0x001680}, {0x002000, 0x00200A},
+    {0x002028, 0x002029}, {0x00202F, 0x00202F}, {0x00205F, 0x00205F}, {0x003000, 0x003000}
+};
+
+static const Segment<char32_t> segments_Zl[] = {
+    {0x002028, 0x002028}
+};
+
+static const Segment<char32_t> segments_Zp[] = {
+    {0x002029, 0x002029}
+};
+
+static const Segment<char32_t> segments_Zs[] = {
+    {0x000020, 0x000020}, {0x0000A0, 0x0000A0}, {0x001680, 0x001680}, {0x002000, 0x00200A},
+    {0x00202F, 0x00202F}, {0x00205F, 0x00205F}, {0x003000, 0x003000}
+};
+
+const Unicode_category_info unicode_categories[] = {
+    {"C",   segments_C,   size(segments_C)},
+    {"Cc",  segments_Cc,  size(segments_Cc)},
+    {"Cf",  segments_Cf,  size(segments_Cf)},
+    {"Cn",  segments_Cn,  size(segments_Cn)},
+    {"Co",  segments_Co,  size(segments_Co)},
+    {"Cs",  segments_Cs,  size(segments_Cs)},
+    {"L",   segments_L,   size(segments_L)},
+    {"Ll",  segments_Ll,  size(segments_Ll)},
+    {"Lm",  segments_Lm,  size(segments_Lm)},
+    {"Lo",  segments_Lo,  size(segments_Lo)},
+    {"Lt",  segments_Lt,  size(segments_Lt)},
+    {"Lu",  segments_Lu,  size(segments_Lu)},
+    {"M",   segments_M,   size(segments_M)},
+    {"Mc",  segments_Mc,  size(segments_Mc)},
+    {"Me",  segments_Me,  size(segments_Me)},
+    {"Mn",  segments_Mn,  size(segments_Mn)},
+    {"N",   segments_N,   size(segments_N)},
+    {"Nd",  segments_Nd,  size(segments_Nd)},
+    {"Nl",  segments_Nl,  size(segments_Nl)},
+    {"No",  segments_No,  size(segments_No)},
+    {"P",   segments_P,   size(segments_P)},
+    {"Pc",  segments_Pc,  size(segments_Pc)},
+    {"Pd",  segments_Pd,  size(segments_Pd)},
+    {"Pe",  segments_Pe,  size(segments_Pe)},
+    {"Pf",  segments_Pf,  size(segments_Pf)},
+    {"Pi",  segments_Pi,  size(segments_Pi)},
+    {"Po",  segments_Po,  size(segments_Po)},
+    {"Ps",  segments_Ps,  size(segments_Ps)},
+    {"S",   segments_S,   size(segments_S)},
+    {"Sc",  segments_Sc,  size(segments_Sc)},
+    {"Sk",  segments_Sk,  size(segments_Sk)},
+    {"Sm",  segments_Sm,  size(segments_Sm)},
+    {"So",  segments_So,  size(segments_So)},
+    {"Z",   segments_Z,   size(segments_Z)},
+    {"Zl",  segments_Zl,  size(segments_Zl)},
+    {"Zp",  segments_Zp,  size(segments_Zp)},
+    {"Zs",  segments_Zs,  size(segments_Zs)}
+};
+
+const size_t number_of_unicode_categories = size(unicode_categories);
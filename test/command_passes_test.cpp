@@ -0,0 +1,344 @@
+/*
+    File:    command_passes_test.cpp
+    Created: 19 October 2026 at 14:10 Moscow time
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+
+#include <cstdio>
+#include <set>
+#include <string>
+#include <vector>
+#include <memory>
+#include "../include/get_processed_text.h"
+#include "../include/location.h"
+#include "../include/errors_and_tries.h"
+#include "../include/error_count.h"
+#include "../include/diagnostics.h"
+#include "../include/char_trie.h"
+#include "../include/scope.h"
+#include "../include/trie_for_set_of_segments.h"
+#include "../include/expr_scaner.h"
+#include "../include/expr_parser.h"
+#include "../include/expr_lr_tables.h"
+#include "../include/command.h"
+#include "../include/command_passes.h"
+
+/* The session of parsing of expressions written one after another in a text. */
+struct Session{
+    std::u32string                         text;
+    std::shared_ptr<ascaner::Location>     loc;
+    Errors_and_tries                       et;
+    std::shared_ptr<Scope>                 scope;
+    Trie_for_char_segments_ptr             sets;
+    std::shared_ptr<escaner::Expr_scaner>  scaner;
+    std::shared_ptr<SLR_act_expr_parser>   parser;
+
+    explicit Session(const std::u32string& t);
+
+    /* Compiles the next expression into buf. Returns false, if the text has ended or
+     * the expression has errors. */
+    bool next(Command_buffer& buf);
+};
+
+Session::Session(const std::u32string& t) : text(t)
+{
+    loc        = std::make_shared<ascaner::Location>(const_cast<char32_t*>(text.c_str()));
+    et.ec_     = std::make_shared<Error_count>();
+    et.ids_trie_  = std::make_shared<Char_trie>();
+    et.strs_trie_ = std::make_shared<Char_trie>();
+    et.diags_  = std::make_shared<Diagnostics>(et.ids_trie_);
+    scope      = std::make_shared<Scope>();
+    sets       = std::make_shared<Trie_for_char_segments>();
+    scaner     = std::make_shared<escaner::Expr_scaner>(loc, et, sets, scope);
+    parser     = std::make_shared<SLR_act_expr_parser>(scaner, et, scope, expr_slr_tables);
+}
+
+bool Session::next(Command_buffer& buf)
+{
+    const char32_t* p = loc->pcurrent_char_;
+    while((*p == U' ') || (*p == U'\t') || (*p == U'\n') || (*p == U'\r')){
+        ++p;
+    }
+    if(!*p){
+        return false;
+    }
+    size_t errors = et.ec_->get_number_of_errors();
+    buf.clear();
+    parser->compile(buf);
+    return (et.ec_->get_number_of_errors() == errors) && !buf.empty();
+}
+
+using Positions = std::set<size_t>;
+
+/* The brute-force matcher of commands: ends(i, pos) is the set of positions in str
+ * at which a match of the command i starting at the position pos can end. The
+ * commands may be both binary and n-ary. */
+class Matcher{
+public:
+    Matcher(const Flat_commands& buf, const Trie_for_char_segments_ptr& sets) :
+        buf_(buf), sets_(sets) {};
+
+    /* Checks whether the string str belongs to the language of the last command. */
+    bool accepts(const std::u32string& str)
+    {
+        str_ = str;
+        return ends(buf_.commands_.size() - 1, 0).count(str.size()) != 0;
+    }
+private:
+    const Flat_commands&       buf_;
+    Trie_for_char_segments_ptr sets_;
+    std::u32string             str_;
+
+    bool in_set(uint32_t idx_of_set, char32_t c) const
+    {
+        for(const auto& s : sets_->get_set(idx_of_set)){
+            if((s.lower_bound <= c) && (c <= s.upper_bound)){
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::vector<uint32_t> operands(const Command& com) const
+    {
+        if((Command_name::Or == com.name_) || (Command_name::Concat == com.name_)){
+            return {com.args.first_, com.args.second_};
+        }
+        auto first = buf_.operands_.begin() + com.args.first_;
+        return std::vector<uint32_t>(first, first + com.args.second_);
+    }
+
+    Positions ends(size_t i, size_t pos) const;
+};
+
+Positions Matcher::ends(size_t i, size_t pos) const
+{
+    const Command& com = buf_.commands_[i];
+    Positions      result;
+    switch(com.name_){
+        case Command_name::Char:
+            if((pos < str_.size()) && (str_[pos] == com.c_)){
+                result.insert(pos + 1);
+            }
+            break;
+        case Command_name::Char_class:
+        case Command_name::Char_class_complement:
+            if((pos < str_.size()) &&
+               (in_set(com.idx_of_set_, str_[pos]) == (Command_name::Char_class == com.name_)))
+            {
+                result.insert(pos + 1);
+            }
+            break;
+        case Command_name::Or:
+        case Command_name::Multior:
+            for(auto op : operands(com)){
+                auto e = ends(op, pos);
+                result.insert(e.begin(), e.end());
+            }
+            break;
+        case Command_name::Concat:
+        case Command_name::Multiconcat:
+            result.insert(pos);
+            for(auto op : operands(com)){
+                Positions next;
+                for(auto p : result){
+                    auto e = ends(op, p);
+                    next.insert(e.begin(), e.end());
+                }
+                result = next;
+            }
+            break;
+        case Command_name::Optional:
+            result = ends(com.args.first_, pos);
+            result.insert(pos);
+            break;
+        case Command_name::Kleene:
+        case Command_name::Positive:
+            {
+                Positions front{pos};
+                Positions visited;
+                if(Command_name::Kleene == com.name_){
+                    result.insert(pos);
+                }
+                while(!front.empty()){
+                    Positions next;
+                    for(auto p : front){
+                        if(!visited.insert(p).second){
+                            continue;
+                        }
+                        auto e = ends(com.args.first_, p);
+                        result.insert(e.begin(), e.end());
+                        next.insert(e.begin(), e.end());
+                    }
+                    front = next;
+                }
+            }
+            break;
+        default:
+            ;
+    }
+    return result;
+}
+
+/* The characters of strings on which languages are compared: the characters of the
+ * expression, the bounds of its sets, and a character that is usually in no set. */
+static std::u32string alphabet(const Command_buffer& buf, const Trie_for_char_segments_ptr& sets)
+{
+    constexpr size_t max_size = 5;
+    std::u32string   result;
+    auto             add      = [&result](char32_t c){
+        if((result.size() < max_size) && (result.find(c) == std::u32string::npos)){
+            result += c;
+        }
+    };
+    for(const auto& com : buf){
+        if(Command_name::Char == com.name_){
+            add(com.c_);
+        }else if((Command_name::Char_class == com.name_) ||
+                 (Command_name::Char_class_complement == com.name_))
+        {
+            auto s = sets->get_set(com.idx_of_set_);
+            if(!s.empty()){
+                add(s.begin()->lower_bound);
+                add(s.rbegin()->upper_bound);
+            }
+        }
+    }
+    result += U'~';
+    return result;
+}
+
+/* Checks that the commands before and after the passes accept the same strings of
+ * length at most max_len over the alphabet of the expression. */
+static bool same_language(const Command_buffer& before, const Flat_commands& after,
+                          const Trie_for_char_segments_ptr& sets)
+{
+    constexpr size_t max_len  = 4;
+    Flat_commands    original;
+    original.commands_        = before;
+    Matcher          m1(original, sets);
+    Matcher          m2(after, sets);
+    std::u32string   letters  = alphabet(before, sets);
+    std::u32string   str;
+    /* The strings are enumerated as numbers in the base letters.size(). */
+    std::vector<size_t> digits;
+    for(size_t len = 0; len <= max_len; ++len){
+        digits.assign(len, 0);
+        for( ; ; ){
+            str.clear();
+            for(auto d : digits){
+                str += letters[d];
+            }
+            if(m1.accepts(str) != m2.accepts(str)){
+                return false;
+            }
+            size_t k = 0;
+            while((k < len) && (++digits[k] == letters.size())){
+                digits[k++] = 0;
+            }
+            if(k == len){
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+static Flat_commands run_passes(const Command_buffer& buf, const Trie_for_char_segments_ptr& sets)
+{
+    Flat_commands         simplified = simplify(flatten(buf), sets);
+    std::vector<uint32_t> ref_counts;
+    resolve_actions(simplified);
+    return hash_cons(simplified, ref_counts);
+}
+
+/* Builds the alternation of number_of_alternatives alternatives written by alt. */
+template<typename F>
+static std::u32string alternation(size_t number_of_alternatives, F alt)
+{
+    std::u32string result = U"{";
+    for(size_t k = 0; k < number_of_alternatives; ++k){
+        if(k){
+            result += U'|';
+        }
+        result += alt(k);
+    }
+    return result + U"}";
+}
+
+/* Checks the sizes of commands for expressions that the passes must shrink. */
+static bool check_shrinking()
+{
+    bool ok = true;
+
+    /* The alternation of 500 strings of three letters: 500 concatenations of three
+     * letters and 499 commands Or become 500 commands Multiconcat of three letters
+     * and one command Multior. */
+    Session        s1(alternation(500, [](size_t k){
+        return std::u32string(1, U'a' + k % 26) + U"bc";
+    }));
+    Command_buffer buf;
+    if(!s1.next(buf) || (buf.size() != 2999) || (flatten(buf).commands_.size() != 2001)){
+        puts("The 500-way alternation of strings is not flattened into 2001 commands.");
+        ok = false;
+    }
+
+    /* The alternation of 500 distinct characters: 500 characters and 499 commands Or
+     * become one character class. */
+    Session s2(alternation(500, [](size_t k){
+        return std::u32string(1, U'\x4E00' + k);
+    }));
+    if(!s2.next(buf) || (buf.size() != 999) ||
+       (run_passes(buf, s2.sets).commands_.size() != 1))
+    {
+        puts("The 500-way alternation of characters is not simplified into one class.");
+        ok = false;
+    }
+
+    /* The repeated alternation of strings: the seven commands of the second copy of
+     * (ab|cd) are shared with the first one, so 16 commands become 9. */
+    Session s3(U"{(ab|cd)(ab|cd)*}");
+    if(!s3.next(buf) || (buf.size() != 16) || (run_passes(buf, s3.sets).commands_.size() != 9)){
+        puts("The repeated subexpression of (ab|cd)(ab|cd)* is not shared.");
+        ok = false;
+    }
+    return ok;
+}
+
+int main(int argc, char* argv[])
+{
+    if(argc < 2){
+        puts("Usage: command-passes-test file-with-expressions");
+        return 1;
+    }
+    auto text = get_processed_text(argv[1]);
+    if(!text.length()){
+        return 1;
+    }
+    Session        s(text);
+    Command_buffer buf;
+    size_t         number_of_expressions = 0;
+    size_t         number_of_mismatches  = 0;
+    while(s.loc->pcurrent_char_ && *s.loc->pcurrent_char_){
+        const char32_t* before = s.loc->pcurrent_char_;
+        if(s.next(buf)){
+            number_of_expressions++;
+            if(!same_language(buf, run_passes(buf, s.sets), s.sets)){
+                printf("The passes change the language of the expression number %zu.\n",
+                       number_of_expressions);
+                number_of_mismatches++;
+            }
+        }
+        if(s.loc->pcurrent_char_ == before){
+            break;
+        }
+    }
+    bool ok = check_shrinking() && !number_of_mismatches;
+    printf("%zu expressions checked.\n", number_of_expressions);
+    puts(ok ? "The passes keep the languages of expressions." :
+              "The passes are wrong.");
+    return ok ? 0 : 1;
+}
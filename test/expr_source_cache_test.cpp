@@ -0,0 +1,85 @@
+/*
+    File:    expr_source_cache_test.cpp
+    Created: 19 October 2026 at 15:05 Moscow time
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+
+#include <cstdio>
+#include <string>
+#include <memory>
+#include "../include/location.h"
+#include "../include/errors_and_tries.h"
+#include "../include/error_count.h"
+#include "../include/diagnostics.h"
+#include "../include/char_trie.h"
+#include "../include/scope.h"
+#include "../include/trie_for_set_of_segments.h"
+#include "../include/expr_scaner.h"
+#include "../include/expr_prec_parser.h"
+#include "../include/expr_source_cache.h"
+
+static const std::u32string text = U"{a$x} {a$x} {a$x} {a$x} {a$x} {b%r} {b%r} {b%r}";
+
+/* The kinds of identifiers as the parser and the scanner check them. */
+static const Id_kinds action_kind = static_cast<Id_kinds>(Id_kind::Action_name);
+static const Id_kinds regexp_kind = 1u << static_cast<uint8_t>(Id_kind::Regexp_name);
+
+int main()
+{
+    auto             loc = std::make_shared<ascaner::Location>(const_cast<char32_t*>(text.c_str()));
+    Errors_and_tries et;
+    et.ec_        = std::make_shared<Error_count>();
+    et.ids_trie_  = std::make_shared<Char_trie>();
+    et.strs_trie_ = std::make_shared<Char_trie>();
+    et.diags_     = std::make_shared<Diagnostics>(et.ids_trie_);
+    auto scope    = std::make_shared<Scope>();
+    auto sets     = std::make_shared<Trie_for_char_segments>();
+    auto exprsc   = std::make_shared<escaner::Expr_scaner>(loc, et, sets, scope);
+    Cached_expr_parser<Prec_expr_parser> parser(loc, exprsc, et, scope);
+
+    size_t x = et.ids_trie_->insert(U"x");
+    size_t r = et.ids_trie_->insert(U"r");
+
+    /* Every step changes the scope, compiles the next expression, and gives the
+     * expected number of new errors. */
+    struct Step{
+        const char* what;
+        Id_kinds    x_kind;
+        Id_kinds    r_kind;
+        size_t      errors;
+    };
+    static const Step steps[] = {
+        {"the action defined",                          action_kind, 0,           0},
+        {"the cached source reused",                    action_kind, 0,           0},
+        {"the action undefined",                        0,           0,           1},
+        {"the action defined again",                    action_kind, 0,           0},
+        {"the action redefined as a regexp name",       regexp_kind, 0,           1},
+        {"the regexp name defined",                     regexp_kind, regexp_kind, 0},
+        {"the cached source with a regexp name reused", regexp_kind, regexp_kind, 0},
+        {"the regexp name redefined as an action",      regexp_kind, action_kind, 1},
+    };
+    bool ok = true;
+    for(const auto& step : steps){
+        scope->idsc_.erase(x);
+        scope->idsc_.erase(r);
+        if(step.x_kind){
+            scope->idsc_[x].kind_ = step.x_kind;
+        }
+        if(step.r_kind){
+            scope->idsc_[r].kind_ = step.r_kind;
+        }
+        size_t         errors = et.ec_->get_number_of_errors();
+        Command_buffer buf;
+        parser.compile(buf);
+        if(et.ec_->get_number_of_errors() - errors != step.errors){
+            printf("Expr_source_cache: wrong number of errors after %s.\n", step.what);
+            ok = false;
+        }
+    }
+    puts(ok ? "The cache of sources reports the changes of the scope." :
+              "The cache of sources ignores the changes of the scope.");
+    return ok ? 0 : 1;
+}
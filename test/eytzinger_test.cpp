@@ -0,0 +1,62 @@
+/*
+    File:    eytzinger_test.cpp
+    Created: 19 October 2026 at 12:41 Moscow time
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+
+#include <cstdio>
+#include <vector>
+#include <utility>
+#include "../include/eytzinger_find.h"
+
+/* Checks eytzinger_find and eytzinger_find_many against the linear search for
+ * tables of N segments. The segments [3i, 3i + 1] have the values i, so every third
+ * key belongs to no segment. Tables of different sizes have different depths and
+ * different numbers of padding copies; the number of keys is not a multiple of the
+ * group size of eytzinger_find_many. */
+template<size_t N>
+static bool check_table()
+{
+    Segment_with_value<char32_t, size_t> sorted[N];
+    for(size_t i = 0; i < N; ++i){
+        sorted[i].bounds.lower_bound = static_cast<char32_t>(3 * i);
+        sorted[i].bounds.upper_bound = static_cast<char32_t>(3 * i + 1);
+        sorted[i].value              = i;
+    }
+    auto t = build_eytzinger(sorted);
+
+    std::vector<char32_t> keys;
+    for(char32_t c = 0; c < 3 * N + 5; ++c){
+        keys.push_back(c);
+    }
+    keys.push_back(U'\x10FFFF');
+    std::vector<std::pair<bool, size_t>> many(keys.size());
+    eytzinger_find_many(t, keys.begin(), keys.end(), many.begin());
+
+    bool ok = true;
+    for(size_t j = 0; j < keys.size(); ++j){
+        char32_t c        = keys[j];
+        bool     expected = (c < 3 * N) && ((c % 3) != 2);
+        auto     one      = eytzinger_find(t, c);
+        bool     found    = one.first && (t.elems[one.second].value == c / 3);
+        if((one.first != expected) || (expected && !found) || (many[j] != one)){
+            printf("Table of %zu segments: wrong result for the key %u.\n",
+                   N, static_cast<unsigned>(c));
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+int main()
+{
+    bool ok = check_table<1>()  && check_table<2>()  && check_table<3>()  &&
+              check_table<7>()  && check_table<8>()  && check_table<33>() &&
+              check_table<64>() && check_table<100>();
+    puts(ok ? "eytzinger_find_many agrees with eytzinger_find." :
+              "eytzinger_find_many and eytzinger_find disagree.");
+    return ok ? 0 : 1;
+}
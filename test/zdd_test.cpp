@@ -0,0 +1,121 @@
+/*
+    File:    zdd_test.cpp
+    Created: 19 October 2026 at 13:02 Moscow time
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+
+#include <cstdio>
+#include <set>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <iterator>
+#include "../include/trie_for_set.h"
+#include "../include/zdd_for_set.h"
+
+using Set    = std::set<size_t>;
+using Family = std::set<Set>;
+
+static bool check(bool condition, const char* what)
+{
+    if(!condition){
+        printf("Zdd_for_set: %s.\n", what);
+    }
+    return condition;
+}
+
+/* Checks that Zdd_for_set keeps the contract of Trie_for_set: the empty set has the
+ * index 0, equal sets and only they have equal indices, and get_set gives back the
+ * inserted set. */
+static bool check_sets(const std::vector<Set>& sets, std::vector<size_t>& zdd_indices,
+                       Zdd_for_set_of_sizet& zdd)
+{
+    Trie_for_set_of_sizet trie;
+    std::vector<size_t>   trie_indices;
+    for(const auto& s : sets){
+        trie_indices.push_back(trie.insertSet(s));
+        zdd_indices.push_back(zdd.insertSet(s));
+    }
+    bool ok = check((trie.insertSet(Set()) == 0) && (zdd.insertSet(Set()) == 0),
+                    "the index of the empty set is not 0");
+    for(size_t i = 0; i < sets.size(); ++i){
+        ok = ok && check(zdd.get_set(zdd_indices[i]) == sets[i],
+                         "get_set does not give back the inserted set");
+        ok = ok && check(trie.get_set(trie_indices[i]) == sets[i],
+                         "Trie_for_set::get_set does not give back the inserted set");
+        for(size_t j = 0; ok && (j < sets.size()); ++j){
+            bool equal = sets[i] == sets[j];
+            ok = check((zdd_indices[i] == zdd_indices[j]) == equal,
+                       "equal indices do not mean equal sets") &&
+                 check((trie_indices[i] == trie_indices[j]) == equal,
+                       "Trie_for_set disagrees on equality of sets");
+        }
+    }
+    return ok;
+}
+
+static bool check_family(const Zdd_for_set_of_sizet& zdd, size_t f, const Family& expected,
+                         const std::vector<Set>& sets)
+{
+    bool ok = check(zdd.count(f) == expected.size(), "wrong number of sets in a family");
+    for(const auto& s : sets){
+        ok = ok && check(zdd.contains(f, s) == (expected.count(s) != 0),
+                         "wrong membership of a set in a family");
+    }
+    return ok;
+}
+
+int main()
+{
+    std::mt19937                          gen(2026);
+    std::uniform_int_distribution<size_t> size_dist(0, 6);
+    std::uniform_int_distribution<size_t> elem_dist(0, 11);
+    std::vector<Set>                      sets;
+    for(size_t i = 0; i < 300; ++i){
+        Set    s;
+        size_t n = size_dist(gen);
+        for(size_t j = 0; j < n; ++j){
+            s.insert(elem_dist(gen));
+        }
+        sets.push_back(s);
+    }
+    sets.push_back(Set());
+
+    Zdd_for_set_of_sizet zdd;
+    std::vector<size_t>  indices;
+    bool ok = check_sets(sets, indices, zdd);
+
+    /* The families of the first and of the second halves of the sets, their union
+     * and their intersection. */
+    size_t half = sets.size() / 2;
+    size_t f    = Zdd_for_set_of_sizet::empty_family;
+    size_t g    = Zdd_for_set_of_sizet::empty_family;
+    Family ef;
+    Family eg;
+    for(size_t i = 0; i < sets.size(); ++i){
+        if(i < half){
+            f = zdd.unite(f, indices[i]);
+            ef.insert(sets[i]);
+        }else{
+            g = zdd.unite(g, indices[i]);
+            eg.insert(sets[i]);
+        }
+    }
+    Family eu;
+    Family ei;
+    std::set_union(ef.begin(), ef.end(), eg.begin(), eg.end(), std::inserter(eu, eu.end()));
+    std::set_intersection(ef.begin(), ef.end(), eg.begin(), eg.end(),
+                          std::inserter(ei, ei.end()));
+    ok = ok && check_family(zdd, f, ef, sets) && check_family(zdd, g, eg, sets) &&
+         check_family(zdd, zdd.unite(f, g), eu, sets) &&
+         check_family(zdd, zdd.intersect(f, g), ei, sets) &&
+         check_family(zdd, Zdd_for_set_of_sizet::empty_family, Family(), sets) &&
+         check_family(zdd, Zdd_for_set_of_sizet::unit_family, Family{Set()}, sets);
+
+    puts(ok ? "Zdd_for_set agrees with Trie_for_set." :
+              "Zdd_for_set disagrees with Trie_for_set.");
+    return ok ? 0 : 1;
+}
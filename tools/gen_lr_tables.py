@@ -0,0 +1,685 @@
+#!/usr/bin/env python3
+#
+#   File:    gen_lr_tables.py
+#   Created: 19 October 2026 at 13:02 Moscow time
+#   Author:  Гаврилов Владимир Сергеевич
+#   E-mails: vladimir.s.gavrilov@gmail.com
+#            gavrilov.vladimir.s@mail.ru
+#            gavvs1977@yandex.ru
+#
+# This script builds SLR(1) or LALR(1) tables for a grammar described in a text file
+# (see tools/expr_grammar.txt) and writes them as a C++ file defining a constant of
+# the type LR_parser_tables<...> (see include/types_for_lr_tables.h).
+#
+# With the option --kind direct, the script writes instead the function compile() of
+# a direct-coded parser: every state is a block of code, and transitions are jumps
+# between blocks, so no tables are read while parsing. The class of this parser
+# (the directive %direct_parser) must be derived from the parser with the tables;
+# it inherits the hooks and error handlers of that parser, and the steps start,
+# read_lexeme, shift_to, reduce_by and finish of Basic_LR_parser (see
+# include/lr_parser.h). The hook lexem2terminal maps every lexeme to a terminal of
+# the grammar, so the most frequent action of a state is its default label.
+#
+# States are numbered in the order of a breadth-first traversal of the LR(0)
+# automaton; the transitions of every state are taken in the order of non-terminals
+# and then in the order of terminals. So the numbers of states do not change if the
+# grammar does not change, and error handlers may rely on them.
+#
+# Layouts of tables:
+#     dense     two-dimensional arrays [state][symbol];
+#     comb      row displacement: significant entries of all rows are packed into
+#               one vector, and the row of every entry is checked by a check vector.
+# Default reductions: if the only action of a state is the reduction by some rule,
+# then the parser reduces by this rule in this state without reading a lookahead
+# (the option --default-reductions no disables this). Errors in such states are
+# detected in the next states.
+# Encodings:
+#     narrow    states are uint8_t, actions are Parser_action_info;
+#     wide      states are uint16_t or uint32_t, actions are Wide_parser_action_info;
+#     auto      narrow, if it is sufficient, and wide otherwise.
+# The traits of the grammar must declare the same layout and encoding; this is
+# checked by static_assert in the generated file.
+#
+# Usage:
+#     python3 tools/gen_lr_tables.py [--method slr|lalr] [--layout dense|comb]
+#                                    [--encoding auto|narrow|wide]
+#                                    [--default-reductions yes|no]
+#                                    [--kind tables|direct]
+#                                    grammar-file output-file
+
+import os
+import sys
+import argparse
+from collections import OrderedDict
+
+END_MARKER = '$'
+AUGMENTED  = -1
+
+
+class Grammar_error(Exception):
+    pass
+
+
+class Grammar:
+    def __init__(self):
+        self.include            = None
+        self.traits             = None
+        self.tables             = None
+        self.terminals          = []
+        self.nonterminals       = []
+        self.nonterminal_type   = None
+        self.nonterminal_prefix = ''
+        self.rules              = []   # list of (name, lhs, rhs)
+        self.error_actions      = []   # list of (state, kind, rule name or None)
+        self.direct_include     = None
+        self.direct_parser      = None
+
+    def is_terminal(self, x):
+        return x in self.terminal_index
+
+    def finish(self):
+        if not self.terminals or self.terminals[0] != END_MARKER:
+            raise Grammar_error('the first terminal must be ' + END_MARKER)
+        if not self.nonterminals:
+            raise Grammar_error('there are no non-terminals')
+        for d, v in (('%include', self.include), ('%traits', self.traits),
+                     ('%tables', self.tables), ('%nonterminal_type', self.nonterminal_type)):
+            if v is None:
+                raise Grammar_error('the directive %s is missing' % d)
+        self.terminal_index    = {t: i for i, t in enumerate(self.terminals)}
+        self.nonterminal_index = {n: i for i, n in enumerate(self.nonterminals)}
+        self.rule_index        = {r[0]: i for i, r in enumerate(self.rules)}
+        for name, lhs, rhs in self.rules:
+            if lhs not in self.nonterminal_index:
+                raise Grammar_error('rule %s: unknown non-terminal %s' % (name, lhs))
+            for x in rhs:
+                if (x not in self.terminal_index) and (x not in self.nonterminal_index):
+                    raise Grammar_error('rule %s: unknown symbol %s' % (name, x))
+                if x == END_MARKER:
+                    raise Grammar_error('rule %s: %s in a rule' % (name, END_MARKER))
+        self.start = self.nonterminals[0]
+
+
+def read_grammar(path):
+    g = Grammar()
+    with open(path, encoding='utf-8') as f:
+        for line_no, line in enumerate(f, 1):
+            line = line.strip()
+            if not line or line.startswith('#'):
+                continue
+            words = line.split()
+            try:
+                if words[0] == '%include':
+                    g.include = words[1]
+                elif words[0] == '%traits':
+                    g.traits = words[1]
+                elif words[0] == '%tables':
+                    g.tables = words[1]
+                elif words[0] == '%terminals':
+                    g.terminals = words[1:]
+                elif words[0] == '%nonterminals':
+                    g.nonterminals = words[1:]
+                elif words[0] == '%nonterminal_type':
+                    g.nonterminal_type = words[1]
+                elif words[0] == '%direct_include':
+                    g.direct_include = words[1]
+                elif words[0] == '%direct_parser':
+                    g.direct_parser = words[1]
+                elif words[0] == '%nonterminal_prefix':
+                    g.nonterminal_prefix = words[1]
+                elif words[0] == '%error_action':
+                    state = int(words[1])
+                    if words[2] == 'accept':
+                        g.error_actions.append((state, 'accept', None))
+                    elif words[2] == 'reduce':
+                        g.error_actions.append((state, 'reduce', words[3]))
+                    else:
+                        raise Grammar_error('unknown action ' + words[2])
+                elif words[0].endswith(':') and (len(words) >= 3) and (words[2] == '->'):
+                    g.rules.append((words[0][:-1], words[1], words[3:]))
+                else:
+                    raise Grammar_error('unrecognized line')
+            except (IndexError, ValueError, Grammar_error) as e:
+                raise Grammar_error('%s:%d: %s' % (path, line_no, e))
+    g.finish()
+    return g
+
+
+class Automaton:
+    """The LR(0) automaton. An item is a pair (rule number, position of the dot); the
+    rule with the number AUGMENTED is S' -> S, where S is the start symbol."""
+
+    def __init__(self, g):
+        self.g = g
+        self.rules_for = {n: [] for n in g.nonterminals}
+        for i, (_, lhs, _) in enumerate(g.rules):
+            self.rules_for[lhs].append(i)
+        self.symbols = g.nonterminals + g.terminals[1:]
+        self.build()
+
+    def rhs(self, rule):
+        return [self.g.start] if rule == AUGMENTED else self.g.rules[rule][2]
+
+    def lhs(self, rule):
+        return None if rule == AUGMENTED else self.g.rules[rule][1]
+
+    def closure(self, kernel):
+        items = list(kernel)
+        seen  = set(items)
+        for rule, dot in items:
+            rhs = self.rhs(rule)
+            if dot < len(rhs) and rhs[dot] in self.rules_for:
+                for r in self.rules_for[rhs[dot]]:
+                    if (r, 0) not in seen:
+                        seen.add((r, 0))
+                        items.append((r, 0))
+        return items
+
+    def build(self):
+        start            = ((AUGMENTED, 0),)
+        self.kernels     = [start]
+        self.transitions = []
+        index            = {start: 0}
+        i = 0
+        while i < len(self.kernels):
+            items   = self.closure(self.kernels[i])
+            targets = OrderedDict()
+            for x in self.symbols:
+                kernel = tuple(sorted((r, d + 1) for r, d in items
+                                      if d < len(self.rhs(r)) and self.rhs(r)[d] == x))
+                if kernel:
+                    if kernel not in index:
+                        index[kernel] = len(self.kernels)
+                        self.kernels.append(kernel)
+                    targets[x] = index[kernel]
+            self.transitions.append(targets)
+            i += 1
+
+
+def first_sets(g):
+    nullable = set()
+    first    = {n: set() for n in g.nonterminals}
+    changed  = True
+    while changed:
+        changed = False
+        for _, lhs, rhs in g.rules:
+            all_nullable = True
+            for x in rhs:
+                f = {x} if g.is_terminal(x) else first[x]
+                if not f <= first[lhs]:
+                    first[lhs] |= f
+                    changed     = True
+                if g.is_terminal(x) or x not in nullable:
+                    all_nullable = False
+                    break
+            if all_nullable and lhs not in nullable:
+                nullable.add(lhs)
+                changed = True
+    return first, nullable
+
+
+def first_of_string(g, first, nullable, symbols, lookahead):
+    result = set()
+    for x in symbols:
+        if g.is_terminal(x):
+            result.add(x)
+            return result
+        result |= first[x]
+        if x not in nullable:
+            return result
+    result.add(lookahead)
+    return result
+
+
+def follow_sets(g, first, nullable):
+    follow = {n: set() for n in g.nonterminals}
+    follow[g.start].add(END_MARKER)
+    changed = True
+    while changed:
+        changed = False
+        for _, lhs, rhs in g.rules:
+            for i, x in enumerate(rhs):
+                if g.is_terminal(x):
+                    continue
+                f = first_of_string(g, first, nullable, rhs[i + 1:], None)
+                tail_nullable = None in f
+                f.discard(None)
+                if tail_nullable:
+                    f |= follow[lhs]
+                if not f <= follow[x]:
+                    follow[x] |= f
+                    changed = True
+    return follow
+
+
+def slr_reductions(g, a):
+    """Returns for every state the list of pairs (rule, set of lookaheads)."""
+    first, nullable = first_sets(g)
+    follow          = follow_sets(g, first, nullable)
+    result          = []
+    for kernel in a.kernels:
+        reds = []
+        for rule, dot in a.closure(kernel):
+            if dot == len(a.rhs(rule)):
+                reds.append((rule, {END_MARKER} if rule == AUGMENTED
+                                   else follow[a.lhs(rule)]))
+        result.append(reds)
+    return result
+
+
+def lr1_closure(g, a, first, nullable, items):
+    """items is a list of (rule, dot, lookahead); '#' is the dummy lookahead."""
+    result = list(items)
+    seen   = set(result)
+    for rule, dot, la in result:
+        rhs = a.rhs(rule)
+        if dot < len(rhs) and rhs[dot] in a.rules_for:
+            for b in first_of_string(g, first, nullable, rhs[dot + 1:], la):
+                for r in a.rules_for[rhs[dot]]:
+                    if (r, 0, b) not in seen:
+                        seen.add((r, 0, b))
+                        result.append((r, 0, b))
+    return result
+
+
+def lalr_reductions(g, a):
+    """Lookaheads are calculated by the propagation algorithm: see Aho A.V., Lam M.S.,
+    Sethi R., Ullman J.D. Compilers: principles, techniques, and tools. --- 2nd ed.
+    --- Addison-Wesley, 2006. Algorithm 4.62."""
+    first, nullable = first_sets(g)
+    lookaheads      = [{item: set() for item in k} for k in a.kernels]
+    propagation     = [{item: [] for item in k} for k in a.kernels]
+    lookaheads[0][(AUGMENTED, 0)].add(END_MARKER)
+    for i, kernel in enumerate(a.kernels):
+        for item in kernel:
+            for rule, dot, la in lr1_closure(g, a, first, nullable, [item + ('#',)]):
+                rhs = a.rhs(rule)
+                if dot == len(rhs):
+                    continue
+                j      = a.transitions[i][rhs[dot]]
+                target = (rule, dot + 1)
+                if la == '#':
+                    propagation[i][item].append((j, target))
+                else:
+                    lookaheads[j][target].add(la)
+    changed = True
+    while changed:
+        changed = False
+        for i, kernel in enumerate(a.kernels):
+            for item in kernel:
+                for j, target in propagation[i][item]:
+                    if not lookaheads[i][item] <= lookaheads[j][target]:
+                        lookaheads[j][target] |= lookaheads[i][item]
+                        changed = True
+    result = []
+    for i, kernel in enumerate(a.kernels):
+        items = [item + (la,) for item in kernel for la in lookaheads[i][item]]
+        reds  = OrderedDict()
+        for rule, dot, la in lr1_closure(g, a, first, nullable, items):
+            if dot == len(a.rhs(rule)):
+                reds.setdefault(rule, set()).add(la)
+        result.append(list(reds.items()))
+    return result
+
+
+# Entries of the action table: None is an error, and otherwise a pair (kind, arg),
+# where kind is one of 'shift', 'reduce', 'accept'.
+def build_tables(g, a, reductions):
+    nt = len(g.terminals)
+    actions   = [[None] * nt for _ in a.kernels]
+    gotos     = [[None] * len(g.nonterminals) for _ in a.kernels]
+    conflicts = []
+    for s, targets in enumerate(a.transitions):
+        for x, to in targets.items():
+            if g.is_terminal(x):
+                actions[s][g.terminal_index[x]] = ('shift', to)
+            else:
+                gotos[s][g.nonterminal_index[x]] = to
+    for s, reds in enumerate(reductions):
+        for rule, las in reds:
+            act = ('accept', 0) if rule == AUGMENTED else ('reduce', rule)
+            for la in sorted(las, key=lambda t: g.terminal_index[t]):
+                col = g.terminal_index[la]
+                if actions[s][col] is not None and actions[s][col] != act:
+                    conflicts.append('state %d, terminal %s: %s and %s' %
+                                     (s, la, show_action(g, actions[s][col]),
+                                      show_action(g, act)))
+                else:
+                    actions[s][col] = act
+    if conflicts:
+        raise Grammar_error('conflicts:\n    ' + '\n    '.join(conflicts))
+    for state, kind, rule_name in g.error_actions:
+        if state >= len(actions):
+            raise Grammar_error('%%error_action: there is no state %d' % state)
+        if kind == 'reduce':
+            if rule_name not in g.rule_index:
+                raise Grammar_error('%%error_action: unknown rule ' + rule_name)
+            act = ('reduce', g.rule_index[rule_name])
+        else:
+            act = ('accept', 0)
+        actions[state] = [act if e is None else e for e in actions[state]]
+    return actions, gotos
+
+
+def find_default_reductions(actions):
+    """Returns for every state the reduction which is performed in the state without
+    reading a lookahead, or None."""
+    result = []
+    for row in actions:
+        acts = {e for e in row if e is not None}
+        if len(acts) == 1 and next(iter(acts))[0] == 'reduce':
+            result.append(next(iter(acts)))
+        else:
+            result.append(None)
+    return result
+
+
+def show_action(g, act):
+    kind, arg = act
+    if kind == 'shift':
+        return 'SHIFT(%d)' % arg
+    if kind == 'reduce':
+        return 'REDUCE(%s)' % g.rules[arg][0]
+    return 'ACCESS'
+
+
+def show_entry(g, act):
+    return 'ERR' if act is None else show_action(g, act)
+
+
+def choose_encoding(encoding, number_of_states, number_of_rules):
+    narrow_fits = (number_of_states < 0xFF) and (max(number_of_states, number_of_rules) < (1 << 13))
+    if encoding == 'auto':
+        encoding = 'narrow' if narrow_fits else 'wide'
+    if encoding == 'narrow':
+        if not narrow_fits:
+            raise Grammar_error('the narrow encoding is insufficient for %d states' %
+                                number_of_states)
+        return 'uint8_t', 'Parser_action_info'
+    if max(number_of_states, number_of_rules) >= (1 << 29):
+        raise Grammar_error('too many states: %d' % number_of_states)
+    state_type = 'uint16_t' if number_of_states < 0xFFFF else 'uint32_t'
+    return state_type, 'Wide_parser_action_info'
+
+
+def pack_rows(rows, width):
+    """Row displacement: returns (base, check, values), where values[base[r] + c] is the
+    entry (r, c), if check[base[r] + c] == r. Rows are placed in descending order of the
+    number of significant entries, every row at the first suitable displacement."""
+    n      = len(rows)
+    base   = [0] * n
+    check  = []
+    values = []
+    order     = sorted(range(n), key=lambda r: -sum(e is not None for e in rows[r]))
+    for r in order:
+        cols = [c for c, e in enumerate(rows[r]) if e is not None]
+        b = 0
+        while True:
+            if all(b + c >= len(check) or check[b + c] is None for c in cols):
+                break
+            b += 1
+        base[r] = b
+        for c in cols:
+            while len(check) <= b + c:
+                check.append(None)
+                values.append(None)
+            check[b + c]  = r
+            values[b + c] = rows[r][c]
+    size = max(base) + width if n else width
+    while len(check) < size:
+        check.append(None)
+        values.append(None)
+    return base, check, values
+
+
+def format_list(items, indent, width=90):
+    lines = []
+    line  = indent
+    for i, s in enumerate(items):
+        piece = s + (',' if i + 1 < len(items) else '')
+        if len(line) + len(piece) + 1 > width and line.strip():
+            lines.append(line.rstrip())
+            line = indent
+        line += piece + ' '
+    if line.strip():
+        lines.append(line.rstrip())
+    return '\n'.join(lines)
+
+
+HEADER = '''/*
+    File:    %s
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+
+/* This file is generated by the script tools/gen_lr_tables.py from the grammar
+ * %s (%s, %s). Do not edit it by hand. */
+
+'''
+
+
+def write_static_asserts(g, w):
+    w('static_assert(%s::number_of_terminals == %d,\n'
+      '              "The number of terminals does not match the traits of the grammar.");\n'
+      % (g.traits, len(g.terminals)))
+    w('static_assert(%s::number_of_non_terminals == %d,\n'
+      '              "The number of non-terminals does not match the traits of the grammar.");\n'
+      % (g.traits, len(g.nonterminals)))
+
+
+def write_tables(g, actions, gotos, defaults, args, out):
+    layout   = args.layout
+    state_type, action_type = choose_encoding(args.encoding, len(actions), len(g.rules))
+    n  = len(actions)
+    w  = out.write
+    w(HEADER % (os.path.basename(args.output), args.grammar, args.method.upper(),
+                'the layout ' + layout))
+    w('#include <cstdint>\n#include <type_traits>\n')
+    w('#include "../include/%s"\n\n' % g.include)
+    w('static_assert(%s::table_layout == Table_layout::%s,\n'
+      '              "The layout of tables does not match the traits of the grammar.");\n'
+      % (g.traits, 'Dense' if layout == 'dense' else 'Row_displacement'))
+    w('static_assert(std::is_same<%s::State_t, %s>::value &&\n'
+      '              std::is_same<%s::Action_info_t, %s>::value,\n'
+      '              "The encoding of tables does not match the traits of the grammar.");\n'
+      % (g.traits, state_type, g.traits, action_type))
+    write_static_asserts(g, w)
+    w('\n')
+
+    rule_infos = ['{%s%s, %d}' % (g.nonterminal_prefix, lhs, len(rhs))
+                  for _, lhs, rhs in g.rules]
+    w('static const Rule_info<%s> rules[] = {\n%s\n};\n\n'
+      % (g.nonterminal_type, format_list(rule_infos, '    ')))
+
+    w('/* Terminals:     %s\n * Non-terminals: %s */\n\n'
+      % (' '.join(g.terminals), ' '.join(g.nonterminals)))
+
+    w('/* Reductions performed without reading a lookahead; ERR means that the state has\n'
+      ' * no such reduction. */\n')
+    w('static const %s default_actions[] = {\n%s\n};\n\n'
+      % (action_type, format_list([show_entry(g, d) for d in defaults], '    ')))
+
+    check_sentinel = '%s(-1)' % state_type
+    if layout == 'dense':
+        w('static const %s goto_values[] = {\n' % state_type)
+        for s, row in enumerate(gotos):
+            items = ['%d' % (e if e is not None else 0) for e in row]
+            w('    /* %2d */ %s%s\n' % (s, ', '.join(items), ',' if s + 1 < n else ''))
+        w('};\n\n')
+        w('static const %s action_values[] = {\n' % action_type)
+        for s, row in enumerate(actions):
+            items = [show_entry(g, e) for e in row]
+            text  = format_list(items, '             ')
+            w('    /* %2d */ %s%s\n' % (s, text.lstrip(), ',' if s + 1 < n else ''))
+        w('};\n\n')
+        w('const LR_parser_tables<%s> %s = {\n'
+          '    rules,\n'
+          '    {goto_values,   nullptr, nullptr},\n'
+          '    {action_values, nullptr, nullptr},\n'
+          '    default_actions\n'
+          '};\n' % (g.traits, g.tables))
+        return
+
+    # The rows of states having default reductions are never read.
+    actions = [[None] * len(row) if d is not None else row
+               for row, d in zip(actions, defaults)]
+
+    for name, rows, show, width in (('goto', gotos, lambda e: '%d' % e, len(g.nonterminals)),
+                                    ('action', actions, lambda e: show_entry(g, e),
+                                     len(g.terminals))):
+        base, check, values = pack_rows(rows, width)
+        w('static const uint32_t %s_base[] = {\n%s\n};\n\n'
+          % (name, format_list(['%d' % b for b in base], '    ')))
+        w('static const %s %s_check[] = {\n%s\n};\n\n'
+          % (state_type, name,
+             format_list([check_sentinel if c is None else '%d' % c for c in check], '    ')))
+        empty = 'ERR' if name == 'action' else '0'
+        w('static const %s %s_values[] = {\n%s\n};\n\n'
+          % (state_type if name == 'goto' else action_type, name,
+             format_list([empty if v is None else show(v) for v in values], '    ')))
+    w('const LR_parser_tables<%s> %s = {\n'
+      '    rules,\n'
+      '    {goto_values,   goto_base,   goto_check  },\n'
+      '    {action_values, action_base, action_check},\n'
+      '    default_actions\n'
+      '};\n' % (g.traits, g.tables))
+
+
+def most_frequent(items):
+    """Returns the most frequent of items; of equally frequent ones, the first."""
+    counts = OrderedDict()
+    for x in items:
+        counts[x] = counts.get(x, 0) + 1
+    return max(counts, key=lambda x: counts[x])
+
+
+def write_switch(w, indent, expr, branches, default, show_key):
+    """Writes the switch on expr: branches is a list of pairs (key, code), where equal
+    codes are merged, and the code default is written for the label default. If all
+    branches have the code default, then only this code is written."""
+    codes = OrderedDict()
+    for key, code in branches:
+        if code != default:
+            codes.setdefault(code, []).append(key)
+    if not codes:
+        w('%s%s\n' % (indent, default))
+        return
+    w('%sswitch(%s){\n' % (indent, expr))
+    for code, keys in codes.items():
+        for key in keys:
+            w('%s    case %s:\n' % (indent, show_key(key)))
+        w('%s        %s\n' % (indent, code))
+    w('%s    default:\n%s        %s\n' % (indent, indent, default))
+    w('%s}\n' % indent)
+
+
+def write_direct(g, actions, gotos, defaults, args, out):
+    if g.direct_include is None or g.direct_parser is None:
+        raise Grammar_error('the directives %direct_include and %direct_parser are '
+                            'required for the direct-coded parser')
+    n  = len(actions)
+    w  = out.write
+    w(HEADER % (os.path.basename(args.output), args.grammar, args.method.upper(),
+                'the direct-coded parser'))
+    w('#include "../include/%s"\n\n' % g.direct_include)
+    write_static_asserts(g, w)
+    w('\n')
+    w('/* Terminals:     %s\n * Non-terminals: %s */\n\n'
+      % (' '.join(g.terminals), ' '.join(g.nonterminals)))
+
+    def terminal_case(c):
+        return '%d /* %s */' % (c, g.terminals[c])
+
+    def action_code(act):
+        if act is None:
+            return 'goto error;'
+        kind, arg = act
+        if kind == 'shift':
+            return 'shift_to(%d); goto state_%d;' % (arg, arg)
+        if kind == 'reduce':
+            return 'return_lookahead(); goto reduce_%s;' % g.rules[arg][0]
+        return 'goto accept;'
+
+    w('void %s::compile(Command_buffer& buf)\n{\n' % g.direct_parser)
+    w('    Action_type pai;\n')
+    w('    start(buf);\n\n')
+    for st in range(n):
+        w('state_%d:\n' % st)
+        w('    current_state = %d;\n' % st)
+        if defaults[st] is not None:
+            w('    goto reduce_%s;\n\n' % g.rules[defaults[st][1]][0])
+            continue
+        row = actions[st]
+        w('    read_lexeme();\n')
+        codes = [action_code(e) for e in row]
+        write_switch(w, '    ', 'static_cast<size_t>(t)', list(enumerate(codes)),
+                     most_frequent(codes), terminal_case)
+        w('\n')
+
+    for r, (name, lhs, rhs) in enumerate(g.rules):
+        column  = g.nonterminal_index[lhs]
+        targets = [(st, row[column]) for st, row in enumerate(gotos) if row[column] is not None]
+        codes   = [(st, 'state_stack.push(%d); goto state_%d;' % (to, to)) for st, to in targets]
+        w('reduce_%s:\n' % name)
+        w('    reduce_by(%s, %d);\n' % (name, len(rhs)))
+        write_switch(w, '    ', 'state_stack.top()', codes,
+                     most_frequent([c for _, c in codes]), str)
+        w('\n')
+
+    w('error:\n')
+    w('    pai = error_hadling(current_state);\n')
+    w('    switch(static_cast<Parser_action_name>(pai.kind)){\n')
+    w('        case Parser_action_name::Shift:\n')
+    w('            shift_to(pai.arg);\n')
+    write_switch(w, '            ', 'pai.arg', [(st, 'goto state_%d;' % st) for st in range(n)],
+                 'goto state_%d;' % (n - 1), str)
+    w('        case Parser_action_name::Reduce:\n')
+    w('            return_lookahead();\n')
+    w('            /* The reduction itself is the same as for Reduce_without_back. */\n')
+    w('            [[fallthrough]];\n')
+    w('        case Parser_action_name::Reduce_without_back:\n')
+    write_switch(w, '            ', 'pai.arg', [(r, 'goto reduce_%s;' % name)
+                                               for r, (name, _, _) in enumerate(g.rules)],
+                 'goto reduce_%s;' % g.rules[-1][0], lambda r: g.rules[r][0])
+    w('        default:\n')
+    w('            goto accept;\n')
+    w('    }\n\n')
+
+    w('accept:\n')
+    w('    finish();\n')
+    w('}\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generator of SLR(1) and LALR(1) tables.')
+    parser.add_argument('--method',   choices=['slr', 'lalr'],            default='slr')
+    parser.add_argument('--layout',   choices=['dense', 'comb'],          default='dense')
+    parser.add_argument('--encoding', choices=['auto', 'narrow', 'wide'], default='auto')
+    parser.add_argument('--default-reductions', choices=['yes', 'no'],    default='yes')
+    parser.add_argument('--kind',     choices=['tables', 'direct'],       default='tables')
+    parser.add_argument('grammar')
+    parser.add_argument('output')
+    args = parser.parse_args()
+    try:
+        g          = read_grammar(args.grammar)
+        a          = Automaton(g)
+        reductions = slr_reductions(g, a) if args.method == 'slr' else lalr_reductions(g, a)
+        actions, gotos = build_tables(g, a, reductions)
+        defaults       = find_default_reductions(actions)
+        if args.default_reductions == 'no':
+            defaults = [None] * len(actions)
+        with open(args.output, 'w', encoding='utf-8') as out:
+            if args.kind == 'tables':
+                write_tables(g, actions, gotos, defaults, args, out)
+            else:
+                write_direct(g, actions, gotos, defaults, args, out)
+    except Grammar_error as e:
+        sys.stderr.write('gen_lr_tables.py: %s\n' % e)
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+#
+#   File:    gen_unicode_categories.py
+#   Created: 19 October 2026 at 11:02 Moscow time
+#   Author:  Гаврилов Владимир Сергеевич
+#   E-mails: vladimir.s.gavrilov@gmail.com
+#            gavrilov.vladimir.s@mail.ru
+#            gavvs1977@yandex.ru
+#
+# This script generates the file src/unicode_categories_table.cpp, i.e. the tables of
+# segments for Unicode general categories. The data are taken from the module
+# unicodedata of the Python interpreter running the script.
+#
+# Usage:
+#     python3 tools/gen_unicode_categories.py > src/unicode_categories_table.cpp
+
+import sys
+import unicodedata
+
+MAX_CODE_POINT = 0x10FFFF
+
+
+def segments_by_category():
+    result  = {}
+    current = None
+    lower   = 0
+    for c in range(MAX_CODE_POINT + 2):
+        cat = unicodedata.category(chr(c)) if c <= MAX_CODE_POINT else None
+        if cat != current:
+            if current is not None:
+                result.setdefault(current, []).append((lower, c - 1))
+            current = cat
+            lower   = c
+    return result
+
+
+def unite(lists):
+    merged = sorted(s for l in lists for s in l)
+    result = []
+    for lo, hi in merged:
+        if result and result[-1][1] + 1 >= lo:
+            result[-1] = (result[-1][0], max(result[-1][1], hi))
+        else:
+            result.append((lo, hi))
+    return result
+
+
+def main():
+    leaves = segments_by_category()
+    tables = dict(leaves)
+    for major in sorted({name[0] for name in leaves}):
+        tables[major] = unite([l for n, l in leaves.items() if n[0] == major])
+
+    out = sys.stdout
+    out.write('''/*
+    File:    unicode_categories_table.cpp
+    Created: 19 October 2026 at 11:02 Moscow time
+    Author:  Гаврилов Владимир Сергеевич
+    E-mails: vladimir.s.gavrilov@gmail.com
+             gavrilov.vladimir.s@mail.ru
+             gavvs1977@yandex.ru
+*/
+
+/* This file is generated by the script tools/gen_unicode_categories.py
+ * from the Unicode Character Database, version %s. Do not edit it by hand. */
+
+#include "../include/unicode_categories.h"
+
+template <class T, std::size_t N>
+constexpr size_t size(const T (&array)[N]) noexcept
+{
+    return N;
+}
+''' % unicodedata.unidata_version)
+    names = sorted(tables)
+    for name in names:
+        out.write('\nstatic const Segment<char32_t> segments_%s[] = {\n' % name)
+        segs  = tables[name]
+        items = ['{0x%06X, 0x%06X}' % s for s in segs]
+        for i in range(0, len(items), 4):
+            line = ', '.join(items[i:i + 4])
+            out.write('    ' + line + (',\n' if i + 4 < len(items) else '\n'))
+        out.write('};\n')
+    out.write('\nconst Unicode_category_info unicode_categories[] = {\n')
+    rows = ['    {"%s", %s segments_%s, %s size(segments_%s)}'
+            % (n, ' ' * (2 - len(n)), n, ' ' * (2 - len(n)), n) for n in names]
+    out.write(',\n'.join(rows) + '\n};\n')
+    out.write('\nconst size_t number_of_unicode_categories = size(unicode_categories);\n')
+
+
+if __name__ == '__main__':
+    main()